@@ -0,0 +1,44 @@
+#include "applets.hpp"
+#include "system/env.hpp"
+#include "system/self.hpp"
+#include "utilities/bincat/bincat_program.hpp"
+#include "utilities/cogcheck/cogcheck_program.hpp"
+#include "utilities/gob/gob_program.hpp"
+#include <boost/filesystem.hpp>
+
+namespace {
+
+    gorc::applet_registry make_applet_registry()
+    {
+        gorc::applet_registry rv;
+
+        rv.add_applet("bincat", &gorc::make_bincat_program);
+        rv.add_applet("cogcheck", &gorc::make_cogcheck_program);
+        rv.add_applet("gob", &gorc::make_gob_program);
+
+        return rv;
+    }
+
+}
+
+gorc::maybe<gorc::applet_factory const*> gorc::get_applet_for_executable(path const &executable)
+{
+    static applet_registry const applets = make_applet_registry();
+    static path const applet_dir = get_self_executable_path().parent_path();
+
+    if(has_environment_variable("GORC_NO_APPLETS")) {
+        return nothing;
+    }
+
+    auto applet = applets.get_applet(executable.filename().string());
+    if(!applet.has_value() || !executable.has_parent_path()) {
+        return nothing;
+    }
+
+    boost::system::error_code ec;
+    if(!boost::filesystem::equivalent(executable.parent_path(), applet_dir, ec)) {
+        return nothing;
+    }
+
+    return applet;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "program/applet_registry.hpp"
+#include "io/path.hpp"
+#include "utility/maybe.hpp"
+
+namespace gorc {
+
+    // Returns the applet which can run in place of an executable.
+    // Only executables installed beside boc-shell are replaced by applets.
+    // Setting GORC_NO_APPLETS forces all commands to run as separate processes.
+    maybe<applet_factory const*> get_applet_for_executable(path const &executable);
+
+}
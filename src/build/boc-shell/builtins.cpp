@@ -2,6 +2,7 @@
 #include "symbols.hpp"
 #include "stack.hpp"
 #include "io/path.hpp"
+#include "system/env.hpp"
 #include <boost/filesystem.hpp>
 
 void gorc::register_builtins()
@@ -49,6 +50,12 @@ void gorc::register_builtins()
                 return shvalue_from_boolean(boost::filesystem::is_regular_file(top_arg));
             });
 
+    register_builtin("is_env", 1, [](arglist const &args)
+            {
+                auto value = get_environment_variable(shvalue_to_string(args.at(0)));
+                return shvalue_from_boolean(value.has_value());
+            });
+
     register_builtin("absolute_path", 1, [](arglist const &args)
             {
                 path top_arg = shvalue_to_string(args.at(0));
@@ -1,4 +1,6 @@
 #include "command_visitor.hpp"
+#include "applets.hpp"
+#include "program/applet_thread.hpp"
 #include "system/process.hpp"
 #include "system/pipe.hpp"
 #include "io_redirection_visitor.hpp"
@@ -76,6 +78,7 @@ int gorc::command_visitor::visit(pipe_command &cmd)
     auto stdout_it = stdout_pipes.begin();
 
     std::vector<std::unique_ptr<process>> processes;
+    std::unique_ptr<applet_thread> applet;
 
     while(sub_it != cmd.subcommands->elements.end() &&
           stdin_it != stdin_pipes.end() &&
@@ -95,11 +98,25 @@ int gorc::command_visitor::visit(pipe_command &cmd)
             args.push_back(*it);
         }
 
-        processes.push_back(std::make_unique<process>(prog,
-                                                      args,
-                                                      *stdin_it,
-                                                      *stdout_it,
-                                                      redirected_stderr_pipe));
+        // Single commands which are gorc programs run inside the shell.
+        // Applets share the shell's standard streams, so pipelines with more
+        // than one command always use separate processes.
+        auto applet_fn = get_applet_for_executable(prog);
+        if(num_subcommands == 1 && applet_fn.has_value()) {
+            applet = std::make_unique<applet_thread>(*applet_fn.get_value(),
+                                                     args,
+                                                     *stdin_it,
+                                                     *stdout_it,
+                                                     redirected_stderr_pipe);
+        }
+        else {
+            processes.push_back(std::make_unique<process>(prog,
+                                                          args,
+                                                          *stdin_it,
+                                                          *stdout_it,
+                                                          redirected_stderr_pipe));
+        }
+
         ++sub_it;
         ++stdin_it;
         ++stdout_it;
@@ -138,6 +155,11 @@ int gorc::command_visitor::visit(pipe_command &cmd)
     }
 
     int last_exit_code = 0;
+    if(applet) {
+        last_exit_code = applet->join();
+        exit_code_sequence.push_back(std::to_string(last_exit_code));
+    }
+
     for(auto &proc : processes) {
         last_exit_code = proc->join();
         exit_code_sequence.push_back(std::to_string(last_exit_code));
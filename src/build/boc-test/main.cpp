@@ -4,6 +4,8 @@
 #include "build/common/make_progress_factory.hpp"
 #include "find_tests.hpp"
 #include "run_tests.hpp"
+#include "test_cache.hpp"
+#include "test_inputs.hpp"
 #include "system/self.hpp"
 #include "system/env.hpp"
 #include "utility/service_registry.hpp"
@@ -18,7 +20,9 @@ namespace gorc {
         path original_working_directory_rel;
 
         bool print_summary = false;
+        bool use_cache = false;
         size_t threads = 1;
+        int timeout_seconds = 0;
 
         virtual void create_options(options &opts) override
         {
@@ -26,6 +30,9 @@ namespace gorc {
 
             opts.insert(make_value_option("threads", threads));
             opts.add_alias("threads", "-j");
+
+            opts.insert(make_value_option("timeout", timeout_seconds));
+            opts.insert(make_switch_option("cache", use_cache));
         }
 
         virtual int run() override
@@ -54,12 +61,27 @@ namespace gorc {
             set_environment_variable("PROJECT_ROOT", project_root_path.native());
             set_environment_variable("BOC_SHELL", shell_path.native());
 
-            return run_tests(tests,
-                             shell_path,
-                             boc_test_log_filename,
-                             services,
-                             threads,
-                             print_summary);
+            // With --cache, tests which passed before are skipped while their
+            // inputs and the executables are unchanged. Otherwise every test
+            // runs, and the cache only orders tests by their last duration.
+            maybe<uint64_t> input_seed;
+            if(use_cache) {
+                input_seed = hash_executables(self_path.parent_path());
+            }
+
+            test_cache cache(boc_test_cache_filename);
+            int result = run_tests(tests,
+                                   shell_path,
+                                   boc_test_log_filename,
+                                   services,
+                                   threads,
+                                   print_summary,
+                                   std::chrono::seconds(timeout_seconds),
+                                   cache,
+                                   input_seed);
+            cache.save(boc_test_cache_filename);
+
+            return result;
         }
     };
 
@@ -1,4 +1,5 @@
 #include "run_tests.hpp"
+#include "test_inputs.hpp"
 #include "build/common/paths.hpp"
 #include "system/pipe.hpp"
 #include "system/process.hpp"
@@ -12,43 +13,104 @@
 #include <thread>
 #include <mutex>
 #include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <vector>
 
 int gorc::run_tests(std::set<path> const &tests,
                     path const &boc_shell,
                     path const &fail_log,
                     service_registry const &services,
                     size_t threads,
-                    bool print_summary)
+                    bool print_summary,
+                    std::chrono::seconds timeout,
+                    test_cache &cache,
+                    maybe<uint64_t> input_seed)
 {
     boost::filesystem::remove(fail_log);
     std::ofstream fail_log_ofs(fail_log.native());
 
-    LOG_INFO(format("Running %d tests") % tests.size());
+    std::set<path> passed_tests;
+    std::set<path> failed_tests;
+
+    // Skip tests which passed with identical inputs on a previous run.
+    std::map<path, uint64_t> input_hashes;
+    std::vector<path> pending_tests;
+    maybe_if(input_seed, [&](uint64_t seed) {
+            test_input_hasher hasher(seed);
+            for(auto const &test : tests) {
+                input_hashes.emplace(test, hasher.hash(test));
+            }
+        });
+
+    for(auto const &test : tests) {
+        auto hash_it = input_hashes.find(test);
+        auto entry = cache.get(test);
+        if(hash_it != input_hashes.end() &&
+           entry.has_value() &&
+           entry.get_value().passed_input_hash.has_value() &&
+           entry.get_value().passed_input_hash.get_value() == hash_it->second) {
+            passed_tests.insert(test);
+        }
+        else {
+            pending_tests.push_back(test);
+        }
+    }
+
+    // Start the longest tests first, so that a slow test does not run alone at the
+    // end of the suite. Tests without a recorded duration are assumed to be long.
+    auto expected_duration = [&](path const &test) {
+        auto entry = cache.get(test);
+        if(entry.has_value()) {
+            return entry.get_value().duration_seconds;
+        }
+
+        return std::numeric_limits<double>::infinity();
+    };
+
+    std::stable_sort(pending_tests.begin(),
+                     pending_tests.end(),
+                     [&](path const &a, path const &b) {
+                         return expected_duration(a) > expected_duration(b);
+                     });
+
+    if(!passed_tests.empty()) {
+        LOG_INFO(format("Skipping %d unchanged tests") % passed_tests.size());
+    }
 
-    auto bare_progress = services.get<progress_factory>().make_progress(tests.size());
+    LOG_INFO(format("Running %d tests") % pending_tests.size());
+
+    auto bare_progress = services.get<progress_factory>().make_progress(pending_tests.size());
     rate_limited_progress progress(*bare_progress);
 
-    std::set<path> pending_tests = tests;
-    std::set<path> passed_tests;
-    std::set<path> failed_tests;
+    size_t next_test_index = 0;
     std::mutex test_queue_lock;
 
     auto get_next_test = [&]() -> maybe<path> {
         std::lock_guard<std::mutex> lg(test_queue_lock);
-        if(pending_tests.empty()) {
+        if(next_test_index >= pending_tests.size()) {
             return nothing;
         }
 
-        auto it = pending_tests.begin();
-        path rv = *it;
-        pending_tests.erase(it);
-        return rv;
+        return pending_tests[next_test_index++];
     };
 
-    auto retire_test = [&](path const &test, int result_code) {
+    auto retire_test = [&](path const &test, int result_code, double duration_seconds) {
         std::lock_guard<std::mutex> lg(test_queue_lock);
         progress.advance();
 
+        maybe<uint64_t> passed_input_hash;
+        if(result_code == 0) {
+            auto hash_it = input_hashes.find(test);
+            if(hash_it != input_hashes.end()) {
+                passed_input_hash = hash_it->second;
+            }
+        }
+
+        cache.record(test, duration_seconds, passed_input_hash);
+
         if(result_code == 0) {
             passed_tests.insert(test);
             boost::filesystem::remove_all(test / boc_test_suite_dir);
@@ -76,15 +138,34 @@ int gorc::run_tests(std::set<path> const &tests,
             boc_test_shell_filename.native()
         };
 
+        bool has_timeout = timeout.count() > 0;
+
+        // Tests with a timeout run in their own process group, so that any
+        // processes they started can be killed along with them.
         process test_proc(boc_shell,
                           args,
                           nothing,
                           &p,
                           &p,
-                          test);
+                          test,
+                          /* new process group */ has_timeout);
+
+        if(!has_timeout) {
+            return test_proc.join();
+        }
 
-        // TODO: test timeout
-        return test_proc.join();
+        auto result = test_proc.join_for(timeout);
+        if(result.has_value()) {
+            return result.get_value();
+        }
+
+        test_proc.kill();
+        test_proc.join();
+
+        std::ofstream test_log((test / boc_test_suite_dir / boc_test_log_filename).native(),
+                               std::ios::app);
+        test_log << "[ERROR] test timed out after " << timeout.count() << " seconds" << std::endl;
+        return 124;
     };
 
     auto test_thread = [&]() {
@@ -94,8 +175,11 @@ int gorc::run_tests(std::set<path> const &tests,
                 return;
             }
 
+            auto start_time = std::chrono::steady_clock::now();
             int result_code = run_test(next_test.get_value());
-            retire_test(next_test.get_value(), result_code);
+            std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+
+            retire_test(next_test.get_value(), result_code, duration.count());
         }
     };
 
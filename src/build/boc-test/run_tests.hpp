@@ -1,8 +1,12 @@
 #pragma once
 
 #include <set>
+#include <chrono>
+#include <cstdint>
 #include "io/path.hpp"
+#include "utility/maybe.hpp"
 #include "utility/service_registry.hpp"
+#include "test_cache.hpp"
 
 namespace gorc {
 
@@ -11,6 +15,9 @@ namespace gorc {
                   path const &fail_log,
                   service_registry const &,
                   size_t threads,
-                  bool print_summary);
+                  bool print_summary,
+                  std::chrono::seconds timeout,
+                  test_cache &cache,
+                  maybe<uint64_t> input_seed);
 
 }
@@ -0,0 +1,93 @@
+#include "test_cache.hpp"
+#include "log/log.hpp"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+gorc::test_cache::test_cache()
+{
+    return;
+}
+
+gorc::test_cache::test_cache(path const &filename)
+{
+    std::ifstream ifs(filename.native());
+    if(!ifs) {
+        return;
+    }
+
+    // One test per line: <duration ms> <input hash or -> <test path>
+    for(std::string line; std::getline(ifs, line); ) {
+        std::istringstream iss(line);
+
+        uint64_t duration_ms = 0;
+        std::string hash;
+        if(!(iss >> duration_ms >> hash)) {
+            LOG_WARNING("ignoring malformed test cache");
+            entries.clear();
+            return;
+        }
+
+        std::string test_name;
+        std::getline(iss >> std::ws, test_name);
+        if(test_name.empty()) {
+            LOG_WARNING("ignoring malformed test cache");
+            entries.clear();
+            return;
+        }
+
+        test_cache_entry entry;
+        entry.duration_seconds = static_cast<double>(duration_ms) / 1000.0;
+        if(hash != "-") {
+            std::istringstream hash_iss(hash);
+            uint64_t hash_value = 0;
+            if(!(hash_iss >> std::hex >> hash_value)) {
+                LOG_WARNING("ignoring malformed test cache");
+                entries.clear();
+                return;
+            }
+
+            entry.passed_input_hash = hash_value;
+        }
+
+        entries.emplace(path(test_name), entry);
+    }
+}
+
+void gorc::test_cache::save(path const &filename) const
+{
+    std::ofstream ofs(filename.native());
+    for(auto const &entry : entries) {
+        ofs << static_cast<uint64_t>(entry.second.duration_seconds * 1000.0) << " ";
+
+        if(entry.second.passed_input_hash.has_value()) {
+            ofs << std::hex << std::setw(16) << std::setfill('0')
+                << entry.second.passed_input_hash.get_value()
+                << std::dec << std::setfill(' ');
+        }
+        else {
+            ofs << "-";
+        }
+
+        ofs << " " << entry.first.generic_string() << std::endl;
+    }
+}
+
+gorc::maybe<gorc::test_cache_entry> gorc::test_cache::get(path const &test) const
+{
+    auto it = entries.find(test);
+    if(it == entries.end()) {
+        return nothing;
+    }
+
+    return it->second;
+}
+
+void gorc::test_cache::record(path const &test,
+                              double duration_seconds,
+                              maybe<uint64_t> passed_input_hash)
+{
+    auto &entry = entries[test];
+    entry.duration_seconds = duration_seconds;
+    entry.passed_input_hash = passed_input_hash;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "io/path.hpp"
+#include "utility/maybe.hpp"
+#include <cstdint>
+#include <map>
+
+namespace gorc {
+
+    class test_cache_entry {
+    public:
+        double duration_seconds = 0.0;
+
+        // Hash of the test inputs the last time the test passed.
+        // Empty if the last run failed.
+        maybe<uint64_t> passed_input_hash;
+    };
+
+    // Results of previous test runs, used to schedule long tests first and to
+    // skip tests whose inputs have not changed since they last passed.
+    class test_cache {
+    private:
+        std::map<path, test_cache_entry> entries;
+
+    public:
+        test_cache();
+
+        // Missing or malformed cache files produce an empty cache.
+        explicit test_cache(path const &filename);
+
+        void save(path const &filename) const;
+
+        maybe<test_cache_entry> get(path const &test) const;
+        void record(path const &test, double duration_seconds, maybe<uint64_t> passed_input_hash);
+    };
+
+}
@@ -0,0 +1,204 @@
+#include "test_inputs.hpp"
+#include "build/common/paths.hpp"
+#include "system/env.hpp"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    class fnv1a_hash {
+    public:
+        uint64_t value = 14695981039346656037ULL;
+
+        void add(void const *data, size_t size)
+        {
+            auto const *bytes = reinterpret_cast<unsigned char const *>(data);
+            for(size_t i = 0; i < size; ++i) {
+                value ^= bytes[i];
+                value *= 1099511628211ULL;
+            }
+        }
+
+        void add(std::string const &str)
+        {
+            add(str.data(), str.size());
+
+            // Separate consecutive strings
+            char terminator = '\0';
+            add(&terminator, 1);
+        }
+
+        void add(uint64_t v)
+        {
+            add(&v, sizeof(v));
+        }
+
+        void add_file_contents(gorc::path const &filename)
+        {
+            std::ifstream ifs(filename.native(), std::ios::binary);
+            char buffer[64 * 1024];
+            while(ifs) {
+                ifs.read(buffer, sizeof(buffer));
+                add(buffer, static_cast<size_t>(ifs.gcount()));
+            }
+        }
+    };
+
+    std::vector<gorc::path> sorted_files(gorc::path const &dir, bool recursive)
+    {
+        std::vector<gorc::path> rv;
+
+        if(!boost::filesystem::is_directory(dir)) {
+            return rv;
+        }
+
+        if(recursive) {
+            for(auto it = boost::filesystem::recursive_directory_iterator(dir);
+                it != boost::filesystem::recursive_directory_iterator();
+                ++it) {
+                if(it->path().filename() == gorc::boc_test_suite_dir) {
+                    // Test output, not test input
+                    it.no_push();
+                }
+                else if(boost::filesystem::is_regular_file(it->status())) {
+                    rv.push_back(it->path());
+                }
+            }
+        }
+        else {
+            for(auto it = boost::filesystem::directory_iterator(dir);
+                it != boost::filesystem::directory_iterator();
+                ++it) {
+                if(boost::filesystem::is_regular_file(it->status())) {
+                    rv.push_back(it->path());
+                }
+            }
+        }
+
+        std::sort(rv.begin(), rv.end());
+        return rv;
+    }
+
+    // Declared inputs are listed one per line, as files or directories. Lines
+    // starting with '#' are comments. A leading $NAME is replaced by the value
+    // of the environment variable, and relative paths are relative to the file.
+    std::vector<gorc::path> read_declared_inputs(gorc::path const &filename)
+    {
+        std::vector<gorc::path> rv;
+
+        std::ifstream ifs(filename.native());
+        std::string line;
+        while(std::getline(ifs, line)) {
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+            line.erase(0, line.find_first_not_of(" \t"));
+            if(line.empty() || line.front() == '#') {
+                continue;
+            }
+
+            if(line.front() == '$') {
+                auto name_end = std::min(line.find('/'), line.size());
+                auto value = gorc::get_environment_variable(line.substr(1, name_end - 1));
+                if(value.has_value()) {
+                    line.replace(0, name_end, value.get_value());
+                }
+            }
+
+            gorc::path input(line);
+            if(input.is_relative()) {
+                input = filename.parent_path() / input;
+            }
+
+            rv.push_back(input);
+        }
+
+        return rv;
+    }
+
+}
+
+uint64_t gorc::hash_executables(path const &bin_dir)
+{
+    fnv1a_hash hash;
+    for(auto const &file : sorted_files(bin_dir, /* recursive */ false)) {
+        hash.add(file.filename().generic_string());
+        hash.add_file_contents(file);
+    }
+
+    return hash.value;
+}
+
+gorc::test_input_hasher::test_input_hasher(uint64_t seed)
+    : seed(seed)
+{
+    return;
+}
+
+uint64_t gorc::test_input_hasher::hash_data_input(path const &input)
+{
+    auto it = data_input_hashes.find(input);
+    if(it != data_input_hashes.end()) {
+        return it->second;
+    }
+
+    // Missing inputs hash to their name alone, which differs from any hash
+    // taken while the input exists.
+    fnv1a_hash hash;
+    hash.add(input.generic_string());
+
+    if(boost::filesystem::is_regular_file(input)) {
+        hash.add_file_contents(input);
+    }
+    else {
+        for(auto const &file : sorted_files(input, /* recursive */ true)) {
+            hash.add(file.generic_string());
+            hash.add_file_contents(file);
+        }
+    }
+
+    data_input_hashes.emplace(input, hash.value);
+    return hash.value;
+}
+
+uint64_t gorc::test_input_hasher::hash(path const &test)
+{
+    fnv1a_hash hash;
+    hash.add(seed);
+
+    for(auto const &file : sorted_files(test, /* recursive */ true)) {
+        hash.add(file.generic_string());
+        hash.add_file_contents(file);
+    }
+
+    // Scripts in enclosing directories, which tests include with relative paths
+    for(path dir = test.parent_path(); !dir.empty(); dir = dir.parent_path()) {
+        for(auto const &file : sorted_files(dir, /* recursive */ false)) {
+            if(file.extension() == ".boc") {
+                hash.add(file.generic_string());
+                hash.add_file_contents(file);
+            }
+        }
+    }
+
+    for(auto const &file : sorted_files("rules", /* recursive */ true)) {
+        hash.add(file.generic_string());
+        hash.add_file_contents(file);
+    }
+
+    // Data the test reads from outside the project
+    for(path dir = test; !dir.empty(); dir = dir.parent_path()) {
+        path inputs_file = dir / boc_test_inputs_filename;
+        if(!boost::filesystem::is_regular_file(inputs_file)) {
+            continue;
+        }
+
+        hash.add(inputs_file.generic_string());
+        for(auto const &input : read_declared_inputs(inputs_file)) {
+            hash.add(hash_data_input(input));
+        }
+    }
+
+    return hash.value;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "io/path.hpp"
+#include <cstdint>
+#include <map>
+
+namespace gorc {
+
+    // Fingerprint of the executables in a directory, taken from their names and
+    // contents.
+    uint64_t hash_executables(path const &bin_dir);
+
+    // Hashes everything a test depends on: the contents of the test directory,
+    // the shell scripts it may include from enclosing directories, the shared
+    // rules directory and the data inputs declared by test-inputs.txt files in
+    // the test directory and its enclosing directories.
+    class test_input_hasher {
+    private:
+        uint64_t seed;
+
+        // Declared inputs are usually shared by many tests, and are hashed once.
+        std::map<path, uint64_t> data_input_hashes;
+
+        uint64_t hash_data_input(path const &input);
+
+    public:
+        explicit test_input_hasher(uint64_t seed);
+
+        uint64_t hash(path const &test);
+    };
+
+}
@@ -3,6 +3,8 @@
 gorc::path const gorc::boc_project_filename("project.json");
 
 gorc::path const gorc::boc_test_log_filename("test-log.txt");
+gorc::path const gorc::boc_test_cache_filename("test-cache.txt");
+gorc::path const gorc::boc_test_inputs_filename("test-inputs.txt");
 gorc::path const gorc::boc_test_suite_dir("tempdir");
 gorc::path const gorc::boc_test_shell_filename("test.boc");
 
@@ -8,6 +8,8 @@ namespace gorc {
     extern path const boc_project_filename;
 
     extern path const boc_test_log_filename;
+    extern path const boc_test_cache_filename;
+    extern path const boc_test_inputs_filename;
     extern path const boc_test_suite_dir;
     extern path const boc_test_shell_filename;
     extern std::vector<std::string> const boc_test_default_directories;
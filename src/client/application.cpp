@@ -4,6 +4,10 @@
 #include "jk/vfs/gob_virtual_container.hpp"
 #include "libold/base/events/print.hpp"
 #include "world/level_view.hpp"
+#include "io/native_file.hpp"
+#include "profile/trace_export.hpp"
+#include "game/world/replay/state_hash.hpp"
+#include "game/world/level_snapshot.hpp"
 #include <boost/algorithm/string/predicate.hpp>
 
 gorc::client::application::application(service_registry const &services)
@@ -23,11 +27,89 @@ gorc::client::application::application(service_registry const &services)
 
 gorc::client::application::~application()
 {
-    return;
+    // Store materials loaded after the level
+    save_texture_cache();
+    write_profile_trace();
+}
+
+void gorc::client::application::save_texture_cache()
+{
+    if(!material_texture_cache) {
+        return;
+    }
+
+    try {
+        material_texture_cache->save();
+    }
+    catch(std::exception const &e) {
+        LOG_WARNING(format("could not save texture cache: %s") % e.what());
+    }
+}
+
+void gorc::client::application::report_profile_summary()
+{
+    LOG_INFO(format("profile: %d frames, most expensive zones:") % profile_summary.frame_count());
+
+    auto entries = profile_summary.get_entries();
+    for(size_t i = 0; i < std::min(entries.size(), size_t(10)); ++i) {
+        auto const &entry = entries[i];
+        LOG_INFO(format("  %8.3f ms/frame  %8.3f ms max  %6.1f calls/frame  %s") %
+                 entry.ms_per_frame %
+                 entry.max_ms %
+                 entry.calls_per_frame %
+                 entry.zone);
+    }
+}
+
+void gorc::client::application::write_profile_trace()
+{
+    if(input_profile_trace.empty()) {
+        return;
+    }
+
+    try {
+        auto f = make_native_file(input_profile_trace);
+        json_output_stream jos(*f);
+        profile::write_chrome_trace(jos, profile_trace_zones);
+    }
+    catch(std::exception const &e) {
+        LOG_WARNING(format("could not write profile trace: %s") % e.what());
+    }
+}
+
+void gorc::client::application::start_input_recording()
+{
+    auto &presenter = *components.current_level_presenter;
+
+    game::world::replay::input_log_header header;
+    header.random_seed = presenter.random_seed;
+    header.timestep_ms = static_cast<int>(gameplay_timestep * 1000.0);
+    header.episode = input_episodename;
+    header.level = input_levelname;
+
+    input_record_file = make_native_file(input_record);
+    input_recorder = std::make_unique<game::world::replay::input_recorder>(*input_record_file, header);
+    presenter.input_recorder = input_recorder.get();
+}
+
+void gorc::client::application::finish_input_replay()
+{
+    LOG_INFO(format("replay finished after %d ticks") % input_player->get_tick());
+
+    if(input_player->first_mismatch.has_value()) {
+        LOG_ERROR(format("level state differs from the recording on %d ticks, first on tick %d") %
+                  input_player->mismatched_ticks %
+                  input_player->first_mismatch.get_value());
+    }
+
+    input_player.reset();
+    eventbus.fire_event(events::exit());
 }
 
 void gorc::client::application::startup(event_bus &eventbus, content_manager &content)
 {
+    profile::set_enabled(!input_profile_trace.empty());
+
     // Register handler to print messages.
     print_delegate = eventbus.add_handler<events::print>(
         [](const events::print &print) { LOG_INFO(print.message); });
@@ -49,19 +131,80 @@ void gorc::client::application::startup(event_bus &eventbus, content_manager &co
     // HACK: Set current level to 01narshadda.jkl.
     components.services.add_or_replace(eventbus);
     components.services.add_or_replace<gorc::renderer_object_factory>(renderer_object_factory);
+
+    if(!input_texture_cache.empty()) {
+        material_texture_cache = std::make_unique<texture_cache>(input_texture_cache);
+        components.services.add_or_replace(*material_texture_cache);
+    }
+
+    if(!input_record.empty() && !input_replay.empty()) {
+        LOG_FATAL("cannot record and replay input at the same time");
+    }
+
+    if(!restore_filename.empty() && (!input_record.empty() || !input_replay.empty())) {
+        LOG_FATAL("cannot restore a checkpoint while recording or replaying input");
+    }
+
+    if(!input_replay.empty()) {
+        diagnostic_context dc(input_replay.c_str());
+        auto f = make_native_read_only_file(input_replay);
+        binary_input_stream bis(*f, binary_stream_buffer_size);
+        input_replay_log = std::make_unique<game::world::replay::input_log>(deserialization_constructor, bis);
+
+        auto const &header = input_replay_log->header;
+        if(header.episode != input_episodename || header.level != input_levelname) {
+            LOG_WARNING(format("replay was recorded in %s %s") % header.episode % header.level);
+        }
+
+        if(header.timestep_ms != static_cast<int>(gameplay_timestep * 1000.0)) {
+            LOG_WARNING(format("replay was recorded with a %d ms timestep") % header.timestep_ms);
+        }
+    }
+
     auto contentmanager = std::make_shared<content_manager>(components.services);
     const auto &lev = contentmanager->load<content::assets::level>(input_levelname);
+    save_texture_cache();
 
     // Start game:
     components.current_level_presenter = std::make_unique<game::world::level_presenter>(
         components, game::world::level_place(contentmanager, lev));
     place_controller.go_to(action::action_place());
 
+    if(input_replay_log) {
+        components.current_level_presenter->random_seed = input_replay_log->header.random_seed;
+        components.current_level_presenter->replaying = true;
+        input_player = std::make_unique<game::world::replay::input_player>(*input_replay_log);
+    }
+
     components.current_level_presenter->start(eventbus);
 
+    if(!restore_filename.empty()) {
+        game::world::restore_level_snapshot(*components.current_level_presenter->model,
+                                            restore_filename);
+    }
+
+    if(!input_record.empty()) {
+        start_input_recording();
+    }
+
+    if(!checkpoint_filename.empty()) {
+        if(checkpoint_interval <= 0) {
+            LOG_FATAL("checkpoint interval must be positive");
+        }
+
+        checkpoint_file = make_native_file(checkpoint_filename);
+        checkpoint_writer = std::make_unique<snapshot_writer>(*checkpoint_file);
+    }
+
     level_view->set_presenter(components.current_level_presenter.get());
     level_view->set_level_model(components.current_level_presenter->model.get());
 
+    // Input is handed to the simulation thread, and the view draws between
+    // the ticks it publishes.
+    components.current_level_presenter->queue_input = threaded_simulation;
+    components.current_level_presenter->publish_render_snapshots = threaded_simulation;
+    level_view->set_interpolation(threaded_simulation);
+
     views.set_layer(view_layer::world, *level_view);
 
     return;
@@ -74,7 +217,64 @@ void gorc::client::application::shutdown()
 
 void gorc::client::application::update(const gorc::time &time, const box<2, int> &)
 {
-    components.current_level_presenter->update(time);
+    auto &presenter = *components.current_level_presenter;
+
+    if(input_player) {
+        if(input_player->done()) {
+            finish_input_replay();
+            return;
+        }
+
+        input_player->begin_tick(presenter);
+    }
+
+    presenter.update(time);
+
+    if(input_player) {
+        input_player->end_tick(game::world::replay::hash_level_state(*presenter.model));
+    }
+
+    if(input_recorder) {
+        input_recorder->end_tick(game::world::replay::hash_level_state(*presenter.model));
+    }
+
+    if(checkpoint_writer && ++ticks_since_checkpoint >= checkpoint_interval) {
+        write_checkpoint();
+    }
+}
+
+void gorc::client::application::write_checkpoint()
+{
+    // The level is copied here. Comparing and writing pages happens on the writer thread.
+    game::world::capture_level_snapshot(*components.current_level_presenter->model, checkpoint_image);
+    checkpoint_writer->submit(checkpoint_image);
+    ticks_since_checkpoint = 0;
+}
+
+void gorc::client::application::end_frame()
+{
+    if(!profile::is_enabled()) {
+        return;
+    }
+
+    auto zones = profile::collect();
+    profile_summary.add_frame(zones);
+
+    size_t trace_space = max_profile_trace_zones - profile_trace_zones.size();
+    if(zones.size() > trace_space) {
+        if(trace_space > 0) {
+            LOG_WARNING("profile trace is full; later zones are summarized but not written");
+        }
+
+        zones.resize(trace_space);
+    }
+
+    profile_trace_zones.insert(profile_trace_zones.end(), zones.begin(), zones.end());
+
+    if(++frames_since_profile_report >= profile_report_frames) {
+        frames_since_profile_report = 0;
+        report_profile_summary();
+    }
 }
 
 void gorc::client::application::register_verbs()
@@ -89,6 +289,17 @@ void gorc::client::application::create_options(options &opts)
 {
     opts.insert(make_value_option("episode", input_episodename));
     opts.insert(make_value_option("level", input_levelname));
+    opts.insert(make_value_option("texture-cache",
+                                  input_texture_cache,
+                                  std::string("game/texture_cache.pack")));
+    opts.insert(make_value_option("profile", input_profile_trace));
+    opts.insert(make_switch_option("sim-thread", threaded_simulation));
+    opts.insert(make_value_option("max-fps", max_frames_per_second, 0));
+    opts.insert(make_value_option("record", input_record));
+    opts.insert(make_value_option("replay", input_replay));
+    opts.insert(make_value_option("checkpoint", checkpoint_filename));
+    opts.insert(make_value_option("checkpoint-interval", checkpoint_interval, 300));
+    opts.insert(make_value_option("restore", restore_filename));
 
     opts.emplace_constraint<required_option>(std::vector<std::string>{"episode", "level"});
     return;
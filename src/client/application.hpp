@@ -10,7 +10,12 @@
 #include "game/level_state.hpp"
 #include "utility/service_registry.hpp"
 #include "client_renderer_object_factory.hpp"
+#include "jk/content/texture_cache.hpp"
 #include "libold/base/utility/randomizer.hpp"
+#include "profile/frame_summary.hpp"
+#include "game/world/replay/input_log.hpp"
+#include "io/native_file.hpp"
+#include "io/snapshot_writer.hpp"
 
 namespace gorc {
 namespace client {
@@ -29,15 +34,50 @@ private:
 
     maybe<scoped_delegate> print_delegate;
 
+    // Zones kept for the trace file, up to a fixed limit
+    static constexpr size_t max_profile_trace_zones = 1 << 20;
+    static constexpr size_t profile_report_frames = 600;
+
+    std::vector<profile::zone_record> profile_trace_zones;
+    profile::frame_summary profile_summary;
+    size_t frames_since_profile_report = 0;
+
+    // Input recording and replay
+    std::unique_ptr<native_file> input_record_file;
+    std::unique_ptr<game::world::replay::input_recorder> input_recorder;
+    std::unique_ptr<game::world::replay::input_log> input_replay_log;
+    std::unique_ptr<game::world::replay::input_player> input_player;
+
+    // Level state snapshots, written in the background. The last one
+    // written can be restored with --restore.
+    std::unique_ptr<native_file> checkpoint_file;
+    std::unique_ptr<snapshot_writer> checkpoint_writer;
+    snapshot_image checkpoint_image;
+    int ticks_since_checkpoint = 0;
+
     void register_verbs();
+    void save_texture_cache();
+    void start_input_recording();
+    void finish_input_replay();
+    void write_checkpoint();
+    void report_profile_summary();
+    void write_profile_trace();
 
 public:
     std::string input_episodename;
     std::string input_levelname;
+    std::string input_texture_cache;
+    std::string input_profile_trace;
+    std::string input_record;
+    std::string input_replay;
+    std::string checkpoint_filename;
+    std::string restore_filename;
+    int checkpoint_interval = 0;
 
     jk_virtual_file_system& virtual_filesystem;
 
     client_renderer_object_factory renderer_object_factory;
+    std::unique_ptr<texture_cache> material_texture_cache;
     utility::randomizer randomizer;
 
     std::unique_ptr<world::level_view> level_view;
@@ -52,6 +92,7 @@ public:
     virtual void shutdown() override;
 
     virtual void update(const gorc::time& time, const box<2, int>& view_size) override;
+    virtual void end_frame() override;
 
     virtual void create_options(options&) override;
 };
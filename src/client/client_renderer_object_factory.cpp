@@ -1,48 +1,311 @@
 #include "client_renderer_object_factory.hpp"
+#include "log/log.hpp"
+#include "profile/profiler.hpp"
+#include <cstring>
+
+gorc::client_renderer_object_factory::pending_material_image::pending_material_image(
+        material_id id,
+        int cel,
+        int channel,
+        bool generate_mipmaps,
+        std::vector<grid<color_rgba8>> levels)
+    : id(id)
+    , cel(cel)
+    , channel(channel)
+    , generate_mipmaps(generate_mipmaps)
+    , levels(std::move(levels))
+    , byte_size(0)
+{
+    for(auto const &level : this->levels) {
+        byte_size += volume(level.size) * sizeof(color_rgba8);
+    }
+}
 
 gorc::client_renderer_object_factory::~client_renderer_object_factory()
 {
-    for(auto &material_image : material_images) {
-        glDeleteTextures(1, &material_image.second);
+    for(auto &textures : material_textures) {
+        for(auto &texture_id : textures) {
+            if(texture_id != 0) {
+                glDeleteTextures(1, &texture_id);
+            }
+        }
+    }
+
+    if(staging_fence) {
+        glDeleteSync(staging_fence);
+    }
+
+    if(staging_buffer != 0) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging_buffer);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glDeleteBuffers(1, &staging_buffer);
     }
 }
 
-void gorc::client_renderer_object_factory::set_material_image(material_id id,
-                                                              int cel,
-                                                              int channel,
-                                                              grid<color_rgba8> const &img)
+void gorc::client_renderer_object_factory::initialize_gl()
+{
+    if(gl_initialized) {
+        return;
+    }
+
+    gl_initialized = true;
+
+    if(GLEW_EXT_texture_filter_anisotropic) {
+        GLfloat largest_supported_anisotropy;
+        glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &largest_supported_anisotropy);
+        max_anisotropy = largest_supported_anisotropy;
+    }
+
+    // Images are staged through a persistently mapped pixel buffer where
+    // supported. Otherwise they are uploaded directly from client memory.
+    if(GLEW_ARB_buffer_storage && GLEW_ARB_sync) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glGenBuffers(1, &staging_buffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging_buffer);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, upload_bytes_per_frame, nullptr, flags);
+        staging_memory = static_cast<char*>(
+                glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, upload_bytes_per_frame, flags));
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if(!staging_memory) {
+            glDeleteBuffers(1, &staging_buffer);
+            staging_buffer = 0;
+        }
+    }
+}
+
+void gorc::client_renderer_object_factory::enqueue_material_image(pending_material_image &&img)
+{
+    std::lock_guard<std::mutex> lk(pending_images_lock);
+    pending_images.push_back(std::move(img));
+}
+
+GLuint gorc::client_renderer_object_factory::create_material_texture(bool generate_mipmaps,
+                                                                     size_t level_count)
 {
     GLuint texture_id;
     glGenTextures(1, &texture_id);
 
     glBindTexture(GL_TEXTURE_2D, texture_id);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+    if(generate_mipmaps) {
+        glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+    }
+    else {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(level_count - 1));
+    }
+
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-    GLfloat largest_supported_anisotropy;
-    glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &largest_supported_anisotropy);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, largest_supported_anisotropy);
+    if(max_anisotropy.has_value()) {
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, max_anisotropy.get_value());
+    }
 
+    return texture_id;
+}
+
+void gorc::client_renderer_object_factory::upload_material_level(int level,
+                                                                 grid<color_rgba8> const &img,
+                                                                 char const *pixels)
+{
     glTexImage2D(GL_TEXTURE_2D,
-                 /* level */ 0,
+                 level,
                  GL_RGBA,
                  static_cast<GLsizei>(get<0>(img.size)),
                  static_cast<GLsizei>(get<1>(img.size)),
                  /* border */ 0,
                  GL_RGBA,
                  GL_UNSIGNED_BYTE,
-                 reinterpret_cast<char const *>(img.data()));
+                 pixels);
+}
+
+void gorc::client_renderer_object_factory::upload_material_image(pending_material_image const &img,
+                                                                 maybe<size_t> staging_offset)
+{
+    GLuint texture_id = create_material_texture(img.generate_mipmaps, img.levels.size());
+
+    if(staging_offset.has_value()) {
+        // Pixel pointers are offsets into the staging buffer
+        size_t offset = staging_offset.get_value();
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging_buffer);
+        for(size_t i = 0; i < img.levels.size(); ++i) {
+            auto const &level = img.levels[i];
+            upload_material_level(static_cast<int>(i),
+                                  level,
+                                  reinterpret_cast<char const *>(offset));
+            offset += volume(level.size) * sizeof(color_rgba8);
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    else {
+        for(size_t i = 0; i < img.levels.size(); ++i) {
+            auto const &level = img.levels[i];
+            upload_material_level(static_cast<int>(i),
+                                  level,
+                                  reinterpret_cast<char const *>(level.data()));
+        }
+    }
+
+    GLuint &slot = get_material_texture_slot(img.id, img.cel, img.channel);
+    if(slot != 0) {
+        glDeleteTextures(1, &slot);
+    }
+
+    slot = texture_id;
+}
 
-    material_images.emplace(std::make_tuple(id, cel, channel), texture_id);
+GLuint &gorc::client_renderer_object_factory::get_material_texture_slot(material_id id,
+                                                                        int cel,
+                                                                        int channel)
+{
+    size_t material_index = static_cast<size_t>(static_cast<int>(id));
+    if(material_index >= material_textures.size()) {
+        material_textures.resize(material_index + 1);
+    }
+
+    auto &textures = material_textures[material_index];
+    size_t texture_index = static_cast<size_t>(cel * material_channel_count + channel);
+    if(texture_index >= textures.size()) {
+        textures.resize(texture_index + 1, 0);
+    }
+
+    return textures[texture_index];
+}
+
+void gorc::client_renderer_object_factory::set_material_image(material_id id,
+                                                              int cel,
+                                                              int channel,
+                                                              grid<color_rgba8> const &img)
+{
+    std::vector<grid<color_rgba8>> levels;
+    levels.push_back(img);
+
+    enqueue_material_image(pending_material_image(id,
+                                                  cel,
+                                                  channel,
+                                                  /* generate mipmaps */ true,
+                                                  std::move(levels)));
+}
+
+void gorc::client_renderer_object_factory::set_material_mipmaps(
+        material_id id,
+        int cel,
+        int channel,
+        std::vector<grid<color_rgba8>> const &levels)
+{
+    enqueue_material_image(pending_material_image(id,
+                                                  cel,
+                                                  channel,
+                                                  /* generate mipmaps */ false,
+                                                  levels));
+}
+
+void gorc::client_renderer_object_factory::upload_pending_images()
+{
+    PROFILE_ZONE("texture upload");
+
+    // Take images from the front of the queue until the budget is spent.
+    // A single image larger than the budget is still uploaded.
+    std::list<pending_material_image> batch;
+    {
+        std::lock_guard<std::mutex> lk(pending_images_lock);
+
+        size_t batch_bytes = 0;
+        auto batch_end = pending_images.begin();
+        while(batch_end != pending_images.end() &&
+              (batch_bytes == 0 || batch_bytes + batch_end->byte_size <= upload_bytes_per_frame)) {
+            batch_bytes += batch_end->byte_size;
+            ++batch_end;
+        }
+
+        batch.splice(batch.end(), pending_images, pending_images.begin(), batch_end);
+    }
+
+    if(batch.empty()) {
+        return;
+    }
+
+    initialize_gl();
+
+    if(!staging_memory) {
+        for(auto const &img : batch) {
+            upload_material_image(img, nothing);
+        }
+
+        return;
+    }
+
+    // Wait for the previous batch to be consumed before overwriting it.
+    // Batches are a frame apart, so this rarely blocks.
+    if(staging_fence) {
+        while(glClientWaitSync(staging_fence,
+                               GL_SYNC_FLUSH_COMMANDS_BIT,
+                               /* 1 second */ 1000000000) == GL_TIMEOUT_EXPIRED) {
+            // Keep waiting
+        }
+
+        glDeleteSync(staging_fence);
+        staging_fence = nullptr;
+    }
+
+    size_t staging_offset = 0;
+    for(auto const &img : batch) {
+        if(upload_bytes_per_frame - staging_offset < img.byte_size) {
+            upload_material_image(img, nothing);
+            continue;
+        }
+
+        size_t offset = staging_offset;
+        for(auto const &level : img.levels) {
+            size_t level_bytes = volume(level.size) * sizeof(color_rgba8);
+            std::memcpy(staging_memory + offset, level.data(), level_bytes);
+            offset += level_bytes;
+        }
+
+        upload_material_image(img, staging_offset);
+        staging_offset = offset;
+    }
+
+    staging_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 }
 
 GLuint gorc::client_renderer_object_factory::get_material_image(material_id id,
                                                                 int cel,
                                                                 int channel)
 {
-    return material_images.at(std::make_tuple(id, cel, channel));
+    GLuint &slot = get_material_texture_slot(id, cel, channel);
+    if(slot != 0) {
+        return slot;
+    }
+
+    // The image may still be queued. Upload it now rather than drawing
+    // without it.
+    std::list<pending_material_image> found;
+    {
+        std::lock_guard<std::mutex> lk(pending_images_lock);
+        for(auto it = pending_images.begin(); it != pending_images.end(); ++it) {
+            if(it->id == id && it->cel == cel && it->channel == channel) {
+                found.splice(found.end(), pending_images, it);
+                break;
+            }
+        }
+    }
+
+    if(found.empty()) {
+        LOG_FATAL(format("material %d cel %d channel %d has no image") %
+                  static_cast<int>(id) %
+                  cel %
+                  channel);
+    }
+
+    initialize_gl();
+    upload_material_image(found.front(), nothing);
+
+    return slot;
 }
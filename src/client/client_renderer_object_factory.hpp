@@ -1,15 +1,60 @@
 #pragma once
 
 #include "jk/content/renderer_object_factory.hpp"
+#include "utility/maybe.hpp"
 #include <GL/glew.h>
-#include <tuple>
-#include <map>
+#include <list>
+#include <mutex>
+#include <vector>
 
 namespace gorc {
 
+    // Material images are queued when they are set, and uploaded in batches
+    // at the start of each frame. Queuing is safe from any thread; all other
+    // members must be called from the thread that owns the GL context.
     class client_renderer_object_factory : public renderer_object_factory {
     private:
-        std::map<std::tuple<material_id, int, int>, GLuint> material_images;
+        static constexpr int material_channel_count = 2;
+        static constexpr size_t upload_bytes_per_frame = 8 * 1024 * 1024;
+
+        class pending_material_image {
+        public:
+            material_id id;
+            int cel;
+            int channel;
+            bool generate_mipmaps;
+            std::vector<grid<color_rgba8>> levels;
+            size_t byte_size;
+
+            pending_material_image(material_id id,
+                                   int cel,
+                                   int channel,
+                                   bool generate_mipmaps,
+                                   std::vector<grid<color_rgba8>> levels);
+        };
+
+        std::mutex pending_images_lock;
+        std::list<pending_material_image> pending_images;
+
+        // Texture ids indexed by material, then by cel and channel.
+        // Zero when the image has not been uploaded.
+        std::vector<std::vector<GLuint>> material_textures;
+
+        // GL state, initialized on first upload
+        bool gl_initialized = false;
+        maybe<GLfloat> max_anisotropy;
+        GLuint staging_buffer = 0;
+        char *staging_memory = nullptr;
+        GLsync staging_fence = nullptr;
+
+        void initialize_gl();
+        void enqueue_material_image(pending_material_image &&img);
+
+        GLuint create_material_texture(bool generate_mipmaps, size_t level_count);
+        void upload_material_level(int level, grid<color_rgba8> const &img, char const *pixels);
+        void upload_material_image(pending_material_image const &img, maybe<size_t> staging_offset);
+
+        GLuint &get_material_texture_slot(material_id, int cel, int channel);
 
     public:
         ~client_renderer_object_factory();
@@ -19,6 +64,15 @@ namespace gorc {
                                         int channel,
                                         grid<color_rgba8> const &img) override;
 
+        virtual void set_material_mipmaps(material_id,
+                                          int cel,
+                                          int channel,
+                                          std::vector<grid<color_rgba8>> const &levels) override;
+
+        // Uploads queued images, up to the per-frame byte budget.
+        void upload_pending_images();
+
+        // Images still in the queue are uploaded immediately.
         virtual GLuint get_material_image(material_id, int cel, int channel);
     };
 
@@ -1,8 +1,10 @@
 #include "action_presenter.hpp"
 #include "client/application.hpp"
 #include "game/world/level_presenter.hpp"
-#include "game/world/inventory/inventory_presenter.hpp"
-#include "game/world/camera/camera_presenter.hpp"
+#include "game/world/replay/input_command.hpp"
+
+using gorc::game::world::replay::input_command;
+using gorc::game::world::replay::input_command_type;
 
 gorc::client::action::action_presenter::action_presenter(application& app)
     : app(app), input_adapter(*this), key_dispatcher(*this), click_dispatcher(*this) {
@@ -33,8 +35,8 @@ void gorc::client::action::action_presenter::handle_mouse_input(const gorc::time
 
         auto CameraRotation = -CursorPos * 20000.0 * time.elapsed_as_seconds();
 
-        app.components.current_level_presenter->yaw_camera(get<0>(CameraRotation));
-        app.components.current_level_presenter->pitch_camera(get<1>(CameraRotation));
+        submit_input(input_command(input_command_type::yaw, static_cast<float>(get<0>(CameraRotation))));
+        submit_input(input_command(input_command_type::pitch, static_cast<float>(get<1>(CameraRotation))));
     }
 
     click_dispatcher.handle_mouse_input(time);
@@ -67,118 +69,108 @@ void gorc::client::action::action_presenter::handle_keyboard_input(const gorc::t
     }
 
     if(sf::Keyboard::isKeyPressed(sf::Keyboard::F)) {
-        app.components.current_level_presenter->fly();
+        submit_input(input_command(input_command_type::fly));
     }
 
-    app.components.current_level_presenter->translate_camera(Translate);
+    submit_input(input_command(input_command_type::move, Translate));
 
     key_dispatcher.handle_keyboard_input(time);
 }
 
 void gorc::client::action::action_presenter::on_mouse_button_down(const gorc::time&, const vector<2, int>&, sf::Mouse::Button b) {
-    thing_id current_player(app.components.current_level_presenter->get_local_player_thing());
-
     if(b == sf::Mouse::Left) {
-        app.components.current_level_presenter->inventory_presenter->on_weapon_fire_pressed(current_player, 0);
+        submit_input(input_command(input_command_type::fire, 0));
     }
     else if(b == sf::Mouse::Right) {
-        app.components.current_level_presenter->inventory_presenter->on_weapon_fire_pressed(current_player, 1);
+        submit_input(input_command(input_command_type::fire, 1));
     }
 }
 
 void gorc::client::action::action_presenter::on_mouse_button_up(const gorc::time&, const vector<2, int>&, sf::Mouse::Button b) {
-    thing_id current_player(app.components.current_level_presenter->get_local_player_thing());
-
     if(b == sf::Mouse::Left) {
-        app.components.current_level_presenter->inventory_presenter->on_weapon_fire_released(current_player, 0);
+        submit_input(input_command(input_command_type::release, 0));
     }
     else if(b == sf::Mouse::Right) {
-        app.components.current_level_presenter->inventory_presenter->on_weapon_fire_released(current_player, 1);
+        submit_input(input_command(input_command_type::release, 1));
     }
 }
 
 void gorc::client::action::action_presenter::on_keyboard_key_down(const gorc::time&, sf::Keyboard::Key k, bool, bool, bool) {
-    thing_id current_player(app.components.current_level_presenter->get_local_player_thing());
-
     switch(k) {
     case sf::Keyboard::Escape:
         app.eventbus.fire_event(events::exit());
         break;
 
     case sf::Keyboard::R:
-        app.components.current_level_presenter->respawn();
+        submit_input(input_command(input_command_type::respawn));
         break;
 
     case sf::Keyboard::E:
-        app.components.current_level_presenter->activate();
+        submit_input(input_command(input_command_type::activate));
         break;
 
     case sf::Keyboard::Z:
-        app.components.current_level_presenter->damage();
+        submit_input(input_command(input_command_type::damage));
         break;
 
     case sf::Keyboard::F1:
-        app.components.current_level_presenter->camera_presenter->cycle_camera();
+        submit_input(input_command(input_command_type::cycle_camera));
         break;
 
     case sf::Keyboard::F2:
-        app.components.current_level_presenter->inventory_presenter->on_item_hotkey_pressed(current_player, 42);
+        submit_input(input_command(input_command_type::hotkey_pressed, 42));
         break;
 
     case sf::Keyboard::G:
-        // Give fieldlight batteries, bryar, strifle, xbow, repeater, and ammo.
-        for(int i = 1; i <= 15; ++i) {
-            auto bin_max = app.components.current_level_presenter->inventory_presenter->get_inv_max(current_player, i);
-            app.components.current_level_presenter->inventory_presenter->set_inv(current_player, i, bin_max);
-        }
+        submit_input(input_command(input_command_type::give_weapons));
         break;
 
     case sf::Keyboard::Space:
-        app.components.current_level_presenter->jump();
+        submit_input(input_command(input_command_type::jump));
         break;
 
     case sf::Keyboard::LControl:
-        app.components.current_level_presenter->crouch(true);
+        submit_input(input_command(input_command_type::crouch));
         break;
 
     case sf::Keyboard::Num1:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 1);
+        submit_input(input_command(input_command_type::select_weapon, 1));
         break;
 
     case sf::Keyboard::Num2:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 2);
+        submit_input(input_command(input_command_type::select_weapon, 2));
         break;
 
     case sf::Keyboard::Num3:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 3);
+        submit_input(input_command(input_command_type::select_weapon, 3));
         break;
 
     case sf::Keyboard::Num4:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 4);
+        submit_input(input_command(input_command_type::select_weapon, 4));
         break;
 
     case sf::Keyboard::Num5:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 5);
+        submit_input(input_command(input_command_type::select_weapon, 5));
         break;
 
     case sf::Keyboard::Num6:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 6);
+        submit_input(input_command(input_command_type::select_weapon, 6));
         break;
 
     case sf::Keyboard::Num7:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 7);
+        submit_input(input_command(input_command_type::select_weapon, 7));
         break;
 
     case sf::Keyboard::Num8:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 8);
+        submit_input(input_command(input_command_type::select_weapon, 8));
         break;
 
     case sf::Keyboard::Num9:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 9);
+        submit_input(input_command(input_command_type::select_weapon, 9));
         break;
 
     case sf::Keyboard::Num0:
-        app.components.current_level_presenter->inventory_presenter->select_weapon(current_player, 10);
+        submit_input(input_command(input_command_type::select_weapon, 10));
         break;
 
     default:
@@ -189,14 +181,18 @@ void gorc::client::action::action_presenter::on_keyboard_key_down(const gorc::ti
 void gorc::client::action::action_presenter::on_keyboard_key_up(const gorc::time&, sf::Keyboard::Key k, bool, bool, bool) {
     switch(k) {
     case sf::Keyboard::F2:
-        app.components.current_level_presenter->inventory_presenter->on_item_hotkey_released(thing_id(app.components.current_level_presenter->get_local_player_thing()), 42);
+        submit_input(input_command(input_command_type::hotkey_released, 42));
         break;
 
     case sf::Keyboard::LControl:
-        app.components.current_level_presenter->crouch(false);
+        submit_input(input_command(input_command_type::stand));
         break;
 
     default:
         break;
     }
 }
+
+void gorc::client::action::action_presenter::submit_input(const input_command& cmd) {
+    app.components.current_level_presenter->submit_input(cmd);
+}
@@ -6,6 +6,15 @@
 #include "libold/base/input/mouse_click_dispatcher.hpp"
 
 namespace gorc {
+
+namespace game {
+namespace world {
+namespace replay {
+class input_command;
+}
+}
+}
+
 namespace client {
 
 class application;
@@ -22,6 +31,8 @@ private:
 
     maybe<scoped_delegate> window_focus_delegate;
 
+    void submit_input(const game::world::replay::input_command& cmd);
+
 public:
     action_presenter(application& app);
 
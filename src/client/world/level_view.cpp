@@ -5,12 +5,15 @@
 #include "game/world/level_presenter.hpp"
 #include "client/application.hpp"
 #include "game/world/level_model.hpp"
+#include "game/world/render_snapshot.hpp"
+#include "game/world/replay/input_command.hpp"
 #include "game/world/keys/key_presenter.hpp"
 #include "libold/content/assets/model.hpp"
 #include "libold/content/assets/sprite.hpp"
 #include "libold/content/constants.hpp"
 #include "game/world/components/thing.hpp"
 #include "math/color.hpp"
+#include "profile/profiler.hpp"
 
 #include <SFML/System.hpp>
 #include <SFML/Window.hpp>
@@ -27,8 +30,59 @@ gorc::client::world::level_view::level_view(content_manager& contentmanager,
     return;
 }
 
+gorc::client::world::level_view::~level_view() {
+    return;
+}
+
+bool gorc::client::world::level_view::update_draw_state() {
+    if(interpolate) {
+        current_snapshot = currentModel->render_snapshots.latest();
+        if(!current_snapshot) {
+            // Nothing to draw until the first tick has been published.
+            return false;
+        }
+
+        draw_frame = &current_snapshot->current;
+        snapshot_alpha = current_snapshot->get_alpha(game::world::render_snapshot::clock::now());
+        draw_camera = current_snapshot->get_camera(snapshot_alpha);
+        return true;
+    }
+
+    if(!local_frame) {
+        local_frame = std::make_unique<game::world::render_frame>();
+    }
+
+    local_frame->capture(*currentModel);
+
+    current_snapshot = nullptr;
+    draw_frame = local_frame.get();
+    snapshot_alpha = 1.0f;
+    draw_camera = local_frame->camera;
+    return true;
+}
+
+gorc::vector<3> gorc::client::world::level_view::get_draw_position(const game::world::thing_render_state& thing,
+        thing_id tid) const {
+    if(!current_snapshot) {
+        return thing.position;
+    }
+
+    return current_snapshot->get_thing_position(tid, snapshot_alpha, thing.position);
+}
+
+gorc::quaternion<float> gorc::client::world::level_view::get_draw_orient(const game::world::thing_render_state& thing,
+        thing_id tid) const {
+    if(!current_snapshot) {
+        return thing.orient;
+    }
+
+    return current_snapshot->get_thing_orient(tid, snapshot_alpha, thing.orient);
+}
+
 void gorc::client::world::level_view::compute_visible_sectors(const box<2, int>&) {
-    const auto& cam = currentModel->camera_model.current_computed_state;
+    PROFILE_ZONE("visibility");
+
+    const auto& cam = draw_camera;
 
     std::array<double, 16> proj_matrix;
     std::array<double, 16> view_matrix;
@@ -56,18 +110,18 @@ void gorc::client::world::level_view::do_sector_vis(sector_id sec_num, const std
         const std::array<int, 4>& viewport, const box<2, double>& adj_bbox, const vector<3>& cam_pos, const vector<3>& cam_look) {
     sector_visited_scratch.emplace(sec_num);
 
-    const auto& sector = at_id(currentModel->sectors, sec_num);
+    const auto& lev = *currentModel->level;
+    const auto& sector = at_id(lev.sectors, sec_num);
     for(int i = 0; i < sector.surface_count; ++i) {
-        const auto& surface = currentModel->surfaces[sector.first_surface + i];
+        const auto& surface = lev.surfaces[sector.first_surface + i];
 
-        const vector<3>& surf_vx_pos = currentModel->level->vertices[std::get<0>(surface.vertices.front())];
+        const vector<3>& surf_vx_pos = lev.vertices[std::get<0>(surface.vertices.front())];
 
         if(surface.adjoin < 0 || sector_visited_scratch.count(surface.adjoined_sector) > 0) {
             continue;
         }
 
-        const auto& adjoin = currentModel->adjoins[surface.adjoin];
-        if(!(adjoin.flags & flags::adjoin_flag::Visible)) {
+        if(!(draw_frame->adjoin_flags[surface.adjoin] & flags::adjoin_flag::Visible)) {
             continue;
         }
 
@@ -84,7 +138,7 @@ void gorc::client::world::level_view::do_sector_vis(sector_id sec_num, const std
         bool failed = false;
         bool culled = true;
         for(const auto& vx : surface.vertices) {
-            auto vx_pos = currentModel->level->vertices[std::get<0>(vx)];
+            auto vx_pos = lev.vertices[std::get<0>(vx)];
 
             if(dot(cam_look, vx_pos - cam_pos) < 0.0f) {
                 // Vertex behind camera.
@@ -128,20 +182,23 @@ void gorc::client::world::level_view::do_sector_vis(sector_id sec_num, const std
 }
 
 void gorc::client::world::level_view::record_visible_special_surfaces() {
+    const auto& lev = *currentModel->level;
+
     for(auto sec_num : sector_vis_scratch) {
-        const content::assets::level_sector& sector = at_id(currentModel->sectors, sec_num);
+        const content::assets::level_sector& sector = at_id(lev.sectors, sec_num);
 
         for(int i = sector.first_surface; i < sector.first_surface + sector.surface_count; ++i) {
-            const auto& surface = currentModel->surfaces[i];
+            const auto& surface = lev.surfaces[i];
+            const auto& surface_state = draw_frame->surfaces[i];
 
-            if(surface.geometry_mode == flags::geometry_mode::not_drawn) {
+            if(surface_state.geometry_mode == flags::geometry_mode::not_drawn) {
                 continue;
             }
 
-            if(surface.adjoin < 0 && (surface.flags & flags::surface_flag::HorizonSky)) {
+            if(surface.adjoin < 0 && (surface_state.flags & flags::surface_flag::HorizonSky)) {
                 horizon_sky_surfaces_scratch.push_back(std::make_tuple(sec_num, surface_id(i)));
             }
-            else if(surface.adjoin < 0 && (surface.flags & flags::surface_flag::CeilingSky)) {
+            else if(surface.adjoin < 0 && (surface_state.flags & flags::surface_flag::CeilingSky)) {
                 ceiling_sky_surfaces_scratch.push_back(std::make_tuple(sec_num, surface_id(i)));
             }
             else if(surface.adjoin >= 0) {
@@ -150,13 +207,13 @@ void gorc::client::world::level_view::record_visible_special_surfaces() {
         }
     }
 
-    const auto& cam_pos = currentModel->camera_model.current_computed_state.position;
+    const auto& cam_pos = draw_camera.position;
 
     // Compute distances to translucent surfaces
     for(auto& surf_tuple : translucent_surfaces_scratch) {
         surface_id surf_id = std::get<1>(surf_tuple);
-        const auto& surf = at_id(currentModel->surfaces, surf_id);
-        auto vx_pos = currentModel->level->vertices[std::get<0>(surf.vertices.front())];
+        const auto& surf = at_id(lev.surfaces, surf_id);
+        auto vx_pos = lev.vertices[std::get<0>(surf.vertices.front())];
         std::get<2>(surf_tuple) = dot(surf.normal, cam_pos - vx_pos);
 
         // TODO: Currently uses distance to plane. Compute actual distance to polygon.
@@ -170,13 +227,16 @@ void gorc::client::world::level_view::record_visible_special_surfaces() {
 }
 
 void gorc::client::world::level_view::record_visible_things() {
-    for(auto& thing_pair : currentModel->ecs.all_components<gorc::game::world::components::thing>()) {
-        if(sector_vis_scratch.find(thing_pair.second->sector) != sector_vis_scratch.end()) {
-            visible_thing_scratch.emplace_back(thing_pair.first, length(thing_pair.second->position - currentModel->camera_model.current_computed_state.position));
+    for(size_t i = 0; i < draw_frame->things.size(); ++i) {
+        const auto& thing = draw_frame->things[i];
+        if(thing.live && sector_vis_scratch.find(thing.sector) != sector_vis_scratch.end()) {
+            thing_id tid(static_cast<int>(i));
+            visible_thing_scratch.emplace_back(tid, length(get_draw_position(thing, tid) - draw_camera.position));
 
-            if(!(thing_pair.second->flags & flags::thing_flag::Sighted)) {
+            if(!(thing.flags & flags::thing_flag::Sighted)) {
                 // thing has been sighted for first time. Fire sighted event.
-                currentPresenter->thing_sighted(thing_pair.first);
+                currentPresenter->submit_input(game::world::replay::input_command(
+                        game::world::replay::input_command_type::sighted, static_cast<int>(i)));
             }
         }
     }
@@ -189,63 +249,73 @@ void gorc::client::world::level_view::record_visible_things() {
 }
 
 void gorc::client::world::level_view::draw_visible_diffuse_surfaces() {
+    PROFILE_ZONE("diffuse surfaces");
+
+    const auto& lev = *currentModel->level;
+
     glDepthMask(GL_TRUE);
     for(auto sec_num : sector_vis_scratch) {
-        const content::assets::level_sector& sector = at_id(currentModel->sectors, sec_num);
+        const content::assets::level_sector& sector = at_id(lev.sectors, sec_num);
 
         for(int i = sector.first_surface; i < sector.first_surface + sector.surface_count; ++i) {
-            const auto& surface = currentModel->surfaces[i];
+            const auto& surface = draw_frame->surfaces[i];
 
             if(surface.geometry_mode == flags::geometry_mode::not_drawn
-                    || surface.adjoin >= 0
+                    || lev.surfaces[i].adjoin >= 0
                     || (surface.flags & flags::surface_flag::HorizonSky)
                     || (surface.flags & flags::surface_flag::CeilingSky)) {
                 continue;
             }
 
-            draw_surface(surface_id(i), sector, 1.0f);
+            draw_surface(surface_id(i), sec_num, 1.0f);
         }
     }
 }
 
 void gorc::client::world::level_view::draw_visible_sky_surfaces(const box<2, int>& view_size, const color_rgb& sector_tint) {
+    PROFILE_ZONE("sky surfaces");
+
+    const auto& header = currentModel->level->header;
+
     glDepthMask(GL_TRUE);
 
     if(!horizon_sky_surfaces_scratch.empty()) {
         set_current_shader(horizonShader, sector_tint,
-                currentModel->header.horizon_sky_offset, currentModel->header.horizon_pixels_per_rev,
-                currentModel->header.horizon_distance, view_size, currentModel->camera_model.current_computed_state.look);
+                draw_frame->horizon_sky_offset, header.horizon_pixels_per_rev,
+                header.horizon_distance, view_size, draw_camera.look);
 
         for(auto surf_tuple : horizon_sky_surfaces_scratch) {
-            draw_surface(std::get<1>(surf_tuple), at_id(currentModel->sectors, std::get<0>(surf_tuple)), 1.0f);
+            draw_surface(std::get<1>(surf_tuple), std::get<0>(surf_tuple), 1.0f);
         }
     }
 
     if(!ceiling_sky_surfaces_scratch.empty()) {
         set_current_shader(ceilingShader, sector_tint,
-                currentModel->header.ceiling_sky_offset, currentModel->header.ceiling_sky_z);
+                draw_frame->ceiling_sky_offset, header.ceiling_sky_z);
 
         for(auto surf_tuple : ceiling_sky_surfaces_scratch) {
-            draw_surface(std::get<1>(surf_tuple), at_id(currentModel->sectors, std::get<0>(surf_tuple)), 1.0f);
+            draw_surface(std::get<1>(surf_tuple), std::get<0>(surf_tuple), 1.0f);
         }
     }
 }
 
 void gorc::client::world::level_view::draw_visible_translucent_surfaces_and_things() {
+    PROFILE_ZONE("translucent surfaces");
+
     auto thing_it = visible_thing_scratch.begin();
     auto surf_it = translucent_surfaces_scratch.begin();
     while(thing_it != visible_thing_scratch.end() && surf_it != translucent_surfaces_scratch.end()) {
         if(std::get<1>(*thing_it) <= std::get<2>(*surf_it)) {
             glDepthMask(GL_TRUE);
             glDisable(GL_CULL_FACE);
-            draw_thing(currentModel->get_thing(std::get<0>(*thing_it)), std::get<0>(*thing_it));
+            draw_thing(*draw_frame->get_thing(std::get<0>(*thing_it)), std::get<0>(*thing_it));
             ++thing_it;
         }
         else {
             glDepthMask(GL_FALSE);
             glEnable(GL_CULL_FACE);
-            draw_surface(std::get<1>(*surf_it), at_id(currentModel->sectors, std::get<0>(*surf_it)),
-                    (at_id(currentModel->surfaces, std::get<1>(*surf_it)).face_type_flags & flags::face_flag::Translucent) ? 0.5f : 1.0f);
+            draw_surface(std::get<1>(*surf_it), std::get<0>(*surf_it),
+                    (at_id(draw_frame->surfaces, std::get<1>(*surf_it)).face_type_flags & flags::face_flag::Translucent) ? 0.5f : 1.0f);
             ++surf_it;
         }
     }
@@ -253,22 +323,27 @@ void gorc::client::world::level_view::draw_visible_translucent_surfaces_and_thin
     glDepthMask(GL_TRUE);
     glDisable(GL_CULL_FACE);
     while(thing_it != visible_thing_scratch.end()) {
-        draw_thing(currentModel->get_thing(std::get<0>(*thing_it)), std::get<0>(*thing_it));
+        draw_thing(*draw_frame->get_thing(std::get<0>(*thing_it)), std::get<0>(*thing_it));
         ++thing_it;
     }
 
     glDepthMask(GL_FALSE);
     glEnable(GL_CULL_FACE);
     while(surf_it != translucent_surfaces_scratch.end()) {
-        draw_surface(std::get<1>(*surf_it), at_id(currentModel->sectors, std::get<0>(*surf_it)),
-                (at_id(currentModel->surfaces, std::get<1>(*surf_it)).face_type_flags & flags::face_flag::Translucent) ? 0.5f : 1.0f);
+        draw_surface(std::get<1>(*surf_it), std::get<0>(*surf_it),
+                (at_id(draw_frame->surfaces, std::get<1>(*surf_it)).face_type_flags & flags::face_flag::Translucent) ? 0.5f : 1.0f);
         ++surf_it;
     }
 }
 
 void gorc::client::world::level_view::draw(const gorc::time&, const box<2, int>& view_size, graphics::render_target&) {
-    if(currentModel) {
-        const auto& cam = currentModel->camera_model.current_computed_state;
+    PROFILE_ZONE("level draw");
+
+    // Upload images from materials loaded since the last frame
+    renderer_object_factory.upload_pending_images();
+
+    if(currentModel && update_draw_state()) {
+        const auto& cam = draw_camera;
 
         glDisable(GL_STENCIL_TEST);
         glDisable(GL_ALPHA_TEST);
@@ -305,8 +380,13 @@ void gorc::client::world::level_view::draw(const gorc::time&, const box<2, int>&
         record_visible_things();
 
         // Prepare for rendering ordinary surfaces
-        auto sector_tint = at_id(currentModel->sectors, cam.containing_sector).tint;
-        sector_tint = (sector_tint * length(sector_tint)) + (currentModel->dynamic_tint * (1.0f - length(sector_tint)));
+        auto sector_tint = at_id(draw_frame->sectors, cam.containing_sector).tint;
+        auto dynamic_tint = draw_frame->dynamic_tint;
+        if(current_snapshot) {
+            dynamic_tint = lerp(current_snapshot->previous.dynamic_tint, current_snapshot->current.dynamic_tint, snapshot_alpha);
+        }
+
+        sector_tint = (sector_tint * length(sector_tint)) + (dynamic_tint * (1.0f - length(sector_tint)));
 
         set_current_shader(surfaceShader, sector_tint);
 
@@ -332,15 +412,16 @@ void gorc::client::world::level_view::draw(const gorc::time&, const box<2, int>&
         glDepthMask(GL_TRUE);
 
         for(const auto& light_thing : visible_thing_scratch) {
-            const auto& thing = currentModel->get_thing(std::get<0>(light_thing));
-
-            float light = thing.light + ((thing.actor_flags & flags::actor_flag::HasFieldlight) ? thing.light_intensity : 0.0f);
+            const auto& thing = *draw_frame->get_thing(std::get<0>(light_thing));
 
+            float light = thing.light;
             if(light <= 0.0f) {
                 continue;
             }
 
-            set_current_shader(lightShader, thing.position + thing.orient.transform(thing.light_offset),
+            set_current_shader(lightShader,
+                    get_draw_position(thing, std::get<0>(light_thing)) +
+                    get_draw_orient(thing, std::get<0>(light_thing)).transform(thing.light_offset),
                     cam.position, light, light);
 
             draw_visible_diffuse_surfaces();
@@ -360,15 +441,16 @@ void gorc::client::world::level_view::draw(const gorc::time&, const box<2, int>&
         glDepthMask(GL_TRUE);
 
         for(const auto& light_thing : visible_thing_scratch) {
-            const auto& thing = currentModel->get_thing(std::get<0>(light_thing));
-
-            float light = thing.light + ((thing.actor_flags & flags::actor_flag::HasFieldlight) ? thing.light_intensity : 0.0f);
+            const auto& thing = *draw_frame->get_thing(std::get<0>(light_thing));
 
+            float light = thing.light;
             if(light <= 0.0f) {
                 continue;
             }
 
-            set_current_shader(lightShader, thing.position + thing.orient.transform(thing.light_offset),
+            set_current_shader(lightShader,
+                    get_draw_position(thing, std::get<0>(light_thing)) +
+                    get_draw_orient(thing, std::get<0>(light_thing)).transform(thing.light_offset),
                     cam.position, light, light);
 
             draw_pov_model();
@@ -380,12 +462,20 @@ void gorc::client::world::level_view::draw(const gorc::time&, const box<2, int>&
 }
 
 void gorc::client::world::level_view::draw_pov_model() {
+    PROFILE_ZONE("pov model");
+
     // Draw POV model.
-    const auto& cam = currentModel->camera_model.current_computed_state;
+    const auto& cam = draw_camera;
+
+    auto player_id = draw_frame->local_player;
+    const auto* player = draw_frame->get_thing(player_id);
+    if(!player) {
+        return;
+    }
 
     maybe_if(cam.pov_model, [&](auto pov_model) {
-        const auto& thing = currentModel->get_thing(currentPresenter->get_local_player_thing());
-        const auto& current_sector = at_id(currentModel->sectors, thing.sector);
+        const auto& thing = *player;
+        const auto& current_sector = at_id(draw_frame->sectors, thing.sector);
         auto sector_color = make_color(1.0f, 1.0f, 1.0f);
         maybe_if(current_sector.cmp, [&](auto cmp) {
             sector_color = cmp->tint;
@@ -402,23 +492,30 @@ void gorc::client::world::level_view::draw_pov_model() {
         pov_mesh_node_visitor v(renderer_object_factory, lit_sector_color, *this, saber_mesh_node,
                 thing.saber_drawn_length, thing.saber_base_rad, thing.saber_tip_rad,
                 thing.saber_side_mat, thing.saber_tip_mat);
-        auto pov_orient = thing.orient * make_rotation(make_vector(1.0f, 0.0f, 0.0f), thing.head_pitch);
+        auto pov_orient = get_draw_orient(thing, player_id) * make_rotation(make_vector(1.0f, 0.0f, 0.0f), thing.head_pitch);
         auto pov_model_offset = pov_orient * make_euler(cam.pov_model_offset);
-        currentPresenter->key_presenter->visit_mesh_hierarchy(v, pov_model, thing.position,
-                pov_model_offset, currentPresenter->get_local_player_thing(),
-                /* is pov mesh */ true);
+
+        maybe<game::world::keys::key_mix const *> mix;
+        if(draw_frame->has_pov_mix) {
+            mix = &draw_frame->pov_mix;
+        }
+
+        currentPresenter->key_presenter->visit_mesh_hierarchy(v, pov_model, get_draw_position(thing, player_id),
+                pov_model_offset, mix);
     });
 }
 
-void gorc::client::world::level_view::draw_surface(surface_id surf_num, const content::assets::level_sector& sector, float alpha) {
-    const auto& surface = at_id(currentModel->surfaces, surf_num);
+void gorc::client::world::level_view::draw_surface(surface_id surf_num, sector_id sec_num, float alpha) {
     const auto& lev = *currentModel->level;
+    const auto& surface = at_id(lev.surfaces, surf_num);
+    const auto& surface_state = at_id(draw_frame->surfaces, surf_num);
+    const auto& sector = at_id(draw_frame->sectors, sec_num);
 
-    if(surface.material >= 0) {
-        const auto& material_entry = currentModel->level->materials[surface.material];
+    if(surface_state.material >= 0) {
+        const auto& material_entry = lev.materials[surface_state.material];
         const auto& material = std::get<0>(material_entry).get_value();
 
-        int surfaceCelNumber = surface.cel_number;
+        int surfaceCelNumber = surface_state.cel_number;
         int actualSurfaceCelNumber;
         if(surfaceCelNumber >= 0) {
             actualSurfaceCelNumber = surfaceCelNumber % static_cast<int>(material->cels.size());
@@ -448,20 +545,25 @@ void gorc::client::world::level_view::draw_surface(surface_id surf_num, const co
             sector_tint = cmp->tint;
         });
 
+        vector<2> texture_offset = surface_state.texture_offset;
+        if(current_snapshot) {
+            texture_offset = current_snapshot->get_surface_texture_offset(surf_num, snapshot_alpha, texture_offset);
+        }
+
         vector<3> first_geo = lev.vertices[std::get<0>(surface.vertices[0])];
-        vector<2> first_tex = lev.texture_vertices[std::get<1>(surface.vertices[0])] + surface.texture_offset;
-        float first_intensity = std::get<2>(surface.vertices[0]) + sector.extra_light + surface.extra_light;
+        vector<2> first_tex = lev.texture_vertices[std::get<1>(surface.vertices[0])] + texture_offset;
+        float first_intensity = std::get<2>(surface.vertices[0]) + sector.extra_light + surface_state.extra_light;
         auto first_color = extend_vector<4>(sector_tint * first_intensity, alpha);
 
         for(size_t i = 2; i < surface.vertices.size(); ++i) {
             vector<3> second_geo = lev.vertices[std::get<0>(surface.vertices[i - 1])];
-            vector<2> second_tex = lev.texture_vertices[std::get<1>(surface.vertices[i - 1])] + surface.texture_offset;
-            float second_intensity = std::get<2>(surface.vertices[i - 1]) + sector.extra_light + surface.extra_light;
+            vector<2> second_tex = lev.texture_vertices[std::get<1>(surface.vertices[i - 1])] + texture_offset;
+            float second_intensity = std::get<2>(surface.vertices[i - 1]) + sector.extra_light + surface_state.extra_light;
             auto second_color = extend_vector<4>(sector_tint * second_intensity, alpha);
 
             vector<3> third_geo = lev.vertices[std::get<0>(surface.vertices[i])];
-            vector<2> third_tex = lev.texture_vertices[std::get<1>(surface.vertices[i])] + surface.texture_offset;
-            float third_intensity = std::get<2>(surface.vertices[i]) + sector.extra_light + surface.extra_light;
+            vector<2> third_tex = lev.texture_vertices[std::get<1>(surface.vertices[i])] + texture_offset;
+            float third_intensity = std::get<2>(surface.vertices[i]) + sector.extra_light + surface_state.extra_light;
             auto third_color = extend_vector<4>(sector_tint * third_intensity, alpha);
 
             apply(glNormal3f, surface.normal);
@@ -504,7 +606,7 @@ void gorc::client::world::level_view::draw_saber(asset_ref<material> saber_tip,
     auto blade_dir = normalize(vmat.transform_normal(make_vector(0.0f, 1.0f, 0.0f)));
     auto blade_face = normalize(vmat.transform_normal(make_vector(0.0f, 0.0f, 1.0f)));
     auto blade_opp = cross(blade_dir, blade_face);
-    auto cam_pos = currentModel->camera_model.current_computed_state.position;
+    auto cam_pos = draw_camera.position;
 
     // Project cam_pos into saber hilt plane
     cam_pos = cam_pos - hilt_pos;
@@ -671,28 +773,29 @@ void gorc::client::world::level_view::draw_sprite(const vector<3>& pos, asset_re
     update_shader_model_matrix();
 }
 
-void gorc::client::world::level_view::draw_sprite(const game::world::components::thing& thing, asset_ref<content::assets::sprite> sprite, float sector_light) {
+void gorc::client::world::level_view::draw_sprite(const game::world::thing_render_state& thing, const vector<3>& pos,
+        asset_ref<content::assets::sprite> sprite, float sector_light) {
     // TODO: Currently plays animation over duration of timer. Behavior should be verified.
     int current_frame = 0;
     if(thing.timer > 0.0f) {
         current_frame = static_cast<int>(static_cast<int>(std::floor(static_cast<float>(sprite->mat->cels.size()) * thing.time_alive / thing.timer)) % sprite->mat->cels.size());
     }
 
-    const auto& cam = currentModel->camera_model.current_computed_state;
+    const auto& cam = draw_camera;
     vector<3> offset = cross(cam.look, cam.up) * get<0>(sprite->offset) +
             cam.look * get<1>(sprite->offset) +
             cam.up * get<2>(sprite->offset);
 
-    draw_sprite(thing.position, sprite->mat, current_frame, sprite->width, sprite->height, sprite->geometry_mode, sprite->light_mode,
+    draw_sprite(pos, sprite->mat, current_frame, sprite->width, sprite->height, sprite->geometry_mode, sprite->light_mode,
             sprite->extra_light, offset, sector_light);
 }
 
-void gorc::client::world::level_view::draw_thing(const game::world::components::thing& thing, thing_id tid) {
-    if((thing.flags & flags::thing_flag::Invisible) || tid == currentModel->camera_model.current_computed_state.focus_not_drawn_thing) {
+void gorc::client::world::level_view::draw_thing(const game::world::thing_render_state& thing, thing_id tid) {
+    if((thing.flags & flags::thing_flag::Invisible) || tid == draw_camera.focus_not_drawn_thing) {
         return;
     }
 
-    const auto& current_sector = at_id(currentModel->sectors, thing.sector);
+    const auto& current_sector = at_id(draw_frame->sectors, thing.sector);
     auto sector_color = make_color(1.0f, 1.0f, 1.0f);
     maybe_if(current_sector.cmp, [&](auto cmp) {
         sector_color = cmp->tint;
@@ -718,11 +821,16 @@ void gorc::client::world::level_view::draw_thing(const game::world::components::
         thing_mesh_node_visitor v(renderer_object_factory, lit_sector_color, *this, weapon_mesh_node, saber_mesh_node_a, saber_mesh_node_b,
                 thing.weapon_mesh, thing.saber_drawn_length, thing.saber_base_rad, thing.saber_tip_rad,
                 thing.saber_side_mat, thing.saber_tip_mat);
-        currentPresenter->key_presenter->visit_mesh_hierarchy(v, model, thing.position, thing.orient, tid, /* is pov mesh */ false,
-                thing.pup, thing.head_pitch);
+        maybe<game::world::keys::key_mix const *> mix;
+        if(thing.has_mix) {
+            mix = &thing.mix;
+        }
+
+        currentPresenter->key_presenter->visit_mesh_hierarchy(v, model, get_draw_position(thing, tid), get_draw_orient(thing, tid),
+                mix, thing.pup, thing.head_pitch);
     });
 
     maybe_if(thing.spr, [&](auto spr) {
-        this->draw_sprite(thing, spr, sector_light);
+        this->draw_sprite(thing, this->get_draw_position(thing, tid), spr, sector_light);
     });
 }
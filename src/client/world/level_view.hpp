@@ -10,6 +10,9 @@
 #include "libold/content/flags/light_mode.hpp"
 #include "level_shader.hpp"
 #include "client/client_renderer_object_factory.hpp"
+#include "math/quaternion.hpp"
+#include "game/world/camera/current_camera_state.hpp"
+#include <memory>
 #include <stack>
 #include <unordered_set>
 
@@ -36,10 +39,9 @@ class level_state;
 namespace world {
 class level_presenter;
 class level_model;
-
-namespace components {
-class thing;
-}
+class render_snapshot;
+class render_frame;
+class thing_render_state;
 
 }
 
@@ -74,6 +76,21 @@ private:
 
     game::world::level_presenter* currentPresenter = nullptr;
     game::world::level_model* currentModel = nullptr;
+
+    // When set, the view draws from snapshots published by the simulation
+    // thread, between the two most recent ticks. Otherwise it copies the
+    // level itself before drawing. Either way, level state is only read from
+    // draw_frame and geometry only from the level asset.
+    bool interpolate = false;
+    game::world::render_snapshot const* current_snapshot = nullptr;
+    std::unique_ptr<game::world::render_frame> local_frame;
+    game::world::render_frame const* draw_frame = nullptr;
+    float snapshot_alpha = 1.0f;
+    game::world::camera::current_camera_state draw_camera;
+
+    bool update_draw_state();
+    vector<3> get_draw_position(const game::world::thing_render_state& thing, thing_id tid) const;
+    quaternion<float> get_draw_orient(const game::world::thing_render_state& thing, thing_id tid) const;
     std::unordered_set<sector_id> sector_vis_scratch;
     std::unordered_set<sector_id> sector_visited_scratch;
     std::vector<std::tuple<sector_id, surface_id>> horizon_sky_surfaces_scratch;
@@ -91,13 +108,15 @@ private:
     void draw_visible_translucent_surfaces_and_things();
     void draw_pov_model();
 
-    void draw_surface(surface_id surf_num, const content::assets::level_sector& sector, float alpha);
-    void draw_sprite(const game::world::components::thing& thing, asset_ref<content::assets::sprite> sprite, float sector_light);
-    void draw_thing(const game::world::components::thing& thing, thing_id);
+    void draw_surface(surface_id surf_num, sector_id sec_num, float alpha);
+    void draw_sprite(const game::world::thing_render_state& thing, const vector<3>& pos,
+            asset_ref<content::assets::sprite> sprite, float sector_light);
+    void draw_thing(const game::world::thing_render_state& thing, thing_id);
 
 public:
     level_view(content_manager& shadercontentmanager,
                client_renderer_object_factory &renderer_object_factory);
+    ~level_view();
 
     inline void set_presenter(game::world::level_presenter* presenter) {
         currentPresenter = presenter;
@@ -111,6 +130,10 @@ public:
         currentModel = levelModel;
     }
 
+    inline void set_interpolation(bool value) {
+        interpolate = value;
+    }
+
     inline void update_shader_model_matrix() {
         currentLevelShader->set_model_matrix(model_matrix_stack.top());
     }
@@ -0,0 +1,222 @@
+#include "test/test.hpp"
+#include "game/world/replay/input_log.hpp"
+#include "io/memory_file.hpp"
+#include <vector>
+
+using namespace gorc;
+using namespace gorc::game::world::replay;
+
+namespace {
+    // One command of every type, with a payload wherever the type has one
+    std::vector<input_command> make_commands()
+    {
+        return {
+            input_command(input_command_type::move, make_vector(0.5f, -1.0f, 0.25f)),
+            input_command(input_command_type::yaw, 12.5f),
+            input_command(input_command_type::pitch, -3.0f),
+            input_command(input_command_type::jump),
+            input_command(input_command_type::activate),
+            input_command(input_command_type::fly),
+            input_command(input_command_type::crouch),
+            input_command(input_command_type::stand),
+            input_command(input_command_type::respawn),
+            input_command(input_command_type::damage),
+            input_command(input_command_type::cycle_camera),
+            input_command(input_command_type::fire, 1),
+            input_command(input_command_type::release, 1),
+            input_command(input_command_type::select_weapon, 7),
+            input_command(input_command_type::hotkey_pressed, 3),
+            input_command(input_command_type::hotkey_released, 3),
+            input_command(input_command_type::give_weapons),
+            input_command(input_command_type::sighted, 42)
+        };
+    }
+
+    std::vector<input_command> read_commands(memory_file &mf)
+    {
+        std::vector<input_command> rv;
+
+        memory_file::reader mr(mf);
+        binary_input_stream bis(mr);
+        input_log_codec codec;
+        while(!bis.at_end()) {
+            rv.push_back(codec.read(bis, binary_deserialize<uint8_t>(bis)));
+        }
+
+        return rv;
+    }
+
+    input_log_header make_header()
+    {
+        input_log_header header;
+        header.random_seed = 1234;
+        header.timestep_ms = 16;
+        header.episode = "jk1.gob";
+        header.level = "01narshadda.jkl";
+        return header;
+    }
+}
+
+begin_suite(input_log_test);
+
+test_case(codec_round_trip)
+{
+    auto commands = make_commands();
+
+    memory_file mf;
+    {
+        binary_output_stream bos(mf);
+        input_log_codec codec;
+        for(auto const &cmd : commands) {
+            codec.write(bos, cmd);
+        }
+    }
+
+    assert_eq(read_commands(mf), commands);
+}
+
+test_case(codec_writes_repeats_as_type_byte)
+{
+    auto move = input_command(input_command_type::move, make_vector(1.0f, 0.0f, 0.0f));
+    auto yaw = input_command(input_command_type::yaw, 2.0f);
+    auto other_move = input_command(input_command_type::move, make_vector(0.0f, 1.0f, 0.0f));
+
+    memory_file mf;
+    std::vector<size_t> sizes;
+    {
+        binary_output_stream bos(mf);
+        input_log_codec codec;
+        for(auto const &cmd : { move, move, yaw, move, other_move }) {
+            codec.write(bos, cmd);
+            sizes.push_back(mf.size());
+        }
+    }
+
+    // Repeats are compared per type, so the yaw between them does not matter
+    assert_eq(sizes[0], size_t(13));
+    assert_eq(sizes[1] - sizes[0], size_t(1));
+    assert_eq(sizes[2] - sizes[1], size_t(5));
+    assert_eq(sizes[3] - sizes[2], size_t(1));
+    assert_eq(sizes[4] - sizes[3], size_t(13));
+
+    assert_eq(read_commands(mf), (std::vector<input_command> { move, move, yaw, move, other_move }));
+}
+
+test_case(recorded_log_round_trip)
+{
+    auto commands = make_commands();
+
+    memory_file mf;
+    {
+        input_recorder recorder(mf, make_header());
+        recorder.record(commands[0]);
+        recorder.record(commands[1]);
+        recorder.end_tick(0x1111);
+
+        recorder.end_tick(0x2222);
+
+        for(auto const &cmd : commands) {
+            recorder.record(cmd);
+        }
+
+        recorder.end_tick(0x3333);
+        assert_eq(recorder.get_tick_count(), size_t(3));
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+    input_log log(deserialization_constructor, bis);
+
+    assert_eq(log.header.random_seed, uint32_t(1234));
+    assert_eq(log.header.timestep_ms, 16);
+    assert_eq(log.header.episode, std::string("jk1.gob"));
+    assert_eq(log.header.level, std::string("01narshadda.jkl"));
+
+    assert_eq(log.ticks.size(), size_t(3));
+    assert_eq(log.ticks[0].commands, (std::vector<input_command> { commands[0], commands[1] }));
+    assert_eq(log.ticks[0].state_hash, uint64_t(0x1111));
+    assert_true(log.ticks[1].commands.empty());
+    assert_eq(log.ticks[1].state_hash, uint64_t(0x2222));
+    assert_eq(log.ticks[2].commands, commands);
+    assert_eq(log.ticks[2].state_hash, uint64_t(0x3333));
+}
+
+test_case(truncated_log)
+{
+    memory_file mf;
+    {
+        input_recorder recorder(mf, make_header());
+        recorder.record(input_command(input_command_type::jump));
+        recorder.end_tick(0x1111);
+        recorder.record(input_command(input_command_type::yaw, 1.0f));
+    }
+
+    memory_file truncated;
+    truncated.write(mf.data(), mf.size() - 2);
+
+    memory_file::reader mr(truncated);
+    binary_input_stream bis(mr);
+    input_log log(deserialization_constructor, bis);
+
+    assert_eq(log.ticks.size(), size_t(1));
+    assert_log_message(log_level::warning, "input log is truncated after 1 ticks");
+    assert_log_empty();
+}
+
+test_case(not_an_input_log)
+{
+    memory_file mf;
+    {
+        binary_output_stream bos(mf);
+        binary_serialize<uint32_t>(bos, 1234U);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+    assert_throws_logged(input_log(deserialization_constructor, bis));
+    assert_log_message(log_level::error, "file is not an input log");
+    assert_log_empty();
+}
+
+test_case(unknown_command_type)
+{
+    memory_file mf;
+    {
+        binary_output_stream bos(mf);
+        binary_serialize<uint8_t>(bos, 0x7F);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+    input_log_codec codec;
+    assert_throws_logged(codec.read(bis, binary_deserialize<uint8_t>(bis)));
+    assert_log_message(log_level::error, "unknown input command type 127");
+    assert_log_empty();
+}
+
+test_case(player_counts_mismatched_ticks)
+{
+    memory_file mf;
+    {
+        input_recorder recorder(mf, make_header());
+        recorder.end_tick(1);
+        recorder.end_tick(2);
+        recorder.end_tick(3);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+    input_log log(deserialization_constructor, bis);
+
+    input_player player(log);
+    player.end_tick(1);
+    assert_true(!player.first_mismatch.has_value());
+
+    player.end_tick(5);
+    player.end_tick(6);
+    assert_true(player.done());
+    assert_eq(player.mismatched_ticks, size_t(2));
+    assert_eq(player.first_mismatch, maybe<size_t>(size_t(1)));
+}
+
+end_suite(input_log_test);
@@ -18,7 +18,7 @@ gorc::game::world::aspects::actor_controller_aspect::actor_controller_aspect(ent
         auto rng = cs.find_component<components::actor>(e.thing);
         for(auto it = rng.begin(); it != rng.end(); ++it) {
             for(auto &thing : cs.find_component<components::thing>(e.thing)) {
-                thing.second->thrust = make_zero_vector<3, float>();
+                thing.second->thrust() = make_zero_vector<3, float>();
             }
         }
 
@@ -30,7 +30,7 @@ void gorc::game::world::aspects::actor_controller_aspect::update(time_delta t, t
 
     if(thing.ai_mode_flags & flags::ai_mode_flag::turning_to_face_target) {
         // Get plane angle.
-        auto lv = thing.orient.transform(make_vector(0.0f, 1.0f, 0.0f));
+        auto lv = thing.orient().transform(make_vector(0.0f, 1.0f, 0.0f));
         auto plane_look = normalize(make_vector(get<0>(lv), get<1>(lv)));
 
         auto v = thing.ai_look_target;
@@ -43,20 +43,20 @@ void gorc::game::world::aspects::actor_controller_aspect::update(time_delta t, t
             thing.ai_mode_flags -= flags::ai_mode_flag::turning_to_face_target;
         }
         else {
-            thing.orient = slerp(thing.orient, make_rotation<float>(make_vector(0.0f, 0.0f, 1.0f), target_yaw - 90.0f), thing.ai_move_speed * static_cast<float>(t.count()) * 1.0f);
+            thing.orient() = slerp(thing.orient(), make_rotation<float>(make_vector(0.0f, 0.0f, 1.0f), target_yaw - 90.0f), thing.ai_move_speed * static_cast<float>(t.count()) * 1.0f);
         }
     }
 
     if(thing.ai_mode_flags & flags::ai_mode_flag::moving_toward_destination) {
-        auto v = thing.ai_move_target - thing.position;
+        auto v = thing.ai_move_target - thing.position();
         get<2>(v) = 0.0f;
 
         float vlen = length(v);
         if(vlen > 0.005f) {
-            thing.thrust = (v / vlen) * thing.ai_move_speed * static_cast<float>(t.count()) * 6.0f;
+            thing.thrust() = (v / vlen) * thing.ai_move_speed * static_cast<float>(t.count()) * 6.0f;
         }
         else {
-            thing.thrust = make_zero_vector<3, float>();
+            thing.thrust() = make_zero_vector<3, float>();
             thing.ai_mode_flags -= flags::ai_mode_flag::moving_toward_destination;
         }
     }
@@ -17,10 +17,10 @@ using gorc::game::world::aspects::character_controller_aspect;
 gorc::flags::standing_material_type character_controller_aspect::get_standing_material(components::thing& thing) {
     if(thing.attach_flags & flags::attach_flag::AttachedToThingFace) {
         auto& floor_thing = presenter.model->get_thing(thing.attached_thing.get_value());
-        if(floor_thing.flags & flags::thing_flag::Metal) {
+        if(floor_thing.flags() & flags::thing_flag::Metal) {
             return flags::standing_material_type::metal;
         }
-        else if(floor_thing.flags & flags::thing_flag::Dirt) {
+        else if(floor_thing.flags() & flags::thing_flag::Dirt) {
             return flags::standing_material_type::dirt;
         }
         else {
@@ -57,7 +57,7 @@ gorc::flags::standing_material_type character_controller_aspect::get_standing_ma
 bool character_controller_aspect::can_stand_on_thing(thing_id surface_thing_id) {
     auto const &surface_thing = presenter.model->get_thing(surface_thing_id);
     return (surface_thing.collide == flags::collide_type::face) &&
-           (surface_thing.flags & flags::thing_flag::CanStandOn);
+           (surface_thing.flags() & flags::thing_flag::CanStandOn);
 }
 
 bool character_controller_aspect::can_stand_on_surface(surface_id sid) {
@@ -126,9 +126,9 @@ gorc::maybe<gorc::game::world::physics::contact> character_controller_aspect::ru
 void character_controller_aspect::update_falling(thing_id tid, components::thing& thing, double dt) {
     auto maybe_contact = run_falling_sweep(tid, thing, dt);
 
-    auto applied_thrust = thing.thrust;
+    auto applied_thrust = thing.thrust();
     get<2>(applied_thrust) = 0.0f;
-    thing.vel = thing.vel + applied_thrust * static_cast<float>(dt);
+    thing.vel() = thing.vel() + applied_thrust * static_cast<float>(dt);
 
     maybe_if(maybe_contact, [&](physics::contact const &contact) {
         // Check if attached surface/thing has changed.
@@ -163,14 +163,14 @@ void character_controller_aspect::update_standing(thing_id tid, components::thin
             }
         });
 
-        if(get<2>(thing.thrust) > 0.0f) {
+        if(get<2>(thing.thrust()) > 0.0f) {
             jump(tid, thing);
         }
         else {
             // Accelerate body along surface
             auto hit_world = contact.position;
             auto hit_normal = contact.normal;
-            auto player_new_vel = thing.thrust - hit_normal * dot(thing.thrust, hit_normal);
+            auto player_new_vel = thing.thrust() - hit_normal * dot(thing.thrust(), hit_normal);
             auto new_vel = player_new_vel;
 
             maybe_if(contact.contact_surface_id, [&](surface_id attachment_id) {
@@ -190,15 +190,15 @@ void character_controller_aspect::update_standing(thing_id tid, components::thin
             if(thing.physics_flags & flags::physics_flag::is_crouching) {
                 //float dist = dot(hit_normal, thing.position - hit_world);
                 auto hover_position = hit_world + insert_offset_norm * (thing.size + 0.01f);
-                new_vel += (hover_position - thing.position) * 20.0f;
+                new_vel += (hover_position - thing.position()) * 20.0f;
             }
             else {
                 //float dist = dot(hit_normal, thing.position - hit_world);
                 auto hover_position = hit_world + insert_offset;
-                new_vel += (hover_position - thing.position) * 20.0f;
+                new_vel += (hover_position - thing.position()) * 20.0f;
             }
 
-            thing.vel = new_vel;
+            thing.vel() = new_vel;
         }
     }
     else {
@@ -257,10 +257,10 @@ bool character_controller_aspect::step_on_surface(thing_id tid, components::thin
 bool character_controller_aspect::step_on_thing(thing_id tid, components::thing& thing, thing_id land_thing_id,
                 const physics::contact&) {
     const auto& attach_thing = presenter.model->get_thing(land_thing_id);
-    if(attach_thing.flags & flags::thing_flag::CanStandOn) {
+    if(attach_thing.flags() & flags::thing_flag::CanStandOn) {
         thing.attach_flags = flag_set<flags::attach_flag> { flags::attach_flag::AttachedToThingFace };
         thing.attached_thing = land_thing_id;
-        thing.prev_attached_thing_position = presenter.model->get_thing(land_thing_id).position;
+        thing.prev_attached_thing_position = presenter.model->get_thing(land_thing_id).position();
 
         presenter.model->send_to_linked(
                 cog::message_type::entered,
@@ -302,7 +302,7 @@ void character_controller_aspect::land_on_thing(thing_id tid, components::thing&
 void character_controller_aspect::jump(thing_id tid, components::thing& thing) {
     ecs.bus.fire_event(events::jumped(tid));
     set_is_falling(tid, thing);
-    thing.vel = thing.vel + make_vector(0.0f, 0.0f, get<2>(thing.thrust));
+    thing.vel() = thing.vel() + make_vector(0.0f, 0.0f, get<2>(thing.thrust()));
 }
 
 void character_controller_aspect::update(time_delta t,
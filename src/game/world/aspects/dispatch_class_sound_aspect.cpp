@@ -110,7 +110,7 @@ void dispatch_class_sound_aspect::handle_animation_marker(thing_id id,
 
 dispatch_class_sound_aspect::dispatch_class_sound_aspect(entity_component_system<thing_id> &cs,
                                                          level_presenter &presenter)
-    : inner_join_aspect(cs), presenter(presenter) {
+    : inner_join_aspect(cs), presenter(presenter), rand(presenter.random_seed + 1U) {
 
     created_delegate =
         cs.bus.add_handler<events::thing_created>([&](events::thing_created const &e) {
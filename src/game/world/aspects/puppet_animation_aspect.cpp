@@ -28,7 +28,7 @@ puppet_animation_aspect::puppet_animation_aspect(entity_component_system<thing_i
         for(auto &pup : cs.find_component<components::puppet_animations>(e.thing)) {
             bool is_underwater = false;
             for(auto &thing : cs.find_component<components::thing>(e.thing)) {
-                auto const &cur_sector = at_id(presenter.model->sectors, thing.second->sector);
+                auto const &cur_sector = at_id(presenter.model->sectors, thing.second->sector());
                 is_underwater = cur_sector.flags & flags::sector_flag::Underwater;
             }
 
@@ -150,8 +150,8 @@ bool puppet_animation_aspect::is_walk_animation_mode(components::puppet_animatio
 
 void puppet_animation_aspect::update_standing_animation(components::thing &thing,
                                                         components::puppet_animations &pup) {
-    auto oriented_vel = invert(thing.orient).transform(thing.vel);
-    auto run_length = length(thing.vel);
+    auto oriented_vel = invert(thing.orient()).transform(thing.vel());
+    auto run_length = length(thing.vel());
 
     auto vel_fb = get<1>(oriented_vel);
     auto vel_lr = get<0>(oriented_vel);
@@ -240,7 +240,7 @@ void puppet_animation_aspect::update(time_delta,
         // Thing is in freefall.
         // If the player has just jumped, the jump animation is already playing.
         // Check to see if the player has reached apogee:
-        if(dot(thing.vel, make_vector(0.0f, 0.0f, -1.0f)) > 0.0f) {
+        if(dot(thing.vel(), make_vector(0.0f, 0.0f, -1.0f)) > 0.0f) {
             // Thing's trajectory has reached apogee.
             set_walk_animation(thing, pup, flags::puppet_submode_type::Drop, 1.0f);
         }
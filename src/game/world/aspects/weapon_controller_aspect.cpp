@@ -71,11 +71,11 @@ void weapon_controller_aspect::touched_surface(thing_id tid, surface_id touched_
     const auto& touched_surface = at_id(presenter.model->surfaces, touched_surface_id);
     if(((touched_surface.flags & flags::surface_flag::MagSealed) && (proj_flags & flags::weapon_flag::ricochets_on_magsealed))
             || (proj_flags & flags::weapon_flag::ricochets_on_surface)) {
-        if(dot(projectile.vel, touched_surface.normal) <= 0.0f) {
+        if(dot(projectile.vel(), touched_surface.normal) <= 0.0f) {
             // Reflect projectile
             proj_flags -= flags::weapon_flag::does_not_affect_parent;
             projectile.type_flags = static_cast<int>(proj_flags);
-            projectile.vel -= 2.0f * dot(projectile.vel, touched_surface.normal) * touched_surface.normal;
+            projectile.vel() -= 2.0f * dot(projectile.vel(), touched_surface.normal) * touched_surface.normal;
             presenter.sound_presenter->play_sound_class(thing_id(tid), flags::sound_subclass_type::deflected);
         }
         return;
@@ -38,7 +38,7 @@ void gorc::game::world::camera::camera_presenter::update(const gorc::time& time)
     auto& cam = model->current_computed_state;
 
     const auto& focus_thing = levelmodel->get_thing(selected_camera.focus);
-    const auto focus_thing_orient = focus_thing.orient
+    const auto focus_thing_orient = focus_thing.orient()
             * make_euler(selected_camera.angle_offset)
             * make_rotation(make_vector(1.0f, 0.0f, 0.0f), focus_thing.head_pitch);
 
@@ -56,15 +56,15 @@ void gorc::game::world::camera::camera_presenter::update(const gorc::time& time)
             },
             contact);
 
-    auto true_desired_position = focus_thing.position + true_offset;
+    auto true_desired_position = focus_thing.position() + true_offset;
     maybe_if(contact, [&](physics::contact const &cnt) {
         // Bring back by some small radius - 0.02?
-        true_desired_position = cnt.position + normalize(focus_thing.position - cnt.position) * 0.02f;
+        true_desired_position = cnt.position + normalize(focus_thing.position() - cnt.position) * 0.02f;
     });
 
     // Calculate sector containing camera
-    physics::segment_adjoin_path(physics::segment(focus_thing.position, true_desired_position), *levelmodel,
-            at_id(levelmodel->sectors, focus_thing.sector), update_path_sector_scratch);
+    physics::segment_adjoin_path(physics::segment(focus_thing.position(), true_desired_position), *levelmodel,
+            at_id(levelmodel->sectors, focus_thing.sector()), update_path_sector_scratch);
     cam.containing_sector = std::get<0>(update_path_sector_scratch.back());
     cam.position = true_desired_position;
 
@@ -91,7 +91,7 @@ void gorc::game::world::camera::camera_presenter::update(const gorc::time& time)
 
     // Calculate pov model waggle.
     const auto& player_thing = levelmodel->get_thing(presenter.get_local_player_thing());
-    auto player_speed = length(make_vector(get<0>(player_thing.vel), get<1>(player_thing.vel))) / player_thing.max_vel;
+    auto player_speed = length(make_vector(get<0>(player_thing.vel()), get<1>(player_thing.vel()))) / player_thing.max_vel;
     float actual_waggle_speed = player_speed * pov_model.waggle_speed * static_cast<float>(time.elapsed_as_seconds()) * (1.0f / 60.0f);
     pov_model.waggle_time += actual_waggle_speed;
     float waggle_up = -cosf(pov_model.waggle_time * 2.0f);
@@ -1,6 +1,10 @@
 #include "thing.hpp"
 
-gorc::game::world::components::thing::thing(const content::assets::thing_template& tpl)
-    : content::assets::thing_template(tpl) {
+gorc::game::world::components::thing::thing(const content::assets::thing_template& tpl, thing_body& body)
+    : content::assets::thing_properties(tpl), body(&body) {
     return;
 }
+
+gorc::game::world::components::thing::~thing() {
+    body->live = false;
+}
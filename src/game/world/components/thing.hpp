@@ -1,6 +1,7 @@
 #pragma once
 
 #include "libold/content/assets/template.hpp"
+#include "thing_body.hpp"
 #include "game/world/physics/object_data.hpp"
 #include "utility/maybe.hpp"
 #include "libold/content/flags/jk_flag.hpp"
@@ -18,7 +19,10 @@ class sound;
 
 namespace components {
 
-class thing : public content::assets::thing_template {
+class thing : public content::assets::thing_properties {
+private:
+    thing_body* body;
+
 public:
     uid(1226231207);
 
@@ -68,8 +72,76 @@ public:
     float saber_collide_length = 0.0f;
     float saber_unknown = 0.0f;
 
-    thing() = default;
-    thing(const content::assets::thing_template& tpl);
+    thing(const content::assets::thing_template& tpl, thing_body& body);
+    ~thing();
+
+    thing(const thing&) = delete;
+    thing& operator=(const thing&) = delete;
+
+    // Simulation state is held in the thing body.
+    inline sector_id& sector() {
+        return body->sector;
+    }
+
+    inline const sector_id& sector() const {
+        return body->sector;
+    }
+
+    inline vector<3>& position() {
+        return body->position;
+    }
+
+    inline const vector<3>& position() const {
+        return body->position;
+    }
+
+    inline quaternion<float>& orient() {
+        return body->orient;
+    }
+
+    inline const quaternion<float>& orient() const {
+        return body->orient;
+    }
+
+    inline vector<3>& vel() {
+        return body->vel;
+    }
+
+    inline const vector<3>& vel() const {
+        return body->vel;
+    }
+
+    inline vector<3>& thrust() {
+        return body->thrust;
+    }
+
+    inline const vector<3>& thrust() const {
+        return body->thrust;
+    }
+
+    inline float& move_size() {
+        return body->move_size;
+    }
+
+    inline const float& move_size() const {
+        return body->move_size;
+    }
+
+    inline flags::move_type& move() {
+        return body->move;
+    }
+
+    inline const flags::move_type& move() const {
+        return body->move;
+    }
+
+    inline flag_set<flags::thing_flag>& flags() {
+        return body->flags;
+    }
+
+    inline const flag_set<flags::thing_flag>& flags() const {
+        return body->flags;
+    }
 };
 
 }
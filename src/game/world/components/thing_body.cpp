@@ -0,0 +1,50 @@
+#include "thing_body.hpp"
+#include <algorithm>
+
+gorc::game::world::components::thing_body::thing_body(const content::assets::thing_template& tpl)
+    : sector(tpl.sector), position(tpl.position), orient(tpl.orient), vel(tpl.vel), thrust(tpl.thrust),
+      move_size(tpl.move_size), move(tpl.move), flags(tpl.flags), live(true) {
+    return;
+}
+
+gorc::game::world::components::thing_body_table::iterator::iterator(thing_body_table const* table, size_t index)
+    : table(table), index(index) {
+    skip_dead();
+}
+
+void gorc::game::world::components::thing_body_table::iterator::skip_dead() {
+    while(index < table->count && !table->at(index).live) {
+        ++index;
+    }
+}
+
+gorc::game::world::components::thing_body_table::iterator&
+gorc::game::world::components::thing_body_table::iterator::operator++() {
+    ++index;
+    skip_dead();
+    return *this;
+}
+
+gorc::game::world::components::thing_body& gorc::game::world::components::thing_body_table::emplace(thing_id id,
+        const content::assets::thing_template& tpl) {
+    size_t index = static_cast<size_t>(static_cast<int>(id));
+    while(pages.size() * page_size <= index) {
+        pages.push_back(std::make_unique<page>());
+    }
+
+    count = std::max(count, index + 1);
+
+    auto& body = at(index);
+    body = thing_body(tpl);
+    return body;
+}
+
+gorc::game::world::components::thing_body_table::iterator
+gorc::game::world::components::thing_body_table::begin() const {
+    return iterator(this, 0);
+}
+
+gorc::game::world::components::thing_body_table::iterator
+gorc::game::world::components::thing_body_table::end() const {
+    return iterator(this, count);
+}
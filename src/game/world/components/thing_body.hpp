@@ -0,0 +1,91 @@
+#pragma once
+
+#include "libold/content/assets/template.hpp"
+#include "content/id.hpp"
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace gorc {
+namespace game {
+namespace world {
+namespace components {
+
+// Simulation state of a thing. Bodies are stored apart from the thing
+// component so loops over every thing only touch this data.
+class thing_body {
+public:
+    sector_id sector;
+    vector<3> position;
+    quaternion<float> orient;
+    vector<3> vel;
+    vector<3> thrust;
+    float move_size = 0.05f;
+    flags::move_type move = flags::move_type::none;
+    flag_set<flags::thing_flag> flags;
+
+    bool live = false;
+
+    thing_body() = default;
+    explicit thing_body(const content::assets::thing_template& tpl);
+};
+
+// Bodies indexed by thing id. Pages keep bodies contiguous in id order
+// without moving existing bodies as the table grows.
+class thing_body_table {
+private:
+    static constexpr size_t page_size = 128;
+    using page = std::array<thing_body, page_size>;
+
+    std::vector<std::unique_ptr<page>> pages;
+    size_t count = 0;
+
+    inline thing_body& at(size_t index) const {
+        return (*pages[index / page_size])[index % page_size];
+    }
+
+public:
+    // Iterates live bodies in thing id order.
+    class iterator {
+        friend class thing_body_table;
+
+    private:
+        thing_body_table const* table;
+        size_t index;
+
+        iterator(thing_body_table const* table, size_t index);
+
+        void skip_dead();
+
+    public:
+        inline std::pair<thing_id, thing_body*> operator*() const {
+            return std::make_pair(thing_id(static_cast<int>(index)), &table->at(index));
+        }
+
+        iterator& operator++();
+
+        inline bool operator==(const iterator& it) const {
+            return index == it.index;
+        }
+
+        inline bool operator!=(const iterator& it) const {
+            return index != it.index;
+        }
+    };
+
+    thing_body& emplace(thing_id id, const content::assets::thing_template& tpl);
+
+    // Number of body slots, live or not.
+    inline size_t size() const {
+        return count;
+    }
+
+    iterator begin() const;
+    iterator end() const;
+};
+
+}
+}
+}
+}
@@ -143,15 +143,29 @@ public:
                               maybe<asset_ref<content::assets::puppet>> puppet_file = nothing,
                               float head_pitch = 0.0f)
     {
-        visitor.push_matrix();
-        visitor.concatenate_matrix(make_translation_matrix(base_position)
-                * convert_to_rotation_matrix(base_orientation));
-
         maybe<key_mix const *> mix = nothing;
         if(attached_key_mix.is_valid()) {
             mix = maybe_get_mix(attached_key_mix, is_pov_mix);
         }
 
+        visit_mesh_hierarchy(visitor, obj, base_position, base_orientation, mix, puppet_file, head_pitch);
+    }
+
+    // Poses the model from a key mix held outside the level, such as one
+    // copied into a render snapshot.
+    template <typename T>
+    void visit_mesh_hierarchy(T& visitor,
+                              asset_ref<content::assets::model> obj,
+                              const vector<3>& base_position,
+                              const quaternion<float>& base_orientation,
+                              maybe<key_mix const *> mix,
+                              maybe<asset_ref<content::assets::puppet>> puppet_file = nothing,
+                              float head_pitch = 0.0f)
+    {
+        visitor.push_matrix();
+        visitor.concatenate_matrix(make_translation_matrix(base_position)
+                * convert_to_rotation_matrix(base_orientation));
+
         visit_mesh_node(visitor, obj, mix, 0, puppet_file, head_pitch);
 
         visitor.pop_matrix();
@@ -10,6 +10,7 @@
 #include "game/world/sounds/sound_model.hpp"
 #include "game/world/camera/camera_model.hpp"
 #include "value_mapping.hpp"
+#include "render_snapshot.hpp"
 #include <vector>
 
 namespace gorc {
@@ -25,6 +26,9 @@ public:
     std::vector<content::assets::level_sector> sectors;
 
     service_registry services;
+
+    // Declared before the ECS: thing components release their bodies on destruction.
+    components::thing_body_table thing_bodies;
     entity_component_system<thing_id> ecs;
 
     cog::executor script_model;
@@ -41,6 +45,9 @@ public:
     double game_time = 0.0;
     color_rgb dynamic_tint = make_color(0.0f, 0.0f, 0.0f);
 
+    // Published by the level presenter when the view draws on another thread.
+    render_snapshot_buffer render_snapshots;
+
     level_model(content_manager& manager, service_registry const &,
             asset_ref<content::assets::level> level);
 
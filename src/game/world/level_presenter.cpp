@@ -36,9 +36,35 @@
 #include "game/world/events/class_sound.hpp"
 
 #include "jk/content/material.hpp"
+#include "game/world/replay/input_command.hpp"
+#include "game/world/replay/input_log.hpp"
+#include "jk/cog/vm/default_verbs.hpp"
+#include "profile/profiler.hpp"
+#include <random>
+
+namespace {
+    template <typename FnT>
+    void time_subsystem(char const* zone_name,
+                        gorc::game::world::level_update_timings* timings,
+                        gorc::game::world::level_update_timings::duration gorc::game::world::level_update_timings::* field,
+                        FnT const& fn) {
+        PROFILE_ZONE(zone_name);
+        (void)zone_name;
+
+        if(!timings) {
+            fn();
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        timings->*field += std::chrono::steady_clock::now() - start;
+    }
+}
 
 gorc::game::world::level_presenter::level_presenter(level_state& components, const level_place& place)
-    : components(components), place(place), contentmanager(place.contentmanager) {
+    : components(components), place(place), contentmanager(place.contentmanager),
+      random_seed(std::random_device()()) {
     physics_presenter = std::make_unique<physics::physics_presenter>(*this);
     animation_presenter = std::make_unique<animations::animation_presenter>();
     sound_presenter = std::make_unique<sounds::sound_presenter>(*place.contentmanager);
@@ -55,6 +81,7 @@ gorc::game::world::level_presenter::~level_presenter() {
 
 void gorc::game::world::level_presenter::start(event_bus& eventBus) {
     eventbus = &eventBus;
+    cog::seed_random_verbs(random_seed);
     model = std::make_unique<level_model>(*place.contentmanager, components.services, place.level);
 
     // Create local aspects
@@ -135,7 +162,7 @@ void gorc::game::world::level_presenter::initialize_world() {
         switch(senderref.get_type()) {
         case cog::value_type::thing:
             if(tid.is_valid()) {
-                model->get_thing(tid).flags += flags::thing_flag::CogLinked;
+                model->get_thing(tid).flags() += flags::thing_flag::CogLinked;
             }
             break;
 
@@ -158,16 +185,27 @@ void gorc::game::world::level_presenter::initialize_world() {
 }
 
 void gorc::game::world::level_presenter::update(const gorc::time& time) {
+    PROFILE_ZONE("level update");
+
+    if(queue_input) {
+        apply_queued_input();
+    }
+
     double dt = time.elapsed_as_seconds();
 
-    physics_presenter->update(time);
-    camera_presenter->update(time);
-    sound_presenter->update(time);
-    key_presenter->update(time);
-    inventory_presenter->update(time);
+    time_subsystem("physics", update_timings, &level_update_timings::physics, [&] { physics_presenter->update(time); });
+    time_subsystem("camera", update_timings, &level_update_timings::camera, [&] { camera_presenter->update(time); });
+    time_subsystem("sounds", update_timings, &level_update_timings::sounds, [&] { sound_presenter->update(time); });
+    time_subsystem("keys", update_timings, &level_update_timings::keys, [&] { key_presenter->update(time); });
+    time_subsystem("inventory", update_timings, &level_update_timings::inventory, [&] { inventory_presenter->update(time); });
 
-    model->script_model.update(time_delta(time.elapsed_as_seconds()));
-    model->ecs.update(time_delta(time.elapsed_as_seconds()));
+    time_subsystem("scripts", update_timings, &level_update_timings::scripts, [&] {
+        model->script_model.update(time_delta(time.elapsed_as_seconds()));
+    });
+
+    time_subsystem("ecs", update_timings, &level_update_timings::ecs, [&] {
+        model->ecs.update(time_delta(time.elapsed_as_seconds()));
+    });
 
     // update dynamic tint, game time.
     model->game_time += dt;
@@ -177,14 +215,19 @@ void gorc::game::world::level_presenter::update(const gorc::time& time) {
     get<0>(model->dynamic_tint) = std::max(get<0>(model->dynamic_tint), 0.0f);
     get<1>(model->dynamic_tint) = std::max(get<1>(model->dynamic_tint), 0.0f);
     get<2>(model->dynamic_tint) = std::max(get<2>(model->dynamic_tint), 0.0f);
+
+    if(publish_render_snapshots) {
+        PROFILE_ZONE("render snapshot");
+        model->render_snapshots.publish(*model, dt);
+    }
 }
 
 void gorc::game::world::level_presenter::update_thing_sector(thing_id tid, components::thing& thing,
         const vector<3>& oldThingPosition) {
-    physics::segment segment(oldThingPosition, thing.position);
-    physics::segment_adjoin_path(segment, *model, at_id(model->sectors, thing.sector), update_path_sector_scratch);
+    physics::segment segment(oldThingPosition, thing.position());
+    physics::segment_adjoin_path(segment, *model, at_id(model->sectors, thing.sector()), update_path_sector_scratch);
 
-    if(std::get<0>(update_path_sector_scratch.back()) == thing.sector) {
+    if(std::get<0>(update_path_sector_scratch.back()) == thing.sector()) {
         // thing hasn't moved to a different sector.
         return;
     }
@@ -198,14 +241,14 @@ void gorc::game::world::level_presenter::update_thing_sector(thing_id tid, compo
     }
 
     for(unsigned int i = 1; i < update_path_sector_scratch.size() - 1; ++i) {
-        if(at_id(model->sectors, thing.sector).flags & flags::sector_flag::CogLinked) {
+        if(at_id(model->sectors, thing.sector()).flags & flags::sector_flag::CogLinked) {
             model->send_to_linked(cog::message_type::exited,
-                                  /* sender */ thing.sector,
+                                  /* sender */ thing.sector(),
                                   /* source */ tid);
         }
 
         sector_id sec_id = std::get<0>(update_path_sector_scratch[i]);
-        thing.sector = sec_id;
+        thing.sector() = sec_id;
         if(at_id(model->sectors, sec_id).flags & flags::sector_flag::CogLinked) {
             model->send_to_linked(cog::message_type::entered,
                                   /* sender */ sec_id,
@@ -220,14 +263,14 @@ void gorc::game::world::level_presenter::update_thing_sector(thing_id tid, compo
         }
     }
 
-    if(at_id(model->sectors, thing.sector).flags & flags::sector_flag::CogLinked) {
+    if(at_id(model->sectors, thing.sector()).flags & flags::sector_flag::CogLinked) {
         model->send_to_linked(cog::message_type::exited,
-                              /* sender */ thing.sector,
+                              /* sender */ thing.sector(),
                               /* source */ tid);
     }
 
     sector_id last_sector = std::get<0>(update_path_sector_scratch.back());
-    thing.sector = last_sector;
+    thing.sector() = last_sector;
     if(at_id(model->sectors, last_sector).flags & flags::sector_flag::CogLinked) {
         model->send_to_linked(cog::message_type::entered,
                               /* sender */ last_sector,
@@ -235,12 +278,128 @@ void gorc::game::world::level_presenter::update_thing_sector(thing_id tid, compo
     }
 }
 
+void gorc::game::world::level_presenter::submit_input(const replay::input_command& cmd) {
+    if(replaying) {
+        return;
+    }
+
+    if(queue_input) {
+        std::lock_guard<std::mutex> lk(input_queue_lock);
+        input_queue.push_back(cmd);
+        return;
+    }
+
+    if(input_recorder) {
+        input_recorder->record(cmd);
+    }
+
+    apply_input(cmd);
+}
+
+void gorc::game::world::level_presenter::apply_queued_input() {
+    {
+        std::lock_guard<std::mutex> lk(input_queue_lock);
+        std::swap(input_queue, input_queue_scratch);
+    }
+
+    for(const auto& cmd : input_queue_scratch) {
+        if(input_recorder) {
+            input_recorder->record(cmd);
+        }
+
+        apply_input(cmd);
+    }
+
+    input_queue_scratch.clear();
+}
+
+void gorc::game::world::level_presenter::apply_input(const replay::input_command& cmd) {
+    thing_id player = get_local_player_thing();
+
+    switch(cmd.type) {
+    case replay::input_command_type::move:
+        translate_camera(cmd.direction);
+        break;
+
+    case replay::input_command_type::yaw:
+        yaw_camera(cmd.amount);
+        break;
+
+    case replay::input_command_type::pitch:
+        pitch_camera(cmd.amount);
+        break;
+
+    case replay::input_command_type::jump:
+        jump();
+        break;
+
+    case replay::input_command_type::activate:
+        activate();
+        break;
+
+    case replay::input_command_type::fly:
+        fly();
+        break;
+
+    case replay::input_command_type::crouch:
+        crouch(true);
+        break;
+
+    case replay::input_command_type::stand:
+        crouch(false);
+        break;
+
+    case replay::input_command_type::respawn:
+        respawn();
+        break;
+
+    case replay::input_command_type::damage:
+        damage();
+        break;
+
+    case replay::input_command_type::cycle_camera:
+        camera_presenter->cycle_camera();
+        break;
+
+    case replay::input_command_type::fire:
+        inventory_presenter->on_weapon_fire_pressed(player, cmd.param);
+        break;
+
+    case replay::input_command_type::release:
+        inventory_presenter->on_weapon_fire_released(player, cmd.param);
+        break;
+
+    case replay::input_command_type::select_weapon:
+        inventory_presenter->select_weapon(player, cmd.param);
+        break;
+
+    case replay::input_command_type::hotkey_pressed:
+        inventory_presenter->on_item_hotkey_pressed(player, cmd.param);
+        break;
+
+    case replay::input_command_type::hotkey_released:
+        inventory_presenter->on_item_hotkey_released(player, cmd.param);
+        break;
+
+    case replay::input_command_type::give_weapons:
+        // Fieldlight batteries, bryar, strifle, xbow, repeater, and ammo.
+        for(int i = 1; i <= 15; ++i) {
+            inventory_presenter->set_inv(player, i, inventory_presenter->get_inv_max(player, i));
+        }
+        break;
+
+    case replay::input_command_type::sighted:
+        thing_sighted(thing_id(cmd.param));
+        break;
+    }
+}
+
 void gorc::game::world::level_presenter::translate_camera(const vector<3>& amt) {
     auto& player = model->get_thing(model->local_player_thing_id);
-    player.thrust = player.orient.transform(amt);
+    player.thrust() = player.orient().transform(amt);
 
     // TODO: Handle this in character controller or in physics presenter.
-    get<2>(player.thrust) = 0.0f;
+    get<2>(player.thrust()) = 0.0f;
 }
 
 void gorc::game::world::level_presenter::yaw_camera(double amt) {
@@ -259,20 +418,20 @@ void gorc::game::world::level_presenter::respawn() {
     model->current_spawn_point = model->current_spawn_point % model->spawn_points.size();
 
     components::thing& cameraThing = model->get_thing(model->local_player_thing_id);
-    cameraThing.sector = model->spawn_points[model->current_spawn_point]->sector;
-    cameraThing.position = model->spawn_points[model->current_spawn_point]->position;
+    cameraThing.sector() = model->spawn_points[model->current_spawn_point]->sector;
+    cameraThing.position() = model->spawn_points[model->current_spawn_point]->position;
     cameraThing.attach_flags = flag_set<flags::attach_flag>();
-    cameraThing.vel = make_zero_vector<3, float>();
+    cameraThing.vel() = make_zero_vector<3, float>();
 }
 
 void gorc::game::world::level_presenter::jump() {
     auto& player = model->get_thing(model->local_player_thing_id);
-    get<2>(player.thrust) = player.jump_speed;
+    get<2>(player.thrust()) = player.jump_speed;
 }
 
 void gorc::game::world::level_presenter::fly() {
     auto& player = model->get_thing(model->local_player_thing_id);
-    get<2>(player.vel) += 0.1f;
+    get<2>(player.vel()) += 0.1f;
 }
 
 void gorc::game::world::level_presenter::activate() {
@@ -341,7 +500,19 @@ void gorc::game::world::level_presenter::crouch(bool is_crouched) {
 }
 
 void gorc::game::world::level_presenter::thing_sighted(thing_id tid) {
-    model->get_thing(tid).flags += flags::thing_flag::Sighted;
+    // The view draws from a snapshot, so it may report a thing again before
+    // it sees the flag, or after the thing is gone.
+    bool newly_sighted = false;
+    for(auto& thing_pair : model->ecs.find_component<components::thing>(tid)) {
+        auto& thing_flags = thing_pair.second->flags();
+        newly_sighted = !(thing_flags & flags::thing_flag::Sighted);
+        thing_flags += flags::thing_flag::Sighted;
+    }
+
+    if(!newly_sighted) {
+        return;
+    }
+
     model->send_to_linked(cog::message_type::sighted,
                           /* sender */ tid,
                           /* source */ cog::value());
@@ -366,7 +537,7 @@ void gorc::game::world::level_presenter::ai_set_look_frame(thing_id tid, int fra
 void gorc::game::world::level_presenter::ai_set_look_pos(thing_id tid, const vector<3>& pos) {
     auto& thing = model->get_thing(tid);
 
-    thing.ai_look_target = pos - thing.position;
+    thing.ai_look_target = pos - thing.position();
     thing.ai_mode_flags += flags::ai_mode_flag::turning_to_face_target;
 }
 
@@ -395,7 +566,7 @@ void gorc::game::world::level_presenter::ai_set_move_speed(thing_id tid, float s
 
 void gorc::game::world::level_presenter::ai_set_move_thing(thing_id tid, thing_id move_to_thing) {
     // TODO: Revisit. Does this mean continuously chase?
-    ai_set_move_pos(tid, model->get_thing(move_to_thing).position);
+    ai_set_move_pos(tid, model->get_thing(move_to_thing).position());
 }
 
 // Color verbs
@@ -421,7 +592,7 @@ bool gorc::game::world::level_presenter::has_los(thing_id look_thing_id, thing_i
     auto& look_thing = model->get_thing(look_thing_id);
     auto& target_thing = model->get_thing(target_thing_id);
 
-    auto contact = physics_presenter->thing_segment_query(look_thing_id, target_thing.position - look_thing.position,
+    auto contact = physics_presenter->thing_segment_query(look_thing_id, target_thing.position() - look_thing.position(),
             [&](thing_id tid) {
                 if(tid == target_thing_id) {
                     return true;
@@ -569,9 +740,9 @@ void gorc::game::world::level_presenter::clear_sector_flags(sector_id sid, flag_
 }
 
 gorc::thing_id gorc::game::world::level_presenter::first_thing_in_sector(sector_id sid) {
-    for(auto& thing : model->ecs.all_components<components::thing>()) {
-        if(thing.second->sector == sid) {
-            return thing.first;
+    for(const auto& body : model->thing_bodies) {
+        if(body.second->sector == sid) {
+            return body.first;
         }
     }
 
@@ -583,11 +754,11 @@ gorc::flag_set<gorc::flags::sector_flag> gorc::game::world::level_presenter::get
 }
 
 gorc::thing_id gorc::game::world::level_presenter::next_thing_in_sector(thing_id tid) {
-    sector_id sid = model->get_thing(tid).sector;
+    sector_id sid = model->get_thing(tid).sector();
 
-    for(auto& thing : model->ecs.all_components<components::thing>()) {
-        if(thing.second->sector == sid && static_cast<int>(thing.first) > static_cast<int>(tid)) {
-            return thing.first;
+    for(const auto& body : model->thing_bodies) {
+        if(body.second->sector == sid && static_cast<int>(body.first) > static_cast<int>(tid)) {
+            return body.first;
         }
     }
 
@@ -700,14 +871,13 @@ gorc::thing_id gorc::game::world::level_presenter::create_thing(const content::a
         const vector<3>& pos, const quaternion<float>& orient) {
     // Initialize thing properties
     thing_id new_thing_id = model->ecs.emplace_entity();
-    model->ecs.emplace_component<components::thing>(new_thing_id, tpl);
-
-    auto& new_thing = model->get_thing(new_thing_id);
+    auto& new_body = model->thing_bodies.emplace(new_thing_id, tpl);
+    auto& new_thing = model->ecs.emplace_component<components::thing>(new_thing_id, tpl, new_body);
 
     new_thing.object_data.thing_id = static_cast<int>(new_thing_id);
-    new_thing.sector = sector_num;
-    new_thing.position = pos;
-    new_thing.orient = orient;
+    new_thing.sector() = sector_num;
+    new_thing.position() = pos;
+    new_thing.orient() = orient;
 
     // Dispatch creation of thing components
     eventbus->fire_event(events::thing_created(new_thing_id, tpl));
@@ -747,21 +917,21 @@ gorc::thing_id gorc::game::world::level_presenter::fire_projectile(thing_id pare
 
     const auto& parent_thing = model->get_thing(parent_thing_id);
 
-    const auto& parent_look_orient = parent_thing.orient * make_rotation(make_vector(1.0f, 0.0f, 0.0f), parent_thing.head_pitch) * make_euler(error_vec);
+    const auto& parent_look_orient = parent_thing.orient() * make_rotation(make_vector(1.0f, 0.0f, 0.0f), parent_thing.head_pitch) * make_euler(error_vec);
 
-    thing_id new_thing = create_thing(tpl_id, parent_thing.sector, parent_thing.position, parent_look_orient);
+    thing_id new_thing = create_thing(tpl_id, parent_thing.sector(), parent_thing.position(), parent_look_orient);
     auto& created_thing = model->get_thing(new_thing);
 
     created_thing.parent_thing = parent_thing_id;
-    adjust_thing_pos(new_thing, created_thing.position + parent_look_orient.transform(offset_vec));
+    adjust_thing_pos(new_thing, created_thing.position() + parent_look_orient.transform(offset_vec));
 
     // TODO: Don't orient velocity, let flags handle it.
-    created_thing.vel = parent_look_orient.transform(created_thing.vel);
+    created_thing.vel() = parent_look_orient.transform(created_thing.vel());
 
     // TODO: Deal with error vec, autoaim fov.
 
     if(fire_sound_id.is_valid()) {
-        sound_presenter->play_sound_pos(fire_sound_id, created_thing.position, 1.0f, -1.0f, -1.0f, flag_set<flags::sound_flag>());
+        sound_presenter->play_sound_pos(fire_sound_id, created_thing.position(), 1.0f, -1.0f, -1.0f, flag_set<flags::sound_flag>());
     }
 
     if(puppet_submode_id >= 0) {
@@ -773,16 +943,16 @@ gorc::thing_id gorc::game::world::level_presenter::fire_projectile(thing_id pare
 
 void gorc::game::world::level_presenter::adjust_thing_pos(thing_id tid, const vector<3>& new_pos) {
     auto& thing = model->get_thing(tid);
-    auto old_pos = thing.position;
-    thing.position = new_pos;
+    auto old_pos = thing.position();
+    thing.position() = new_pos;
     update_thing_sector(tid, thing, old_pos);
 }
 
 void gorc::game::world::level_presenter::set_thing_pos(thing_id tid, const vector<3>& new_pos, const quaternion<float>& new_orient, sector_id new_sector) {
     components::thing& thing = model->get_thing(tid);
-    thing.position = new_pos;
-    thing.orient = new_orient;
-    thing.sector = new_sector;
+    thing.position() = new_pos;
+    thing.orient() = new_orient;
+    thing.sector() = new_sector;
 }
 
 void gorc::game::world::level_presenter::attach_thing_to_thing(thing_id tid, thing_id base_id) {
@@ -791,18 +961,18 @@ void gorc::game::world::level_presenter::attach_thing_to_thing(thing_id tid, thi
 
     thing.attach_flags = flag_set<flags::attach_flag> { flags::attach_flag::AttachedToThing };
     thing.attached_thing = base_id;
-    thing.prev_attached_thing_position = base.position;
+    thing.prev_attached_thing_position = base.position();
 }
 
 gorc::thing_id gorc::game::world::level_presenter::create_thing_at_thing(thing_template_id tpl_id, thing_id tid) {
     components::thing& referencedThing = model->get_thing(tid);
-    thing_id new_thing_id = create_thing(tpl_id, referencedThing.sector, referencedThing.position, referencedThing.orient);
+    thing_id new_thing_id = create_thing(tpl_id, referencedThing.sector(), referencedThing.position(), referencedThing.orient());
     components::thing& new_thing = model->get_thing(new_thing_id);
 
     new_thing.path_moving = false;
 
     maybe_if(new_thing.model_3d, [&](auto model) {
-        this->adjust_thing_pos(new_thing_id, new_thing.position + model->insert_offset);
+        this->adjust_thing_pos(new_thing_id, new_thing.position() + model->insert_offset);
     });
 
     // CreateThingAtThing really does copy frames.
@@ -860,7 +1030,7 @@ void gorc::game::world::level_presenter::detach_thing(thing_id tid) {
 
 gorc::vector<3> gorc::game::world::level_presenter::get_thing_pos(thing_id tid) {
     components::thing& referenced_thing = model->get_thing(tid);
-    return referenced_thing.position;
+    return referenced_thing.position();
 }
 
 void gorc::game::world::level_presenter::heal_thing(thing_id tid, float amount) {
@@ -871,9 +1041,9 @@ void gorc::game::world::level_presenter::heal_thing(thing_id tid, float amount)
 bool gorc::game::world::level_presenter::is_thing_moving(thing_id tid) {
     // TODO: Temporary hack implementation pending new physics implementation.
     components::thing& referencedThing = model->get_thing(tid);
-    switch(referencedThing.move) {
+    switch(referencedThing.move()) {
     case flags::move_type::physics:
-        return length(referencedThing.vel) > 0.0000001f;
+        return length(referencedThing.vel()) > 0.0000001f;
 
     case flags::move_type::Path:
         return referencedThing.path_moving || referencedThing.rotatepivot_moving;
@@ -885,7 +1055,7 @@ bool gorc::game::world::level_presenter::is_thing_moving(thing_id tid) {
 
 gorc::vector<3, float> gorc::game::world::level_presenter::get_thing_lvec(thing_id tid) {
     const auto& thing = model->get_thing(tid);
-    return thing.orient.transform(make_vector(0.0f, 1.0f, 0.0f));
+    return thing.orient().transform(make_vector(0.0f, 1.0f, 0.0f));
 }
 
 // thing flags verbs
@@ -902,15 +1072,15 @@ void gorc::game::world::level_presenter::set_actor_flags(thing_id tid, flag_set<
 }
 
 void gorc::game::world::level_presenter::clear_thing_flags(thing_id tid, flag_set<flags::thing_flag> flags) {
-    model->get_thing(tid).flags -= flags;
+    model->get_thing(tid).flags() -= flags;
 }
 
 gorc::flag_set<gorc::flags::thing_flag> gorc::game::world::level_presenter::get_thing_flags(thing_id tid) {
-    return model->get_thing(tid).flags;
+    return model->get_thing(tid).flags();
 }
 
 void gorc::game::world::level_presenter::set_thing_flags(thing_id tid, flag_set<flags::thing_flag> flags) {
-    model->get_thing(tid).flags += flags;
+    model->get_thing(tid).flags() += flags;
 }
 
 void gorc::game::world::level_presenter::clear_thing_attach_flags(thing_id tid, flag_set<flags::attach_flag> flags) {
@@ -943,7 +1113,7 @@ gorc::thing_id gorc::game::world::level_presenter::get_thing_parent(thing_id tid
 }
 
 gorc::sector_id gorc::game::world::level_presenter::get_thing_sector(thing_id tid) {
-    return model->get_thing(tid).sector;
+    return model->get_thing(tid).sector();
 }
 
 gorc::flags::thing_type gorc::game::world::level_presenter::get_thing_type(thing_id tid) {
@@ -961,8 +1131,8 @@ void gorc::game::world::level_presenter::set_thing_light(thing_id tid, float lig
 void gorc::game::world::level_presenter::stop_thing(thing_id thing) {
     auto& t = model->get_thing(thing);
 
-    t.vel = make_zero_vector<3, float>();
-    t.thrust = make_zero_vector<3, float>();
+    t.vel() = make_zero_vector<3, float>();
+    t.thrust() = make_zero_vector<3, float>();
     t.ang_vel = make_zero_vector<3, float>();
     t.rot_thrust = make_zero_vector<3, float>();
 }
@@ -1401,12 +1571,12 @@ void gorc::game::world::level_presenter::register_verbs(cog::verb_table &verbs,
 
     verbs.add_safe_verb("applyforce", cog::value(), [&components](thing_id tid, vector<3> force) {
         // TODO: Proper implementation
-        components.current_level_presenter->model->get_thing(tid).vel += force;
+        components.current_level_presenter->model->get_thing(tid).vel() += force;
     });
 
     verbs.add_safe_verb("getthingthrust", 0.0f, [&components](thing_id tid) {
         // TODO: Proper implementation
-        return components.current_level_presenter->model->get_thing(tid).thrust;
+        return components.current_level_presenter->model->get_thing(tid).thrust();
     });
 
     // weapon verbs
@@ -15,8 +15,11 @@
 #include "components/thing.hpp"
 #include "content/id.hpp"
 #include "jk/cog/script/verb_table.hpp"
+#include "replay/input_command.hpp"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <stack>
 #include <set>
 #include <unordered_map>
@@ -34,8 +37,26 @@ namespace keys { class key_presenter; }
 namespace physics { class physics_presenter; }
 namespace sounds { class sound_presenter; }
 
+namespace replay {
+class input_recorder;
+}
+
 class level_model;
 
+// Accumulated wall-clock time spent in each subsystem by level_presenter::update.
+class level_update_timings {
+public:
+    using duration = std::chrono::steady_clock::duration;
+
+    duration physics = duration::zero();
+    duration camera = duration::zero();
+    duration sounds = duration::zero();
+    duration keys = duration::zero();
+    duration inventory = duration::zero();
+    duration scripts = duration::zero();
+    duration ecs = duration::zero();
+};
+
 class level_presenter : public gorc::place::presenter {
 private:
     // Scratch space
@@ -45,6 +66,12 @@ private:
     level_place place;
     event_bus* eventbus;
 
+    std::mutex input_queue_lock;
+    std::vector<replay::input_command> input_queue;
+    std::vector<replay::input_command> input_queue_scratch;
+
+    void apply_queued_input();
+
     void initialize_world();
 
     void update_thing_sector(thing_id, components::thing& thing, const vector<3>& oldThingPosition);
@@ -60,12 +87,35 @@ public:
     std::unique_ptr<inventory::inventory_presenter> inventory_presenter;
     std::unique_ptr<camera::camera_presenter> camera_presenter;
 
+    // When set, update() adds the time taken by each subsystem to these timings.
+    level_update_timings* update_timings = nullptr;
+
+    // When set, update() publishes the model's render state at the end of each tick.
+    bool publish_render_snapshots = false;
+
+    // Seeds every random source in the simulation. Set before start().
+    uint32_t random_seed;
+
+    // When set, input submitted to the level is written to this recorder.
+    replay::input_recorder* input_recorder = nullptr;
+
+    // When set, a recording drives the level and submitted input is ignored.
+    bool replaying = false;
+
+    // When set, submitted input is queued and applied at the start of the
+    // next update, so input can be submitted while another thread updates.
+    bool queue_input = false;
+
     level_presenter(level_state& components, const level_place& place);
     ~level_presenter();
 
     void start(event_bus& eventBus);
     void update(const gorc::time& time);
 
+    // Player input from the keyboard, mouse and view.
+    void submit_input(const replay::input_command& cmd);
+    void apply_input(const replay::input_command& cmd);
+
     void translate_camera(const vector<3>& amt);
     void yaw_camera(double amt);
     void pitch_camera(double amt);
@@ -0,0 +1,345 @@
+#include "level_snapshot.hpp"
+#include "level_model.hpp"
+#include "io/memory_file.hpp"
+#include "io/native_file.hpp"
+#include "profile/profiler.hpp"
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+
+class clock_state {
+public:
+    double level_time;
+    double game_time;
+    gorc::color_rgb dynamic_tint;
+};
+
+class body_state {
+public:
+    gorc::quaternion<float> orient;
+    gorc::vector<3> position;
+    gorc::vector<3> vel;
+    gorc::vector<3> thrust;
+    int sector;
+    gorc::flag_set<gorc::flags::thing_flag> flags;
+    gorc::flags::move_type move;
+    bool live;
+};
+
+class thing_state {
+public:
+    gorc::vector<3> ang_vel;
+    gorc::vector<3> rot_thrust;
+    float health;
+    float head_pitch;
+    float timer;
+    float time_alive;
+    float path_move_time;
+    float saber_drawn_length;
+    int current_frame;
+    int goal_frame;
+    gorc::flag_set<gorc::flags::actor_flag> actor_flags;
+    gorc::flag_set<gorc::flags::physics_flag> physics_flags;
+    gorc::flag_set<gorc::flags::jk_flag> jk_flags;
+    gorc::flag_set<gorc::flags::ai_mode_flag> ai_mode_flags;
+    bool path_moving;
+    bool live;
+};
+
+class surface_state {
+public:
+    gorc::vector<3> thrust;
+    gorc::vector<2> texture_offset;
+    float extra_light;
+    int cel_number;
+    gorc::flag_set<gorc::flags::surface_flag> flags;
+};
+
+class sector_state {
+public:
+    gorc::color_rgb tint;
+    gorc::vector<3> thrust;
+    float extra_light;
+    gorc::flag_set<gorc::flags::sector_flag> flags;
+};
+
+uint32_t region_id(gorc::game::world::level_snapshot_region region, size_t index = 0) {
+    return static_cast<uint32_t>(region) + static_cast<uint32_t>(index);
+}
+
+template <typename StateT>
+StateT* reserve_states(gorc::snapshot_image &image, uint32_t id, size_t count) {
+    static_assert(std::is_trivially_copyable<StateT>::value, "snapshot state must be trivially copyable");
+
+    // Padding is cleared so that unchanged state compares equal between captures.
+    auto bytes = image.reserve_region(id, count * sizeof(StateT));
+    std::memset(bytes.data(), 0, bytes.size());
+    return reinterpret_cast<StateT*>(bytes.data());
+}
+
+template <typename StateT>
+StateT const* get_states(gorc::snapshot_image const &image, uint32_t id, size_t &count) {
+    auto bytes = image.get_region(id);
+    if(bytes.size() % sizeof(StateT) != 0) {
+        LOG_FATAL(gorc::format("snapshot region %d has an unexpected size") % id);
+    }
+
+    count = bytes.size() / sizeof(StateT);
+    return reinterpret_cast<StateT const*>(bytes.data());
+}
+
+// Cog state is stored in its binary serialization format.
+template <typename SerializeFn>
+void set_serialized_region(gorc::snapshot_image &image, uint32_t id, SerializeFn serialize) {
+    gorc::memory_file mf;
+    {
+        gorc::binary_output_stream bos(mf);
+        serialize(bos);
+    }
+
+    image.set_region(id, gorc::make_span(mf.data(), mf.size()));
+}
+
+template <typename DeserializeFn>
+void read_serialized_region(gorc::snapshot_image const &image, uint32_t id, DeserializeFn deserialize) {
+    auto bytes = image.get_region(id);
+
+    gorc::memory_file mf;
+    mf.write(bytes.data(), bytes.size());
+
+    gorc::memory_file::reader mr(mf);
+    gorc::binary_input_stream bis(mr);
+    deserialize(bis);
+}
+
+}
+
+void gorc::game::world::capture_level_snapshot(level_model &model, snapshot_image &image) {
+    PROFILE_ZONE("level snapshot");
+
+    using region = level_snapshot_region;
+
+    image.clear();
+
+    auto *clocks = reserve_states<clock_state>(image, region_id(region::clocks), 1);
+    clocks->level_time = model.level_time;
+    clocks->game_time = model.game_time;
+    clocks->dynamic_tint = model.dynamic_tint;
+
+    size_t thing_count = model.thing_bodies.size();
+
+    auto *bodies = reserve_states<body_state>(image, region_id(region::thing_bodies), thing_count);
+    for(auto const &body_pair : model.thing_bodies) {
+        auto const &body = *body_pair.second;
+        auto &state = bodies[static_cast<size_t>(static_cast<int>(body_pair.first))];
+        state.orient = body.orient;
+        state.position = body.position;
+        state.vel = body.vel;
+        state.thrust = body.thrust;
+        state.sector = static_cast<int>(body.sector);
+        state.flags = body.flags;
+        state.move = body.move;
+        state.live = true;
+    }
+
+    auto *things = reserve_states<thing_state>(image, region_id(region::things), thing_count);
+    for(auto const &thing_pair : model.ecs.all_components<components::thing>()) {
+        size_t index = static_cast<size_t>(static_cast<int>(thing_pair.first));
+        if(index >= thing_count) {
+            continue;
+        }
+
+        auto const &thing = *thing_pair.second;
+        auto &state = things[index];
+        state.ang_vel = thing.ang_vel;
+        state.rot_thrust = thing.rot_thrust;
+        state.health = thing.health;
+        state.head_pitch = thing.head_pitch;
+        state.timer = thing.timer;
+        state.time_alive = thing.time_alive;
+        state.path_move_time = thing.path_move_time;
+        state.saber_drawn_length = thing.saber_drawn_length;
+        state.current_frame = thing.current_frame;
+        state.goal_frame = thing.goal_frame;
+        state.actor_flags = thing.actor_flags;
+        state.physics_flags = thing.physics_flags;
+        state.jk_flags = thing.jk_flags;
+        state.ai_mode_flags = thing.ai_mode_flags;
+        state.path_moving = thing.path_moving;
+        state.live = true;
+    }
+
+    auto *surfaces = reserve_states<surface_state>(image, region_id(region::surfaces), model.surfaces.size());
+    for(size_t i = 0; i < model.surfaces.size(); ++i) {
+        auto const &surface = model.surfaces[i];
+        auto &state = surfaces[i];
+        state.thrust = surface.thrust;
+        state.texture_offset = surface.texture_offset;
+        state.extra_light = surface.extra_light;
+        state.cel_number = surface.cel_number;
+        state.flags = surface.flags;
+    }
+
+    auto *sectors = reserve_states<sector_state>(image, region_id(region::sectors), model.sectors.size());
+    for(size_t i = 0; i < model.sectors.size(); ++i) {
+        auto const &sector = model.sectors[i];
+        auto &state = sectors[i];
+        state.tint = sector.tint;
+        state.thrust = sector.thrust;
+        state.extra_light = sector.extra_light;
+        state.flags = sector.flags;
+    }
+
+    auto &script_model = model.script_model;
+
+    set_serialized_region(image, region_id(region::cog_globals), [&](auto &bos) {
+        script_model.get_globals().binary_serialize_object(bos);
+    });
+
+    set_serialized_region(image, region_id(region::cog_schedule), [&](auto &bos) {
+        script_model.binary_serialize_schedule(bos);
+    });
+
+    size_t instance_index = 0;
+    for(auto const &inst : script_model.get_instances()) {
+        set_serialized_region(image, region_id(region::cog_instances, instance_index), [&](auto &bos) {
+            inst->memory.binary_serialize_object(bos);
+        });
+
+        ++instance_index;
+    }
+}
+
+void gorc::game::world::restore_level_snapshot(level_model &model, snapshot_image const &image) {
+    PROFILE_ZONE("level snapshot restore");
+
+    using region = level_snapshot_region;
+
+    size_t clock_count = 0;
+    auto const *clocks = get_states<clock_state>(image, region_id(region::clocks), clock_count);
+    if(clock_count != 1) {
+        LOG_FATAL("snapshot does not contain a level");
+    }
+
+    size_t surface_count = 0;
+    auto const *surfaces = get_states<surface_state>(image, region_id(region::surfaces), surface_count);
+
+    size_t sector_count = 0;
+    auto const *sectors = get_states<sector_state>(image, region_id(region::sectors), sector_count);
+
+    size_t instance_count = 0;
+    while(image.has_region(region_id(region::cog_instances, instance_count))) {
+        ++instance_count;
+    }
+
+    auto instances = model.script_model.get_instances();
+    size_t level_instance_count = static_cast<size_t>(std::distance(instances.begin(), instances.end()));
+
+    if(surface_count != model.surfaces.size() ||
+       sector_count != model.sectors.size() ||
+       instance_count > level_instance_count) {
+        LOG_FATAL("snapshot was captured from a different level");
+    }
+
+    model.level_time = clocks->level_time;
+    model.game_time = clocks->game_time;
+    model.dynamic_tint = clocks->dynamic_tint;
+
+    size_t body_count = 0;
+    auto const *bodies = get_states<body_state>(image, region_id(region::thing_bodies), body_count);
+    for(auto const &body_pair : model.thing_bodies) {
+        size_t index = static_cast<size_t>(static_cast<int>(body_pair.first));
+        if(index >= body_count || !bodies[index].live) {
+            continue;
+        }
+
+        auto &body = *body_pair.second;
+        auto const &state = bodies[index];
+        body.orient = state.orient;
+        body.position = state.position;
+        body.vel = state.vel;
+        body.thrust = state.thrust;
+        body.sector = sector_id(state.sector);
+        body.flags = state.flags;
+        body.move = state.move;
+    }
+
+    size_t thing_count = 0;
+    auto const *things = get_states<thing_state>(image, region_id(region::things), thing_count);
+    for(auto &thing_pair : model.ecs.all_components<components::thing>()) {
+        size_t index = static_cast<size_t>(static_cast<int>(thing_pair.first));
+        if(index >= thing_count || !things[index].live) {
+            continue;
+        }
+
+        auto &thing = *thing_pair.second;
+        auto const &state = things[index];
+        thing.ang_vel = state.ang_vel;
+        thing.rot_thrust = state.rot_thrust;
+        thing.health = state.health;
+        thing.head_pitch = state.head_pitch;
+        thing.timer = state.timer;
+        thing.time_alive = state.time_alive;
+        thing.path_move_time = state.path_move_time;
+        thing.saber_drawn_length = state.saber_drawn_length;
+        thing.current_frame = state.current_frame;
+        thing.goal_frame = state.goal_frame;
+        thing.actor_flags = state.actor_flags;
+        thing.physics_flags = state.physics_flags;
+        thing.jk_flags = state.jk_flags;
+        thing.ai_mode_flags = state.ai_mode_flags;
+        thing.path_moving = state.path_moving;
+    }
+
+    for(size_t i = 0; i < surface_count; ++i) {
+        auto &surface = model.surfaces[i];
+        auto const &state = surfaces[i];
+        surface.thrust = state.thrust;
+        surface.texture_offset = state.texture_offset;
+        surface.extra_light = state.extra_light;
+        surface.cel_number = state.cel_number;
+        surface.flags = state.flags;
+    }
+
+    for(size_t i = 0; i < sector_count; ++i) {
+        auto &sector = model.sectors[i];
+        auto const &state = sectors[i];
+        sector.tint = state.tint;
+        sector.thrust = state.thrust;
+        sector.extra_light = state.extra_light;
+        sector.flags = state.flags;
+    }
+
+    auto &script_model = model.script_model;
+
+    read_serialized_region(image, region_id(region::cog_globals), [&](auto &bis) {
+        script_model.get_globals() = cog::heap(deserialization_constructor, bis);
+    });
+
+    for(size_t i = 0; i < instance_count; ++i) {
+        read_serialized_region(image, region_id(region::cog_instances, i), [&](auto &bis) {
+            script_model.get_instance(cog_id(static_cast<int>(i))).memory =
+                cog::heap(deserialization_constructor, bis);
+        });
+    }
+
+    read_serialized_region(image, region_id(region::cog_schedule), [&](auto &bis) {
+        script_model.restore_schedule(bis);
+    });
+}
+
+void gorc::game::world::restore_level_snapshot(level_model &model, path const &filename) {
+    diagnostic_context dc(filename.generic_string().c_str());
+
+    auto f = make_native_read_only_file(filename);
+    binary_input_stream bis(*f, binary_stream_buffer_size);
+
+    snapshot_image image;
+    if(image.apply_records(bis) == 0) {
+        LOG_FATAL("snapshot file is empty");
+    }
+
+    restore_level_snapshot(model, image);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "io/path.hpp"
+#include "io/snapshot_image.hpp"
+#include <cstdint>
+
+namespace gorc {
+namespace game {
+namespace world {
+
+class level_model;
+
+// Regions of a level snapshot. Each cog instance heap is a region of its
+// own, numbered from cog_instances in instance order.
+enum class level_snapshot_region : uint32_t {
+    clocks = 0,
+    thing_bodies = 1,
+    things = 2,
+    surfaces = 3,
+    sectors = 4,
+    cog_globals = 5,
+    cog_schedule = 6,
+    cog_instances = 0x100
+};
+
+// Copies the changing part of the level into the image: clocks, thing
+// bodies and thing state, surface and sector state, cog heaps, and the cog
+// schedule (sleeping and waiting continuations, pulses and timers). State is
+// laid out in arrays indexed by id, so state that did not change between
+// captures lands on the same snapshot pages. Cog state is kept in its binary
+// serialization format.
+//
+// Presenter state is not captured: inventory, sound channels, camera and key
+// animation mixes.
+void capture_level_snapshot(level_model &model, snapshot_image &image);
+
+// Copies captured state back into the level it was captured from, loaded
+// afresh or already running. Things are matched by id, and things created or
+// destroyed since the capture are left as they are. Like the executor's own
+// serialization, cog string values refer to the loaded scripts.
+void restore_level_snapshot(level_model &model, snapshot_image const &image);
+
+// Restores the last snapshot written to the file.
+void restore_level_snapshot(level_model &model, path const &filename);
+
+}
+}
+}
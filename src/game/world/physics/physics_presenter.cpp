@@ -103,17 +103,18 @@ void physics_presenter::physics_calculate_broadphase(double dt) {
     physics_broadphase_sector_things.clear();
 
     // Calculate influence AABBs and record overlapping sectors.
-    for(const auto& thing_pair : model->ecs.all_components<components::thing>()) {
-        const auto& thing = *thing_pair.second;
-        thing_id tid = thing_pair.first;
+    // Only needs simulation state. Walk thing bodies in id order.
+    for(const auto& body_pair : model->thing_bodies) {
+        const auto& body = *body_pair.second;
+        thing_id tid = body_pair.first;
 
-        auto thing_off_v = make_vector(1.0f, 1.0f, 1.0f) * (thing.move_size + length(thing.vel) * static_cast<float>(dt));
-        auto thing_aabb = make_box(thing.position - thing_off_v, thing.position + thing_off_v);
+        auto thing_off_v = make_vector(1.0f, 1.0f, 1.0f) * (body.move_size + length(body.vel) * static_cast<float>(dt));
+        auto thing_aabb = make_box(body.position - thing_off_v, body.position + thing_off_v);
 
         physics_thing_closed_set.clear();
         physics_thing_open_set.clear();
 
-        physics_thing_open_set.push_back(thing.sector);
+        physics_thing_open_set.push_back(body.sector);
 
         while(!physics_thing_open_set.empty()) {
             sector_id sid = physics_thing_open_set.back();
@@ -256,7 +257,7 @@ void physics_presenter::physics_find_thing_resting_manifolds(const physics::sphe
         }
 
         // Skip things too far away
-        auto vec_to = sphere.position - col_thing.position;
+        auto vec_to = sphere.position - col_thing.position();
         auto vec_to_len = length(vec_to);
         if(vec_to_len > (col_thing.size + sphere.radius)) {
             continue;
@@ -268,13 +269,13 @@ void physics_presenter::physics_find_thing_resting_manifolds(const physics::sphe
                 if(thing_needs_collision_response(current_thing_id, col_thing_id)) {
                     // Find contact point velocity:
                     vector<3> contact_normal = vec_to / vec_to_len;
-                    vector<3> contact_point = col_thing.position + contact_normal * col_thing.size;
+                    vector<3> contact_point = col_thing.position() + contact_normal * col_thing.size;
 
                     vector<3> contact_point_vel = make_zero_vector<3, float>();
-                    if(col_thing.move == flags::move_type::physics) {
-                        contact_point_vel = col_thing.vel;
+                    if(col_thing.move() == flags::move_type::physics) {
+                        contact_point_vel = col_thing.vel();
                     }
-                    else if(col_thing.move == flags::move_type::Path) {
+                    else if(col_thing.move() == flags::move_type::Path) {
                         contact_point_vel = get_thing_path_moving_point_velocity(col_thing_id, contact_point);
                     }
 
@@ -294,7 +295,7 @@ void physics_presenter::physics_find_thing_resting_manifolds(const physics::sphe
             physics_anim_node_visitor.sphere = sphere;
             physics_anim_node_visitor.visited_thing_id = col_thing_id;
             physics_anim_node_visitor.moving_thing_id = current_thing_id;
-            presenter.key_presenter->visit_mesh_hierarchy(physics_anim_node_visitor, col_thing.model_3d.get_value(), col_thing.position, col_thing.orient, col_thing_id, /* is pov */ false);
+            presenter.key_presenter->visit_mesh_hierarchy(physics_anim_node_visitor, col_thing.model_3d.get_value(), col_thing.position(), col_thing.orient(), col_thing_id, /* is pov */ false);
         }
     }
 }
@@ -314,7 +315,7 @@ void physics_presenter::compute_current_velocity(components::thing &thing,
     }
 
     if((thing.physics_flags & flags::physics_flag::has_gravity) && static_cast<int>(thing.attach_flags) == 0) {
-        thing.vel = thing.vel + make_vector(0.0f, 0.0f, -1.0f) * model->header.world_gravity * static_cast<float>(dt);
+        thing.vel() = thing.vel() + make_vector(0.0f, 0.0f, -1.0f) * model->header.world_gravity * static_cast<float>(dt);
     }
 
     // TODO: Linear thrust
@@ -328,7 +329,7 @@ void physics_presenter::compute_current_velocity(components::thing &thing,
 
     // TODO: Confirm that flag 0x200 is correctly documented.
     //if(thing.physics_flags & flags::physics_flag::uses_rotational_velocity) {
-    thing.orient *= make_euler(thing.ang_vel * static_cast<float>(dt));
+    thing.orient() *= make_euler(thing.ang_vel * static_cast<float>(dt));
     //}
 }
 
@@ -337,9 +338,9 @@ void physics_presenter::compute_thing_attachment_velocity(components::thing &thi
     if((thing.attach_flags & flags::attach_flag::AttachedToThing) ||
        (thing.attach_flags & flags::attach_flag::AttachedToThingFace)) {
         const auto& parent_thing = model->get_thing(thing.attached_thing.get_value());
-        thing.attached_thing_velocity = (parent_thing.position - thing.prev_attached_thing_position) /
+        thing.attached_thing_velocity = (parent_thing.position() - thing.prev_attached_thing_position) /
                                         static_cast<float>(dt);
-        thing.prev_attached_thing_position = parent_thing.position;
+        thing.prev_attached_thing_position = parent_thing.position();
     }
 }
 
@@ -360,13 +361,13 @@ void physics_presenter::physics_thing_step(thing_id tid, components::thing& thin
     // Do sphere collision:
 
     physics_thing_resting_manifolds.clear();
-    physics_find_sector_resting_manifolds(physics::sphere(thing.position, thing.size),
-                                          thing.sector,
-                                          thing.vel,
+    physics_find_sector_resting_manifolds(physics::sphere(thing.position(), thing.size),
+                                          thing.sector(),
+                                          thing.vel(),
                                           tid);
-    physics_find_thing_resting_manifolds(physics::sphere(thing.position, thing.size), thing.vel, tid);
+    physics_find_thing_resting_manifolds(physics::sphere(thing.position(), thing.size), thing.vel(), tid);
 
-    vector<3> prev_thing_vel = thing.vel;
+    vector<3> prev_thing_vel = thing.vel();
 
     bool influenced_by_manifolds = false;
 
@@ -442,12 +443,12 @@ void physics_presenter::physics_thing_step(thing_id tid, components::thing& thin
     }
     else {
         if(!reject_vel) {
-            thing.vel = prev_thing_vel;
+            thing.vel() = prev_thing_vel;
             presenter.adjust_thing_pos(tid,
-                                       thing.position + prev_thing_vel * static_cast<float>(dt));
+                                       thing.position() + prev_thing_vel * static_cast<float>(dt));
         }
         else {
-            thing.vel = make_zero_vector<3, float>();
+            thing.vel() = make_zero_vector<3, float>();
             return;
         }
     }
@@ -477,7 +478,7 @@ void physics_presenter::physics_thing_step(thing_id tid, components::thing& thin
 }
 
 void physics_presenter::update_thing_path_moving(thing_id tid, components::thing& thing, double dt) {
-    if(thing.move != flags::move_type::Path || thing.is_blocked || thing.path_moving_paused) {
+    if(thing.move() != flags::move_type::Path || thing.is_blocked || thing.path_moving_paused) {
         return;
     }
 
@@ -486,7 +487,7 @@ void physics_presenter::update_thing_path_moving(thing_id tid, components::thing
         vector<3> targetPosition = std::get<0>(target_position_tuple);
         auto targetOrientation = make_euler(std::get<1>(target_position_tuple));
 
-        vector<3> currentPosition = thing.position;
+        vector<3> currentPosition = thing.position();
 
         // PathMoveSpeed seems to be some factor of distance per frame, and Jedi has a different framerate.
         // Use a magic multiple to correct it.
@@ -494,7 +495,7 @@ void physics_presenter::update_thing_path_moving(thing_id tid, components::thing
         float alpha = static_cast<float>(rate_factor * dt) * thing.path_move_speed / dist_len;
         if(alpha >= 1.0f || dist_len <= 0.0f) {
             presenter.adjust_thing_pos(tid, targetPosition);
-            thing.orient = targetOrientation;
+            thing.orient() = targetOrientation;
 
             // Arrived at next frame. Advance to next.
             thing.current_frame = thing.next_frame;
@@ -517,8 +518,8 @@ void physics_presenter::update_thing_path_moving(thing_id tid, components::thing
             }
         }
         else {
-            presenter.adjust_thing_pos(tid, lerp(thing.position, targetPosition, alpha));
-            thing.orient = slerp(thing.orient, targetOrientation, alpha);
+            presenter.adjust_thing_pos(tid, lerp(thing.position(), targetPosition, alpha));
+            thing.orient() = slerp(thing.orient(), targetOrientation, alpha);
         }
     }
     else if(thing.rotatepivot_moving) {
@@ -536,9 +537,9 @@ void physics_presenter::update_thing_path_moving(thing_id tid, components::thing
             }
 
             auto angle = make_euler(frame_orient * (thing.path_move_speed - thing.path_move_time + static_cast<float>(dt)) / thing.path_move_speed);
-            auto new_pos = angle.transform(thing.position - frame_pos) + frame_pos;
+            auto new_pos = angle.transform(thing.position() - frame_pos) + frame_pos;
 
-            thing.orient = angle * thing.orient;
+            thing.orient() = angle * thing.orient();
             presenter.adjust_thing_pos(tid, new_pos);
 
             presenter.sound_presenter->stop_foley_loop(thing_id(tid));
@@ -559,9 +560,9 @@ void physics_presenter::update_thing_path_moving(thing_id tid, components::thing
 
             auto angle = make_euler(frame_orient * alpha);
 
-            auto new_pos = angle.transform(thing.position - frame_pos) + frame_pos;
+            auto new_pos = angle.transform(thing.position() - frame_pos) + frame_pos;
 
-            thing.orient = angle * thing.orient;
+            thing.orient() = angle * thing.orient();
             presenter.adjust_thing_pos(tid, new_pos);
 
             thing.path_move_time += static_cast<float>(dt);
@@ -572,21 +573,21 @@ void physics_presenter::update_thing_path_moving(thing_id tid, components::thing
 gorc::vector<3> physics_presenter::get_thing_path_moving_point_velocity(thing_id tid, const vector<3>& rel_point) {
     auto& thing = model->get_thing(tid);
 
-    if(thing.move == flags::move_type::Path && thing.path_moving && !thing.is_blocked && !thing.path_moving_paused) {
+    if(thing.move() == flags::move_type::Path && thing.path_moving && !thing.is_blocked && !thing.path_moving_paused) {
         auto target_position_tuple = thing.frames[thing.next_frame];
         vector<3> targetPosition = std::get<0>(target_position_tuple);
         auto targetOrientation = make_euler(std::get<1>(target_position_tuple));
 
-        vector<3> currentPosition = thing.position;
-        auto currentOrientation = thing.orient;
+        vector<3> currentPosition = thing.position();
+        auto currentOrientation = thing.orient();
 
         // PathMoveSpeed seems to be some factor of distance per frame, and Jedi has a different framerate.
         // Use a magic multiple to correct it.
         float dist_len = length(targetPosition - currentPosition);
         float alpha = static_cast<float>(rate_factor) * thing.path_move_speed / dist_len;
 
-        auto delta_position = lerp(thing.position, targetPosition, alpha);
-        auto delta_orientation = slerp(thing.orient, targetOrientation, alpha);
+        auto delta_position = lerp(thing.position(), targetPosition, alpha);
+        auto delta_orientation = slerp(thing.orient(), targetOrientation, alpha);
 
         // Rotate rel_point into object space
         auto rel_point_rotated = (
@@ -598,15 +599,15 @@ gorc::vector<3> physics_presenter::get_thing_path_moving_point_velocity(thing_id
                 ).transform(rel_point_rotated) - rel_point;
         return rel_v;
     }
-    else if(thing.move == flags::move_type::Path && thing.rotatepivot_moving && !thing.is_blocked && !thing.path_moving_paused) {
+    else if(thing.move() == flags::move_type::Path && thing.rotatepivot_moving && !thing.is_blocked && !thing.path_moving_paused) {
         vector<3> frame_pos, frame_orient;
         std::tie(frame_pos, frame_orient) = thing.frames[thing.goal_frame];
         auto angle = make_euler(frame_orient / thing.path_move_speed);
 
-        auto obj_space_rel_point = rel_point - thing.position;
+        auto obj_space_rel_point = rel_point - thing.position();
         obj_space_rel_point = angle.transform(obj_space_rel_point);
 
-        auto pivot_space_rel_point = (obj_space_rel_point + thing.position) - frame_pos;
+        auto pivot_space_rel_point = (obj_space_rel_point + thing.position()) - frame_pos;
         pivot_space_rel_point = angle.transform(pivot_space_rel_point);
 
         auto new_rel_point = pivot_space_rel_point + frame_pos;
@@ -635,10 +636,10 @@ void physics_presenter::update(const gorc::time& time) {
 
     // - Compute current velocity from thrust, etc.
     for(auto &thing : model->ecs.all_components<components::thing>()) {
-        if(thing.second->move == flags::move_type::physics) {
+        if(thing.second->move() == flags::move_type::physics) {
             compute_current_velocity(*thing.second, dt);
             compute_thing_attachment_velocity(*thing.second, dt);
-            thing.second->vel += thing.second->attached_thing_velocity;
+            thing.second->vel() += thing.second->attached_thing_velocity;
         }
     }
 
@@ -657,13 +658,13 @@ void physics_presenter::update(const gorc::time& time) {
         double step_dt = dt;
         for(auto const &moving_thing_pair : make_range(thing_range_begin, thing_range_end)) {
             auto const &moving_thing = model->get_thing(moving_thing_pair.second);
-            auto moving_thing_vel_length = static_cast<double>(length(moving_thing.vel));
+            auto moving_thing_vel_length = static_cast<double>(length(moving_thing.vel()));
             if(moving_thing_vel_length <= 0.0) {
                 step_dt = std::min(step_dt, dt);
             }
             else {
-                double moving_thing_step = 0.5 * static_cast<double>(moving_thing.move_size) /
-                                           static_cast<double>(length(moving_thing.vel));
+                double moving_thing_step = 0.5 * static_cast<double>(moving_thing.move_size()) /
+                                           static_cast<double>(length(moving_thing.vel()));
                 step_dt = std::min(step_dt, moving_thing_step);
             }
         }
@@ -676,7 +677,7 @@ void physics_presenter::update(const gorc::time& time) {
 
             for(auto &moving_thing_pair : make_range(thing_range_begin, thing_range_end)) {
                 auto &moving_thing = model->get_thing(moving_thing_pair.second);
-                if(moving_thing.move == flags::move_type::physics) {
+                if(moving_thing.move() == flags::move_type::physics) {
                     physics_thing_step(moving_thing_pair.second,
                                        moving_thing,
                                        this_step_dt);
@@ -693,8 +694,8 @@ void physics_presenter::update(const gorc::time& time) {
 
     // - Remove thing attachment velocity.
     for(auto &thing : model->ecs.all_components<components::thing>()) {
-        if(thing.second->move == flags::move_type::physics) {
-            thing.second->vel -= thing.second->attached_thing_velocity;
+        if(thing.second->move() == flags::move_type::physics) {
+            thing.second->vel() -= thing.second->attached_thing_velocity;
         }
     }
 
@@ -707,8 +708,8 @@ void physics_presenter::update(const gorc::time& time) {
         }
         else if(thing.second->attach_flags & flags::attach_flag::AttachedToThing) {
             const auto& parent_thing = model->get_thing(thing.second->attached_thing.get_value());
-            presenter.adjust_thing_pos(thing.first, thing.second->position + (parent_thing.position - thing.second->prev_attached_thing_position));
-            thing.second->prev_attached_thing_position = parent_thing.position;
+            presenter.adjust_thing_pos(thing.first, thing.second->position() + (parent_thing.position() - thing.second->prev_attached_thing_position));
+            thing.second->prev_attached_thing_position = parent_thing.position();
         }
     }
 
@@ -717,18 +718,20 @@ void physics_presenter::update(const gorc::time& time) {
         thing_id tid;
         surface_id sid;
         std::tie(tid, sid) = touched_surface_pair;
-        eventbus->fire_event(events::touched_surface(tid, sid));
+        eventbus->queue_event(events::touched_surface(tid, sid));
     }
 
     for(const auto& touched_thing_pair : physics_touched_thing_pairs) {
         thing_id thing_a_id, thing_b_id;
         std::tie(thing_a_id, thing_b_id) = touched_thing_pair;
 
-        eventbus->fire_event(events::touched_thing(thing_a_id,
-                                                   thing_b_id));
-        eventbus->fire_event(events::touched_thing(thing_b_id,
-                                                   thing_a_id));
+        eventbus->queue_event(events::touched_thing(thing_a_id,
+                                                    thing_b_id));
+        eventbus->queue_event(events::touched_thing(thing_b_id,
+                                                    thing_a_id));
     }
+
+    eventbus->dispatch_queued_events();
 }
 
 physics_presenter::segment_query_node_visitor::segment_query_node_visitor(physics_presenter& presenter)
@@ -212,7 +212,7 @@ public:
             }
 
             if(col_thing.collide == flags::collide_type::sphere) {
-                auto maybe_int = segment_sphere_intersection(cam_segment, sphere(col_thing.position, col_thing.size));
+                auto maybe_int = segment_sphere_intersection(cam_segment, sphere(col_thing.position(), col_thing.size));
                 maybe_if(maybe_int, [&](vector<3> const &int_point) {
                     // Sphere intersected.
                     float col_dist = length(int_point - std::get<0>(cam_segment));
@@ -221,7 +221,7 @@ public:
                         has_contact = true;
                         closest_contact_surface_id = invalid_id;
                         closest_contact_thing_id = col_thing_id;
-                        closest_contact_normal = normalize(int_point - col_thing.position);
+                        closest_contact_normal = normalize(int_point - col_thing.position());
                         closest_contact_position = int_point;
                     }
                 });
@@ -234,8 +234,8 @@ public:
                 segment_query_anim_node_visitor.cam_segment = cam_segment;
                 segment_query_anim_node_visitor.closest_contact_distance = closest_contact_distance;
                 segment_query_anim_node_visitor.has_closest_contact = false;
-                presenter.key_presenter->visit_mesh_hierarchy(segment_query_anim_node_visitor, col_thing.model_3d.get_value(), col_thing.position,
-                        col_thing.orient, col_thing_id, /* is pov mix */ false);
+                presenter.key_presenter->visit_mesh_hierarchy(segment_query_anim_node_visitor, col_thing.model_3d.get_value(), col_thing.position(),
+                        col_thing.orient(), col_thing_id, /* is pov mix */ false);
 
                 if(segment_query_anim_node_visitor.has_closest_contact) {
                     closest_contact_distance = segment_query_anim_node_visitor.closest_contact_distance;
@@ -267,7 +267,7 @@ public:
     template <typename ThingP, typename SurfaceP> maybe<contact> thing_segment_query(thing_id current_thing_id, const vector<3>& direction,
             ThingP thing_p, SurfaceP surface_p, const maybe<contact>& previous_contact = maybe<contact>()) {
         const auto& current_thing = model->get_thing(current_thing_id);
-        return segment_query<ThingP, SurfaceP>(segment(current_thing.position, current_thing.position + direction), current_thing.sector, current_thing_id,
+        return segment_query<ThingP, SurfaceP>(segment(current_thing.position(), current_thing.position() + direction), current_thing.sector(), current_thing_id,
                 thing_p, surface_p, previous_contact);
     }
 
@@ -0,0 +1,211 @@
+#include "render_snapshot.hpp"
+#include "level_model.hpp"
+#include "keys/components/pov_key_mix.hpp"
+#include "math/util.hpp"
+
+namespace {
+
+// Objects that move further than this in one tick have been teleported,
+// and are drawn at their new position rather than interpolated.
+constexpr float teleport_distance_squared = 1.0f;
+
+gorc::vector<3> lerp_direction(const gorc::vector<3>& a, const gorc::vector<3>& b, float alpha) {
+    auto rv = gorc::lerp(a, b, alpha);
+    if(gorc::length_squared(rv) < 0.000001f) {
+        // Directions are opposed. Snap rather than pass through zero.
+        return b;
+    }
+
+    return gorc::normalize(rv);
+}
+
+}
+
+void gorc::game::world::render_frame::capture(level_model &model) {
+    camera = model.camera_model.current_computed_state;
+    dynamic_tint = model.dynamic_tint;
+    horizon_sky_offset = model.header.horizon_sky_offset;
+    ceiling_sky_offset = model.header.ceiling_sky_offset;
+    local_player = model.local_player_thing_id;
+
+    // Entries are reused from tick to tick, so capturing does not allocate
+    // once the level has settled.
+    for(auto& thing : things) {
+        thing.live = false;
+    }
+
+    for(const auto& thing_pair : model.ecs.all_components<components::thing>()) {
+        size_t index = static_cast<size_t>(static_cast<int>(thing_pair.first));
+        if(index >= things.size()) {
+            things.resize(index + 1);
+        }
+
+        const auto& src = *thing_pair.second;
+        auto& thing = things[index];
+        thing.position = src.position();
+        thing.orient = src.orient();
+        thing.live = true;
+
+        thing.sector = src.sector();
+        thing.flags = src.flags();
+        thing.jk_flags = src.jk_flags;
+
+        thing.model_3d = src.model_3d;
+        thing.pup = src.pup;
+        thing.spr = src.spr;
+        thing.weapon_mesh = src.weapon_mesh;
+
+        thing.saber_side_mat = src.saber_side_mat;
+        thing.saber_tip_mat = src.saber_tip_mat;
+        thing.saber_base_rad = src.saber_base_rad;
+        thing.saber_tip_rad = src.saber_tip_rad;
+        thing.saber_drawn_length = src.saber_drawn_length;
+
+        thing.head_pitch = src.head_pitch;
+        thing.timer = src.timer;
+        thing.time_alive = src.time_alive;
+
+        thing.light = src.light + ((src.actor_flags & flags::actor_flag::HasFieldlight) ? src.light_intensity : 0.0f);
+        thing.light_offset = src.light_offset;
+
+        thing.has_mix = false;
+        for(const auto& mix : model.ecs.find_component<keys::key_mix>(thing_pair.first)) {
+            thing.mix = *mix.second;
+            thing.has_mix = true;
+        }
+    }
+
+    has_pov_mix = false;
+    for(const auto& mix : model.ecs.find_component<keys::pov_key_mix>(local_player)) {
+        pov_mix = *mix.second;
+        has_pov_mix = true;
+    }
+
+    surfaces.resize(model.surfaces.size());
+    for(size_t i = 0; i < model.surfaces.size(); ++i) {
+        const auto& src = model.surfaces[i];
+        auto& surface = surfaces[i];
+        surface.texture_offset = src.texture_offset;
+        surface.material = src.material;
+        surface.cel_number = src.cel_number;
+        surface.extra_light = src.extra_light;
+        surface.flags = src.flags;
+        surface.face_type_flags = src.face_type_flags;
+        surface.geometry_mode = src.geometry_mode;
+    }
+
+    sectors.resize(model.sectors.size());
+    for(size_t i = 0; i < model.sectors.size(); ++i) {
+        const auto& src = model.sectors[i];
+        auto& sector = sectors[i];
+        sector.tint = src.tint;
+        sector.ambient_light = src.ambient_light;
+        sector.extra_light = src.extra_light;
+        sector.cmp = src.cmp;
+    }
+
+    adjoin_flags.resize(model.adjoins.size());
+    for(size_t i = 0; i < model.adjoins.size(); ++i) {
+        adjoin_flags[i] = model.adjoins[i].flags;
+    }
+}
+
+gorc::game::world::thing_render_state const* gorc::game::world::render_frame::get_thing(thing_id id) const {
+    size_t index = static_cast<size_t>(static_cast<int>(id));
+    if(index >= things.size() || !things[index].live) {
+        return nullptr;
+    }
+
+    return &things[index];
+}
+
+float gorc::game::world::render_snapshot::get_alpha(clock::time_point now) const {
+    if(timestep <= 0.0) {
+        return 1.0f;
+    }
+
+    double elapsed = std::chrono::duration<double>(now - published).count();
+    return static_cast<float>(clamp(elapsed / timestep, 0.0, 1.0));
+}
+
+gorc::game::world::camera::current_camera_state gorc::game::world::render_snapshot::get_camera(float alpha) const {
+    auto rv = current.camera;
+
+    if(length_squared(current.camera.position - previous.camera.position) < teleport_distance_squared) {
+        rv.position = lerp(previous.camera.position, current.camera.position, alpha);
+        rv.look = lerp_direction(previous.camera.look, current.camera.look, alpha);
+        rv.up = lerp_direction(previous.camera.up, current.camera.up, alpha);
+    }
+
+    return rv;
+}
+
+gorc::vector<3> gorc::game::world::render_snapshot::get_thing_position(thing_id id, float alpha,
+        const vector<3>& fallback) const {
+    size_t index = static_cast<size_t>(static_cast<int>(id));
+    if(index >= current.things.size() || !current.things[index].live) {
+        return fallback;
+    }
+
+    const auto& curr = current.things[index];
+    if(index >= previous.things.size() || !previous.things[index].live ||
+       length_squared(curr.position - previous.things[index].position) >= teleport_distance_squared) {
+        return curr.position;
+    }
+
+    return lerp(previous.things[index].position, curr.position, alpha);
+}
+
+gorc::quaternion<float> gorc::game::world::render_snapshot::get_thing_orient(thing_id id, float alpha,
+        const quaternion<float>& fallback) const {
+    size_t index = static_cast<size_t>(static_cast<int>(id));
+    if(index >= current.things.size() || !current.things[index].live) {
+        return fallback;
+    }
+
+    const auto& curr = current.things[index];
+    if(index >= previous.things.size() || !previous.things[index].live) {
+        return curr.orient;
+    }
+
+    return slerp(previous.things[index].orient, curr.orient, alpha);
+}
+
+gorc::vector<2> gorc::game::world::render_snapshot::get_surface_texture_offset(surface_id id, float alpha,
+        const vector<2>& fallback) const {
+    size_t index = static_cast<size_t>(static_cast<int>(id));
+    if(index >= current.surfaces.size() || index >= previous.surfaces.size()) {
+        return fallback;
+    }
+
+    return lerp(previous.surfaces[index].texture_offset, current.surfaces[index].texture_offset, alpha);
+}
+
+void gorc::game::world::render_snapshot_buffer::publish(level_model &model, double timestep) {
+    auto& snapshot = snapshots.back();
+
+    snapshot.current.capture(model);
+    if(has_last_frame) {
+        snapshot.previous = last_frame;
+    }
+    else {
+        snapshot.previous = snapshot.current;
+        has_last_frame = true;
+    }
+
+    last_frame = snapshot.current;
+
+    snapshot.timestep = timestep;
+    snapshot.published = render_snapshot::clock::now();
+
+    snapshots.publish();
+}
+
+gorc::game::world::render_snapshot const* gorc::game::world::render_snapshot_buffer::latest() {
+    has_front = snapshots.update() || has_front;
+    if(!has_front) {
+        return nullptr;
+    }
+
+    return &snapshots.front();
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "math/vector.hpp"
+#include "math/quaternion.hpp"
+#include "math/color.hpp"
+#include "content/id.hpp"
+#include "utility/triple_buffer.hpp"
+#include "camera/current_camera_state.hpp"
+#include "keys/components/key_mix.hpp"
+#include "libold/content/assets/template.hpp"
+#include "libold/content/assets/level_surface.hpp"
+#include "libold/content/flags/adjoin_flag.hpp"
+#include "libold/content/flags/jk_flag.hpp"
+#include <chrono>
+#include <vector>
+
+namespace gorc {
+namespace game {
+namespace world {
+
+class level_model;
+
+// Drawable state of a thing at the end of a simulation tick.
+class thing_render_state {
+public:
+    vector<3> position = make_zero_vector<3, float>();
+    quaternion<float> orient;
+    bool live = false;
+
+    sector_id sector;
+    flag_set<flags::thing_flag> flags;
+    flag_set<flags::jk_flag> jk_flags;
+
+    maybe<asset_ref<content::assets::model>> model_3d;
+    maybe<asset_ref<content::assets::puppet>> pup;
+    maybe<asset_ref<content::assets::sprite>> spr;
+    maybe<asset_ref<content::assets::model>> weapon_mesh;
+
+    maybe<asset_ref<material>> saber_side_mat;
+    maybe<asset_ref<material>> saber_tip_mat;
+    float saber_base_rad = 0.0f;
+    float saber_tip_rad = 0.0f;
+    float saber_drawn_length = 0.0f;
+
+    float head_pitch = 0.0f;
+    float timer = 0.0f;
+    float time_alive = 0.0f;
+
+    // Includes the field light, when the thing has one
+    float light = 0.0f;
+    vector<3> light_offset = make_zero_vector<3, float>();
+
+    bool has_mix = false;
+    keys::key_mix mix;
+};
+
+// Drawable state of a surface at the end of a simulation tick. Geometry does
+// not change during a level and is drawn from the level asset.
+class surface_render_state {
+public:
+    vector<2> texture_offset = make_zero_vector<2, float>();
+    int material = -1;
+    int cel_number = -1;
+    float extra_light = 0.0f;
+    flag_set<flags::surface_flag> flags;
+    flag_set<flags::face_flag> face_type_flags;
+    flags::geometry_mode geometry_mode = flags::geometry_mode::not_drawn;
+};
+
+// Lighting of a sector at the end of a simulation tick.
+class sector_render_state {
+public:
+    color_rgb tint = make_color(0.0f, 0.0f, 0.0f);
+    float ambient_light = 0.0f;
+    float extra_light = 0.0f;
+    maybe<asset_ref<colormap>> cmp;
+};
+
+// Everything the level view reads for one tick. Things, surfaces, sectors and
+// adjoins are indexed by id. The view reads nothing else from the level
+// model, so the simulation can run while a frame is drawn.
+class render_frame {
+public:
+    camera::current_camera_state camera;
+    std::vector<thing_render_state> things;
+    std::vector<surface_render_state> surfaces;
+    std::vector<sector_render_state> sectors;
+    std::vector<flag_set<flags::adjoin_flag>> adjoin_flags;
+    color_rgb dynamic_tint = make_color(0.0f, 0.0f, 0.0f);
+
+    vector<2> horizon_sky_offset = make_zero_vector<2, float>();
+    vector<2> ceiling_sky_offset = make_zero_vector<2, float>();
+
+    thing_id local_player;
+    bool has_pov_mix = false;
+    keys::key_mix pov_mix;
+
+    void capture(level_model &model);
+
+    thing_render_state const* get_thing(thing_id id) const;
+};
+
+// The two most recent simulation ticks. The renderer draws between them,
+// so motion stays smooth when frames and ticks are not in step.
+class render_snapshot {
+public:
+    using clock = std::chrono::steady_clock;
+
+    render_frame previous;
+    render_frame current;
+    clock::time_point published;
+    double timestep = 0.0;
+
+    // Fraction of the way from previous to current at the given time.
+    float get_alpha(clock::time_point now) const;
+
+    camera::current_camera_state get_camera(float alpha) const;
+    vector<3> get_thing_position(thing_id id, float alpha, vector<3> const &fallback) const;
+    quaternion<float> get_thing_orient(thing_id id, float alpha, quaternion<float> const &fallback) const;
+    vector<2> get_surface_texture_offset(surface_id id, float alpha, vector<2> const &fallback) const;
+};
+
+// Hands snapshots from the simulation thread to the render thread.
+class render_snapshot_buffer {
+private:
+    triple_buffer<render_snapshot> snapshots;
+    render_frame last_frame;
+    bool has_last_frame = false;
+    bool has_front = false;
+
+public:
+    // Simulation thread
+    void publish(level_model &model, double timestep);
+
+    // Render thread. Returns nullptr until the first snapshot is published.
+    render_snapshot const* latest();
+};
+
+}
+}
+}
@@ -0,0 +1,34 @@
+#include "input_command.hpp"
+
+gorc::game::world::replay::input_command::input_command(input_command_type type)
+    : type(type) {
+    return;
+}
+
+gorc::game::world::replay::input_command::input_command(input_command_type type, vector<3> const &direction)
+    : type(type), direction(direction) {
+    return;
+}
+
+gorc::game::world::replay::input_command::input_command(input_command_type type, float amount)
+    : type(type), amount(amount) {
+    return;
+}
+
+gorc::game::world::replay::input_command::input_command(input_command_type type, int param)
+    : type(type), param(param) {
+    return;
+}
+
+bool gorc::game::world::replay::input_command::operator==(input_command const &other) const {
+    return type == other.type &&
+           get<0>(direction) == get<0>(other.direction) &&
+           get<1>(direction) == get<1>(other.direction) &&
+           get<2>(direction) == get<2>(other.direction) &&
+           amount == other.amount &&
+           param == other.param;
+}
+
+bool gorc::game::world::replay::input_command::operator!=(input_command const &other) const {
+    return !(*this == other);
+}
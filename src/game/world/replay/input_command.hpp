@@ -0,0 +1,62 @@
+#pragma once
+
+#include "math/vector.hpp"
+#include "content/id.hpp"
+#include <cstdint>
+
+namespace gorc {
+namespace game {
+namespace world {
+namespace replay {
+
+enum class input_command_type : uint8_t {
+    move,
+    yaw,
+    pitch,
+    jump,
+    activate,
+    fly,
+    crouch,
+    stand,
+    respawn,
+    damage,
+    cycle_camera,
+    fire,
+    release,
+    select_weapon,
+    hotkey_pressed,
+    hotkey_released,
+    give_weapons,
+    sighted
+};
+
+// One player action, as delivered to the level presenter. Every input that
+// changes the simulation passes through one of these, so a session can be
+// replayed from the commands alone.
+class input_command {
+public:
+    input_command_type type = input_command_type::move;
+
+    // Walk direction for move
+    vector<3> direction = make_zero_vector<3, float>();
+
+    // Angle for yaw and pitch
+    float amount = 0.0f;
+
+    // Fire mode, weapon, hotkey or thing id, depending on the type
+    int param = 0;
+
+    input_command() = default;
+    explicit input_command(input_command_type type);
+    input_command(input_command_type type, vector<3> const &direction);
+    input_command(input_command_type type, float amount);
+    input_command(input_command_type type, int param);
+
+    bool operator==(input_command const &) const;
+    bool operator!=(input_command const &) const;
+};
+
+}
+}
+}
+}
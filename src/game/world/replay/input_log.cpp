@@ -0,0 +1,188 @@
+#include "input_log.hpp"
+#include "game/world/level_presenter.hpp"
+#include "log/log.hpp"
+#include <stdexcept>
+
+namespace {
+
+constexpr uint32_t input_log_magic = 0x4C504552U; // 'REPL'
+constexpr uint32_t input_log_version = 1U;
+
+constexpr uint8_t repeat_flag = 0x80U;
+constexpr uint8_t end_tick_marker = 0xFFU;
+
+bool has_direction(gorc::game::world::replay::input_command_type type) {
+    return type == gorc::game::world::replay::input_command_type::move;
+}
+
+bool has_amount(gorc::game::world::replay::input_command_type type) {
+    return type == gorc::game::world::replay::input_command_type::yaw ||
+           type == gorc::game::world::replay::input_command_type::pitch;
+}
+
+bool has_param(gorc::game::world::replay::input_command_type type) {
+    switch(type) {
+    case gorc::game::world::replay::input_command_type::fire:
+    case gorc::game::world::replay::input_command_type::release:
+    case gorc::game::world::replay::input_command_type::select_weapon:
+    case gorc::game::world::replay::input_command_type::hotkey_pressed:
+    case gorc::game::world::replay::input_command_type::hotkey_released:
+    case gorc::game::world::replay::input_command_type::sighted:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+}
+
+gorc::game::world::replay::input_log_header::input_log_header(deserialization_constructor_tag,
+                                                               binary_input_stream &is) {
+    if(binary_deserialize<uint32_t>(is) != input_log_magic) {
+        LOG_FATAL("file is not an input log");
+    }
+
+    auto version = binary_deserialize<uint32_t>(is);
+    if(version != input_log_version) {
+        LOG_FATAL(format("unsupported input log version %d") % version);
+    }
+
+    random_seed = binary_deserialize<uint32_t>(is);
+    timestep_ms = binary_deserialize<int>(is);
+    episode = binary_deserialize<std::string>(is);
+    level = binary_deserialize<std::string>(is);
+}
+
+void gorc::game::world::replay::input_log_header::binary_serialize_object(binary_output_stream &os) const {
+    binary_serialize<uint32_t>(os, input_log_magic);
+    binary_serialize<uint32_t>(os, input_log_version);
+    binary_serialize<uint32_t>(os, random_seed);
+    binary_serialize<int>(os, timestep_ms);
+    binary_serialize(os, episode);
+    binary_serialize(os, level);
+}
+
+void gorc::game::world::replay::input_log_codec::write(binary_output_stream &os, input_command const &cmd) {
+    auto &prev = previous[static_cast<size_t>(cmd.type)];
+    uint8_t type_byte = static_cast<uint8_t>(cmd.type);
+
+    bool has_payload = has_direction(cmd.type) || has_amount(cmd.type) || has_param(cmd.type);
+    if(has_payload && cmd == prev) {
+        binary_serialize<uint8_t>(os, type_byte | repeat_flag);
+        return;
+    }
+
+    binary_serialize<uint8_t>(os, type_byte);
+
+    if(has_direction(cmd.type)) {
+        binary_serialize<float>(os, get<0>(cmd.direction));
+        binary_serialize<float>(os, get<1>(cmd.direction));
+        binary_serialize<float>(os, get<2>(cmd.direction));
+    }
+
+    if(has_amount(cmd.type)) {
+        binary_serialize<float>(os, cmd.amount);
+    }
+
+    if(has_param(cmd.type)) {
+        binary_serialize<int32_t>(os, cmd.param);
+    }
+
+    prev = cmd;
+}
+
+gorc::game::world::replay::input_command gorc::game::world::replay::input_log_codec::read(binary_input_stream &is,
+                                                                                         uint8_t type_byte) {
+    auto type_index = static_cast<size_t>(type_byte & ~repeat_flag);
+    if(type_index >= previous.size()) {
+        LOG_FATAL(format("unknown input command type %d") % static_cast<int>(type_index));
+    }
+
+    auto &prev = previous[type_index];
+    if(type_byte & repeat_flag) {
+        return prev;
+    }
+
+    input_command cmd(static_cast<input_command_type>(type_index));
+
+    if(has_direction(cmd.type)) {
+        float x = binary_deserialize<float>(is);
+        float y = binary_deserialize<float>(is);
+        float z = binary_deserialize<float>(is);
+        cmd.direction = make_vector(x, y, z);
+    }
+
+    if(has_amount(cmd.type)) {
+        cmd.amount = binary_deserialize<float>(is);
+    }
+
+    if(has_param(cmd.type)) {
+        cmd.param = binary_deserialize<int32_t>(is);
+    }
+
+    prev = cmd;
+    return cmd;
+}
+
+gorc::game::world::replay::input_log::input_log(deserialization_constructor_tag, binary_input_stream &is)
+    : header(deserialization_constructor, is) {
+    input_log_codec codec;
+
+    try {
+        recorded_tick tick;
+        while(!is.at_end()) {
+            uint8_t type_byte = binary_deserialize<uint8_t>(is);
+            if(type_byte == end_tick_marker) {
+                tick.state_hash = binary_deserialize<uint64_t>(is);
+                ticks.push_back(std::move(tick));
+                tick = recorded_tick();
+            }
+            else {
+                tick.commands.push_back(codec.read(is, type_byte));
+            }
+        }
+    }
+    catch(std::runtime_error const &) {
+        // The recording stopped partway through a tick.
+        LOG_WARNING(format("input log is truncated after %d ticks") % ticks.size());
+    }
+}
+
+gorc::game::world::replay::input_recorder::input_recorder(output_stream &stream, input_log_header const &header)
+    : os(stream, binary_stream_buffer_size) {
+    binary_serialize(os, header);
+}
+
+void gorc::game::world::replay::input_recorder::record(input_command const &cmd) {
+    codec.write(os, cmd);
+}
+
+void gorc::game::world::replay::input_recorder::end_tick(uint64_t state_hash) {
+    binary_serialize<uint8_t>(os, end_tick_marker);
+    binary_serialize<uint64_t>(os, state_hash);
+    ++tick_count;
+}
+
+gorc::game::world::replay::input_player::input_player(input_log const &log)
+    : log(log) {
+    return;
+}
+
+void gorc::game::world::replay::input_player::begin_tick(level_presenter &presenter) {
+    for(auto const &cmd : log.ticks.at(next_tick).commands) {
+        presenter.apply_input(cmd);
+    }
+}
+
+void gorc::game::world::replay::input_player::end_tick(uint64_t state_hash) {
+    if(log.ticks.at(next_tick).state_hash != state_hash) {
+        if(!first_mismatch.has_value()) {
+            first_mismatch = next_tick;
+        }
+
+        ++mismatched_ticks;
+    }
+
+    ++next_tick;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "input_command.hpp"
+#include "io/binary_input_stream.hpp"
+#include "io/binary_output_stream.hpp"
+#include "utility/maybe.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace gorc {
+namespace game {
+namespace world {
+
+class level_presenter;
+
+namespace replay {
+
+// Everything needed to start a level the same way it was recorded.
+class input_log_header {
+public:
+    uint32_t random_seed = 0;
+    int timestep_ms = 0;
+    std::string episode;
+    std::string level;
+
+    input_log_header() = default;
+    input_log_header(deserialization_constructor_tag, binary_input_stream &);
+
+    void binary_serialize_object(binary_output_stream &) const;
+};
+
+// Input applied before a tick, and the level state hash after it.
+class recorded_tick {
+public:
+    std::vector<input_command> commands;
+    uint64_t state_hash = 0;
+};
+
+// Commands are written as a type byte and a payload. A command identical to
+// the previous one of its type is written as the type byte alone, so the
+// input sampled every frame costs one byte per tick while it is unchanged.
+class input_log_codec {
+private:
+    std::array<input_command, static_cast<size_t>(input_command_type::sighted) + 1> previous;
+
+public:
+    void write(binary_output_stream &, input_command const &);
+    input_command read(binary_input_stream &, uint8_t type_byte);
+};
+
+class input_log {
+public:
+    input_log_header header;
+    std::vector<recorded_tick> ticks;
+
+    input_log(deserialization_constructor_tag, binary_input_stream &);
+};
+
+// Writes commands as they are submitted, and closes each tick with a hash of
+// the level state.
+class input_recorder {
+private:
+    binary_output_stream os;
+    input_log_codec codec;
+    size_t tick_count = 0;
+
+public:
+    input_recorder(output_stream &stream, input_log_header const &header);
+
+    void record(input_command const &);
+    void end_tick(uint64_t state_hash);
+
+    inline size_t get_tick_count() const {
+        return tick_count;
+    }
+};
+
+// Feeds recorded input to a level presenter a tick at a time, and compares
+// the level state after each tick to the recording.
+class input_player {
+private:
+    input_log const &log;
+    size_t next_tick = 0;
+
+public:
+    size_t mismatched_ticks = 0;
+    maybe<size_t> first_mismatch;
+
+    explicit input_player(input_log const &log);
+
+    inline bool done() const {
+        return next_tick >= log.ticks.size();
+    }
+
+    inline size_t get_tick() const {
+        return next_tick;
+    }
+
+    void begin_tick(level_presenter &);
+    void end_tick(uint64_t state_hash);
+};
+
+}
+}
+}
+}
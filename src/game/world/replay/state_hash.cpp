@@ -0,0 +1,56 @@
+#include "state_hash.hpp"
+#include "game/world/level_model.hpp"
+#include "utility/fnv1a.hpp"
+
+namespace {
+
+template <typename T>
+uint64_t hash_value(T const &value, uint64_t hash) {
+    return gorc::fnv1a_hash(&value, sizeof(T), hash);
+}
+
+template <size_t n>
+uint64_t hash_vector(gorc::vector<n, float> const &value, uint64_t hash) {
+    for(auto component : value) {
+        hash = hash_value(component, hash);
+    }
+
+    return hash;
+}
+
+}
+
+uint64_t gorc::game::world::replay::hash_level_state(level_model &model) {
+    uint64_t hash = fnv1a_offset_basis;
+
+    hash = hash_value(model.game_time, hash);
+    hash = hash_value(model.level_time, hash);
+
+    for(const auto& body_pair : model.thing_bodies) {
+        const auto& body = *body_pair.second;
+
+        hash = hash_value(static_cast<int>(body_pair.first), hash);
+        hash = hash_value(static_cast<int>(body.sector), hash);
+        hash = hash_vector(body.position, hash);
+        hash = hash_value(get<0>(body.orient), hash);
+        hash = hash_value(get<1>(body.orient), hash);
+        hash = hash_value(get<2>(body.orient), hash);
+        hash = hash_value(get<3>(body.orient), hash);
+        hash = hash_vector(body.vel, hash);
+        hash = hash_vector(body.thrust, hash);
+        hash = hash_value(static_cast<flags::thing_flag>(body.flags), hash);
+
+        for(auto& thing : model.ecs.find_component<components::thing>(body_pair.first)) {
+            hash = hash_value(thing.second->health, hash);
+            hash = hash_value(thing.second->head_pitch, hash);
+            hash = hash_vector(thing.second->ang_vel, hash);
+        }
+    }
+
+    for(const auto& surface : model.surfaces) {
+        hash = hash_value(surface.cel_number, hash);
+        hash = hash_vector(surface.texture_offset, hash);
+    }
+
+    return hash;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace gorc {
+namespace game {
+namespace world {
+
+class level_model;
+
+namespace replay {
+
+// Fingerprint of the simulation state: thing bodies and the player-facing
+// thing properties, surface animation and the level clocks. Two runs that
+// hash the same on every tick took the same path through the level.
+uint64_t hash_level_state(level_model &model);
+
+}
+}
+}
+}
@@ -3,6 +3,8 @@
 #include "game/world/sounds/components/voice.hpp"
 #include "game/world/sounds/components/foley.hpp"
 #include "game/world/sounds/components/stop_when_destroyed.hpp"
+#include <algorithm>
+#include <cmath>
 
 gorc::game::world::sounds::aspects::sound_aspect::sound_aspect(entity_component_system<thing_id> &cs,
                                                                level_model &model)
@@ -12,7 +14,8 @@ gorc::game::world::sounds::aspects::sound_aspect::sound_aspect(entity_component_
     destroyed_delegate =
         ecs.bus.add_handler<entity_destroyed<thing_id>>([&](auto const &e) {
         for(auto &sound : ecs.find_component<components::sound>(e.entity)) {
-            sound.second->internal_sound.stop();
+            sound.second->has_stopped = true;
+            stop_source(*sound.second);
         }
 
         ecs.erase_component_if<components::thing_sound>([&](thing_id, auto const &cmp) {
@@ -43,46 +46,162 @@ gorc::game::world::sounds::aspects::sound_aspect::sound_aspect(entity_component_
     return;
 }
 
+void gorc::game::world::sounds::aspects::sound_aspect::start_source(components::sound &s) {
+    maybe_if(model.sound_model.sources.acquire(), [&](size_t source) {
+        s.source = source;
+
+        auto &src = model.sound_model.sources.get(source);
+        src.setBuffer(*s.buffer);
+        src.setLoop(s.loops);
+        src.setRelativeToListener(!s.do_distance_attenuation);
+        src.setAttenuation(0.0f);
+        src.setMinDistance(s.do_distance_attenuation ? s.minimum_attenuation_radius : 1.0f);
+        apply_source_state(s);
+
+        src.setPlayingOffset(sf::seconds(s.playback_offset));
+        src.play();
+    });
+}
+
+void gorc::game::world::sounds::aspects::sound_aspect::stop_source(components::sound &s) {
+    maybe_if(s.source, [&](size_t source) {
+        s.playback_offset = model.sound_model.sources.get(source).getPlayingOffset().asSeconds();
+        model.sound_model.sources.release(source);
+    });
+
+    s.source = nothing;
+}
+
+void gorc::game::world::sounds::aspects::sound_aspect::apply_source_state(components::sound &s) {
+    auto &src = model.sound_model.sources.get(s.source.get_value());
+    src.setVolume(s.audible_volume * 100.0f);
+    src.setPitch(s.pitch);
+
+    if(s.do_distance_attenuation) {
+        src.setPosition(get<0>(s.position), get<2>(s.position), -get<1>(s.position));
+    }
+    else {
+        src.setPosition(s.panning, 0.0f, 0.0f);
+    }
+}
+
+void gorc::game::world::sounds::aspects::sound_aspect::assign_sources() {
+    // The loudest sounds hold the available sources. Inaudible sounds, and
+    // sounds crowded out by louder ones, give up their source and continue
+    // without it until they are loud enough again.
+    source_candidates.clear();
+    for(auto &snd : ecs.all_components<components::sound>()) {
+        auto &s = *snd.second;
+        if(s.has_stopped) {
+            continue;
+        }
+
+        if(s.audible_volume >= audible_volume_threshold) {
+            source_candidates.push_back(&s);
+        }
+        else {
+            stop_source(s);
+        }
+    }
+
+    size_t source_count = model.sound_model.sources.size();
+    if(source_candidates.size() > source_count) {
+        // Sounds already holding a source win ties, so equal sounds do not
+        // trade sources every update.
+        std::nth_element(source_candidates.begin(),
+                         source_candidates.begin() + source_count,
+                         source_candidates.end(),
+                         [](components::sound const *a, components::sound const *b) {
+                             if(a->audible_volume != b->audible_volume) {
+                                 return a->audible_volume > b->audible_volume;
+                             }
+
+                             return a->source.has_value() && !b->source.has_value();
+                         });
+
+        for(auto it = source_candidates.begin() + source_count;
+            it != source_candidates.end();
+            ++it) {
+            stop_source(**it);
+        }
+
+        source_candidates.resize(source_count);
+    }
+
+    for(auto *s : source_candidates) {
+        if(!s->source.has_value()) {
+            start_source(*s);
+        }
+    }
+}
+
+void gorc::game::world::sounds::aspects::sound_aspect::update(time_delta t) {
+    inner_join_aspect::update(t);
+    assign_sources();
+}
+
 void gorc::game::world::sounds::aspects::sound_aspect::update(time_delta t,
                                                               thing_id id,
                                                               components::sound &s) {
+    float dt = static_cast<float>(t.count());
+
     if(s.stop_delay > 0.0f) {
-        s.stop_delay -= static_cast<float>(t.count());
+        s.stop_delay -= dt;
 
         if(s.stop_delay <= 0.0f) {
-            s.internal_sound.stop();
+            s.has_stopped = true;
         }
     }
 
-    if(s.has_played && s.internal_sound.getStatus() == sf::Sound::Stopped) {
+    if(s.has_played && !s.has_stopped) {
+        if(s.source.has_value()) {
+            auto const &src = model.sound_model.sources.get(s.source.get_value());
+            if(src.getStatus() == sf::Sound::Stopped) {
+                s.has_stopped = true;
+            }
+        }
+        else {
+            // Advance playback without a source
+            float duration = s.buffer->getDuration().asSeconds();
+            s.playback_offset += dt * s.pitch;
+
+            if(s.playback_offset >= duration) {
+                if(s.loops && duration > 0.0f) {
+                    s.playback_offset = std::fmod(s.playback_offset, duration);
+                }
+                else {
+                    s.has_stopped = true;
+                }
+            }
+        }
+    }
+
+    if(s.has_stopped) {
+        stop_source(s);
         ecs.erase_entity(id);
         return;
     }
 
-    s.volume.update(static_cast<float>(t.count()));
-    s.pitch.update(static_cast<float>(t.count()));
+    s.volume.update(dt);
+    s.pitch.update(dt);
 
+    float attenuation = 1.0f;
     if(s.do_distance_attenuation) {
         auto sound_dist = length(model.camera_model.current_computed_state.position - s.position);
 
-        float attenuation = 1.0f;
         if(s.minimum_attenuation_radius < s.maximum_attenuation_radius) {
             attenuation = ((sound_dist - s.maximum_attenuation_radius) /
                            (s.minimum_attenuation_radius - s.maximum_attenuation_radius));
         }
 
         attenuation = clamp(attenuation, 0.0f, 1.0f);
-
-        s.internal_sound.setVolume(attenuation * s.volume * 100.0f);
-        s.internal_sound.setPitch(s.pitch);
-    }
-    else {
-        s.internal_sound.setVolume(s.volume * 100.0f);
-        s.internal_sound.setPitch(s.pitch);
     }
 
-    if(!s.has_played) {
-        s.has_played = true;
-        s.internal_sound.play();
+    s.audible_volume = attenuation * s.volume;
+
+    if(s.source.has_value()) {
+        apply_source_state(s);
     }
+
+    s.has_played = true;
 }
@@ -3,6 +3,7 @@
 #include "ecs/inner_join_aspect.hpp"
 #include "game/world/sounds/components/sound.hpp"
 #include "game/world/level_model.hpp"
+#include <vector>
 
 namespace gorc {
 namespace game {
@@ -15,10 +16,21 @@ private:
     level_model &model;
     maybe<scoped_delegate> destroyed_delegate;
 
+    // Sounds quieter than this do not hold a playback source
+    static constexpr float audible_volume_threshold = 0.01f;
+
+    std::vector<components::sound*> source_candidates;
+
+    void start_source(components::sound &s);
+    void stop_source(components::sound &s);
+    void apply_source_state(components::sound &s);
+    void assign_sources();
+
 public:
     sound_aspect(entity_component_system<thing_id>&, level_model&);
 
-    void update(time_delta, thing_id, components::sound&);
+    virtual void update(time_delta) override;
+    virtual void update(time_delta, thing_id, components::sound&) override;
 };
 
 }
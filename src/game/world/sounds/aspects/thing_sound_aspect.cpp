@@ -11,9 +11,6 @@ void gorc::game::world::sounds::aspects::thing_sound_aspect::update(time_delta,
                                                                     components::thing_sound &ts,
                                                                     world::components::thing &thing) {
     for(auto &sound : ecs.find_component<components::sound>(ts.sound)) {
-        sound.second->position = thing.position;
-        sound.second->internal_sound.setPosition(get<0>(thing.position),
-                                                get<2>(thing.position),
-                                                -get<1>(thing.position));
+        sound.second->position = thing.position();
     }
 }
@@ -5,6 +5,7 @@
 #include "libold/base/utility/easing.hpp"
 #include <SFML/Audio.hpp>
 #include "utility/uid.hpp"
+#include "utility/maybe.hpp"
 
 namespace gorc {
 namespace game {
@@ -16,13 +17,22 @@ class sound {
 public:
     uid(54554757);
 
-    sf::Sound internal_sound;
+    sf::SoundBuffer const *buffer = nullptr;
+    bool loops = false;
     bool has_played = false;
+    bool has_stopped = false;
+
+    // Playback source, when the sound is audible enough to hold one.
+    // Otherwise the playback offset advances without a source.
+    maybe<size_t> source;
+    float playback_offset = 0.0f;
+    float audible_volume = 0.0f;
 
     bool do_distance_attenuation = false;
     float minimum_attenuation_radius = 0.0f;
     float maximum_attenuation_radius = 1.0f;
     vector<3> position;
+    float panning = 0.0f;
 
     linear_eased<float> pitch, volume;
     float stop_delay = 0.0f;
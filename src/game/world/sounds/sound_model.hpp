@@ -1,6 +1,7 @@
 #pragma once
 
 #include "music.hpp"
+#include "sound_source_pool.hpp"
 #include "libold/base/content/assets/sound.hpp"
 
 namespace gorc {
@@ -12,6 +13,7 @@ class sound_model {
 public:
     sf::Sound ambient_sound;
     music ambient_music;
+    sound_source_pool sources;
 };
 
 }
@@ -131,14 +131,9 @@ gorc::thing_id sound_presenter::play_sound_local(sound_id wav,
     thing_id snd_id = levelModel->ecs.emplace_entity();
     components::sound &snd = levelModel->ecs.emplace_component<components::sound>(snd_id);
 
-    snd.internal_sound.setBuffer(buffer->buffer);
-    snd.internal_sound.setPosition(panning, 0.0f, 0.0f);
-    snd.internal_sound.setRelativeToListener(true);
-    snd.internal_sound.setVolume(volume * 100.0f);
-    snd.internal_sound.setLoop(flags & flags::sound_flag::Loops);
-    snd.internal_sound.setPitch(1.0f);
-    snd.internal_sound.setAttenuation(0.0f);
-    snd.internal_sound.setMinDistance(1.0f);
+    snd.buffer = &buffer->buffer;
+    snd.loops = flags & flags::sound_flag::Loops;
+    snd.panning = panning;
 
     snd.do_distance_attenuation = false;
 
@@ -174,14 +169,8 @@ gorc::thing_id sound_presenter::play_sound_pos(sound_id wav,
         snd.maximum_attenuation_radius = 25.0f / sound_attenuation_factor;
     }
 
-    snd.internal_sound.setBuffer(buffer->buffer);
-    snd.internal_sound.setPosition(get<0>(pos), get<2>(pos), -get<1>(pos));
-    snd.internal_sound.setRelativeToListener(false);
-    snd.internal_sound.setVolume(volume * 100.0f);
-    snd.internal_sound.setLoop(flags & flags::sound_flag::Loops);
-    snd.internal_sound.setMinDistance(snd.minimum_attenuation_radius);
-    snd.internal_sound.setAttenuation(0.0f);
-    snd.internal_sound.setPitch(1.0f);
+    snd.buffer = &buffer->buffer;
+    snd.loops = flags & flags::sound_flag::Loops;
 
     snd.do_distance_attenuation = true;
 
@@ -209,7 +198,7 @@ gorc::thing_id sound_presenter::play_sound_thing(sound_id wav,
         // Thing can only play this sound once.
         for(auto &tsnd : levelModel->ecs.find_component<components::thing_sound>(thing)) {
             for(auto &snd : levelModel->ecs.find_component<components::sound>(tsnd.second->sound)) {
-                if(snd.second->internal_sound.getBuffer() == &soundfile->buffer) {
+                if(snd.second->buffer == &soundfile->buffer) {
                     return invalid_id;
                 }
             }
@@ -225,7 +214,7 @@ gorc::thing_id sound_presenter::play_sound_thing(sound_id wav,
 
     auto &thing_ref = levelModel->get_thing(thing);
 
-    thing_id snd_id = play_sound_pos(wav, thing_ref.position, volume, minrad, maxrad, flags);
+    thing_id snd_id = play_sound_pos(wav, thing_ref.position(), volume, minrad, maxrad, flags);
     if(!snd_id.is_valid()) {
         return invalid_id;
     }
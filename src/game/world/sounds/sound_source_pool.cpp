@@ -0,0 +1,37 @@
+#include "sound_source_pool.hpp"
+
+gorc::game::world::sounds::sound_source_pool::sound_source_pool(size_t source_count)
+    : sources(source_count) {
+    // Hand out low-numbered sources first
+    for(size_t i = source_count; i > 0; --i) {
+        free_sources.push_back(i - 1);
+    }
+}
+
+gorc::maybe<size_t> gorc::game::world::sounds::sound_source_pool::acquire() {
+    if(free_sources.empty()) {
+        return nothing;
+    }
+
+    size_t source = free_sources.back();
+    free_sources.pop_back();
+    return source;
+}
+
+void gorc::game::world::sounds::sound_source_pool::release(size_t source) {
+    sources[source].stop();
+    sources[source].resetBuffer();
+    free_sources.push_back(source);
+}
+
+sf::Sound& gorc::game::world::sounds::sound_source_pool::get(size_t source) {
+    return sources[source];
+}
+
+size_t gorc::game::world::sounds::sound_source_pool::size() const {
+    return sources.size();
+}
+
+size_t gorc::game::world::sounds::sound_source_pool::free_count() const {
+    return free_sources.size();
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "utility/maybe.hpp"
+#include <SFML/Audio.hpp>
+#include <vector>
+
+namespace gorc {
+namespace game {
+namespace world {
+namespace sounds {
+
+// Fixed set of playback sources shared by all sound components. Sounds that
+// do not hold a source are tracked by their component and continue silently.
+class sound_source_pool {
+private:
+    std::vector<sf::Sound> sources;
+    std::vector<size_t> free_sources;
+
+public:
+    static constexpr size_t default_source_count = 32;
+
+    explicit sound_source_pool(size_t source_count = default_source_count);
+
+    maybe<size_t> acquire();
+    void release(size_t source);
+
+    sf::Sound& get(size_t source);
+
+    size_t size() const;
+    size_t free_count() const;
+};
+
+}
+}
+}
+}
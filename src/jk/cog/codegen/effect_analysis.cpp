@@ -0,0 +1,109 @@
+#include "effect_analysis.hpp"
+#include "jk/cog/vm/opcode.hpp"
+#include "io/binary_input_stream.hpp"
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    using namespace gorc;
+    using namespace gorc::cog;
+
+    verb_effect analyze_handler(memory_file const &program,
+                                size_t entry,
+                                verb_table const &verbs)
+    {
+        verb_effect rv = verb_effect::pure;
+
+        std::vector<size_t> open { entry };
+        std::unordered_set<size_t> visited;
+
+        memory_file::reader sr(program);
+        binary_input_stream bsr(sr);
+
+        while(!open.empty()) {
+            size_t pc = open.back();
+            open.pop_back();
+
+            if(!visited.insert(pc).second) {
+                continue;
+            }
+
+            sr.set_position(pc);
+
+            // Follow the path until it returns or jumps away
+            bool path_open = true;
+            while(path_open && !sr.at_end()) {
+                opcode op = binary_deserialize<opcode>(bsr);
+                switch(op) {
+                case opcode::push: {
+                    value skipped(deserialization_constructor, bsr);
+                } break;
+
+                case opcode::load:
+                case opcode::loadi:
+                case opcode::loadg:
+                case opcode::loadgi:
+                case opcode::stor:
+                case opcode::stori:
+                    binary_deserialize<size_t>(bsr);
+                    break;
+
+                case opcode::storg:
+                case opcode::storgi:
+                    // Global heap is shared between all instances
+                    return verb_effect::world;
+
+                case opcode::jmp:
+                    open.push_back(binary_deserialize<size_t>(bsr));
+                    path_open = false;
+                    break;
+
+                case opcode::jal:
+                case opcode::bt:
+                case opcode::bf:
+                    open.push_back(binary_deserialize<size_t>(bsr));
+                    open.push_back(sr.position());
+                    path_open = false;
+                    break;
+
+                case opcode::call:
+                case opcode::callv: {
+                    int vid = binary_deserialize<int>(bsr);
+
+                    // Skip diagnostic range
+                    for(int i = 0; i < 4; ++i) {
+                        binary_deserialize<int>(bsr);
+                    }
+
+                    rv = std::max(rv, verbs.get_verb_effect(verb_id(vid)));
+                    if(rv == verb_effect::world) {
+                        return rv;
+                    }
+                } break;
+
+                case opcode::ret:
+                    path_open = false;
+                    break;
+
+                default:
+                    // Remaining instructions only operate on the data stack
+                    break;
+                }
+            }
+        }
+
+        return rv;
+    }
+}
+
+void gorc::cog::perform_effect_analysis(script &out_script,
+                                        verb_table const &verbs)
+{
+    for(auto const &export_offset : out_script.exports) {
+        out_script.exports.set_effect(export_offset.first,
+                                      analyze_handler(out_script.program,
+                                                      export_offset.second,
+                                                      verbs));
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "jk/cog/script/script.hpp"
+#include "jk/cog/script/verb_table.hpp"
+
+namespace gorc {
+    namespace cog {
+
+        // Records the strongest verb effect reachable from each exported
+        // message handler in the generated program.
+        void perform_effect_analysis(script &out_script,
+                                     verb_table const &verbs);
+
+    }
+}
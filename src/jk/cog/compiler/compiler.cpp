@@ -4,6 +4,7 @@
 #include "log/log.hpp"
 #include "jk/cog/semantics/analyzer.hpp"
 #include "jk/cog/codegen/codegen.hpp"
+#include "jk/cog/codegen/effect_analysis.hpp"
 
 gorc::cog::compiler::compiler(verb_table &verbs,
                               constant_table &constants)
@@ -54,6 +55,8 @@ std::unique_ptr<gorc::cog::script> gorc::cog::compiler::compile(input_stream &f)
     LOG_FATAL_ASSERT(diagnostic_file_error_count() == 0,
                      "could not compile script");
 
+    cog::perform_effect_analysis(*script, verbs);
+
     handle_generated_code(*script);
 
     return script;
@@ -12,11 +12,17 @@ std::vector<gorc::path> const &gorc::cog::script_loader::get_prefixes() const
     return cog_prefixes;
 }
 
+bool gorc::cog::script_loader::is_thread_safe() const
+{
+    // Compilation only reads the shared verb and constant tables.
+    return true;
+}
+
 std::unique_ptr<gorc::asset> gorc::cog::script_loader::deserialize(input_stream &is,
                                                                    content_manager &,
                                                                    asset_id,
                                                                    service_registry const &services,
-                                                                   std::string const &name) const
+                                                                   std::string const &) const
 {
     auto &compiler = services.get<cog::compiler>();
     return compiler.compile(is);
@@ -11,6 +11,7 @@ namespace gorc {
             static fourcc const type;
 
             virtual std::vector<path> const &get_prefixes() const override;
+            virtual bool is_thread_safe() const override;
 
             virtual std::unique_ptr<asset> deserialize(input_stream &is,
                                                        content_manager &,
@@ -3,107 +3,152 @@
 #include "verb.hpp"
 #include "verb_traits.hpp"
 #include "log/log.hpp"
+#include "utility/span.hpp"
+#include <array>
 #include <memory>
+#include <utility>
 
 namespace gorc {
     namespace cog {
 
         namespace detail {
-            template <size_t remaining, value_type result_t, bool pass_svc>
-            struct apply_verb_arguments {
-                template <typename FnT, typename ...ArgT>
-                value operator()(std::string const &name,
-                                 FnT const &fn,
-                                 stack &s,
-                                 service_registry &sr,
-                                 bool ev,
-                                 ArgT ...args)
+            // Reserves the topmost arguments on the data stack for the duration
+            // of a verb call. Arguments are read in place and popped together.
+            class verb_argument_frame {
+            private:
+                stack &s;
+                size_t base;
+
+            public:
+                verb_argument_frame(std::string const &name, stack &s, size_t arity)
+                    : s(s)
+                    , base(0)
                 {
-                    if(s.empty()) {
+                    if(s.size() < arity) {
                         LOG_FATAL(format("stack underflow in verb '%s'") % name);
                     }
 
-                    auto v = s.back();
-                    s.pop_back();
-                    return apply_verb_arguments<remaining - 1,
-                                                result_t,
-                                                pass_svc>()(name, fn, s, sr, ev, v, args...);
+                    base = s.size() - arity;
+                }
+
+                ~verb_argument_frame()
+                {
+                    s.erase(s.begin() + static_cast<stack::difference_type>(base), s.end());
+                }
+
+                verb_argument_frame(verb_argument_frame const &) = delete;
+                verb_argument_frame& operator=(verb_argument_frame const &) = delete;
+
+                span<value const> arguments() const
+                {
+                    return make_span(s.data() + base, s.size() - base);
                 }
             };
 
-            template <bool pass_svc>
-            struct maybe_apply_service_arguments {
+            template <value_type result_t>
+            struct invoke_verb_functor {
                 template <typename FnT, typename ...ArgT>
-                auto operator()(FnT const &fn,
-                                service_registry &,
-                                bool /* expects value */,
-                                ArgT ...args) -> decltype(fn(args...))
+                static value call(FnT const &fn, ArgT &&...args)
                 {
-                    return fn(args...);
+                    return fn(std::forward<ArgT>(args)...);
                 }
             };
 
             template <>
-            struct maybe_apply_service_arguments<true> {
+            struct invoke_verb_functor<value_type::nothing> {
                 template <typename FnT, typename ...ArgT>
-                auto operator()(FnT const &fn,
-                                service_registry &sr,
-                                bool expects_value,
-                                ArgT ...args) -> decltype(fn(expects_value, sr, args...))
+                static value call(FnT const &fn, ArgT &&...args)
                 {
-                    return fn(expects_value, sr, args...);
+                    fn(std::forward<ArgT>(args)...);
+                    return value();
                 }
             };
 
-            template <value_type result_t, bool pass_svc>
-            struct apply_verb_arguments<0, result_t, pass_svc> {
-                template <typename FnT, typename ...ArgT>
-                value operator()(std::string const &,
-                                 FnT const &fn,
-                                 stack &,
-                                 service_registry &sr,
-                                 bool ev,
-                                 ArgT ...args)
+            void report_verb_argument_type_error(int argn, value const &v, value_type expected);
+
+            // Argument checks are selected by the declared parameter type.
+            // Only id parameters can fail, so checks for other types vanish.
+            template <value_type arg_t>
+            struct verb_argument_check {
+                static bool is_valid(value const &)
                 {
-                    return maybe_apply_service_arguments<pass_svc>()(fn, sr, ev, args...);
+                    return true;
                 }
             };
 
-            template <bool pass_svc>
-            struct apply_verb_arguments<0, value_type::nothing, pass_svc> {
-                template <typename FnT, typename ...ArgT>
-                value operator()(std::string const &,
-                                 FnT const &fn,
-                                 stack &,
-                                 service_registry &sr,
-                                 bool ev,
-                                 ArgT ...args)
+#define MAKE_ID_ARGUMENT_CHECK(x) \
+            template <> \
+            struct verb_argument_check<value_type::x> { \
+                static bool is_valid(value const &v) \
+                { \
+                    x##_id id = v; \
+                    return id.is_valid(); \
+                } \
+            }
+
+            MAKE_ID_ARGUMENT_CHECK(sector);
+            MAKE_ID_ARGUMENT_CHECK(surface);
+            MAKE_ID_ARGUMENT_CHECK(thing);
+            MAKE_ID_ARGUMENT_CHECK(player);
+            MAKE_ID_ARGUMENT_CHECK(ai);
+            MAKE_ID_ARGUMENT_CHECK(cog);
+            MAKE_ID_ARGUMENT_CHECK(colormap);
+            MAKE_ID_ARGUMENT_CHECK(keyframe);
+            MAKE_ID_ARGUMENT_CHECK(material);
+            MAKE_ID_ARGUMENT_CHECK(model);
+            MAKE_ID_ARGUMENT_CHECK(sound);
+            MAKE_ID_ARGUMENT_CHECK(thing_template);
+            MAKE_ID_ARGUMENT_CHECK(message);
+
+#undef MAKE_ID_ARGUMENT_CHECK
+
+            template <value_type ...arg_t>
+            struct verb_type_check;
+
+            template <>
+            struct verb_type_check<> {
+                static bool check(value const *, int)
                 {
-                    maybe_apply_service_arguments<pass_svc>()(fn, sr, ev, args...);
-                    return value();
+                    return true;
                 }
             };
 
-            maybe<value> function_verb_type_check(stack const &stk,
-                                                  verb const &v,
-                                                  value default_value);
+            template <value_type first_t, value_type ...rest_t>
+            struct verb_type_check<first_t, rest_t...> {
+                static bool check(value const *args, int argn)
+                {
+                    // Errors are reported from the last argument to the first
+                    bool rest_valid = verb_type_check<rest_t...>::check(args + 1, argn + 1);
+
+                    bool valid = verb_argument_check<first_t>::is_valid(*args);
+                    if(!valid) {
+                        report_verb_argument_type_error(argn, *args, first_t);
+                    }
+
+                    return valid && rest_valid;
+                }
+            };
         }
 
-        template <typename FnT, size_t arity, value_type result_type>
+        template <typename FnT, value_type result_type, value_type ...argument_type>
         class function_verb : public verb {
         private:
             FnT functor;
             bool type_safe = false;
             value default_value;
 
+            template <size_t ...I>
+            value invoke_with_arguments(value const *args, std::index_sequence<I...>) const
+            {
+                return detail::invoke_verb_functor<result_type>::call(functor, args[I]...);
+            }
+
         public:
             function_verb(std::string const &name,
                           FnT functor,
                           bool type_safe = false,
                           value default_value = value())
-                : verb(name,
-                       compute_verb_result_type(functor),
-                       compute_verb_argument_types(functor))
+                : verb(name, result_type, { argument_type... })
                 , functor(functor)
                 , type_safe(type_safe)
                 , default_value(default_value)
@@ -111,50 +156,78 @@ namespace gorc {
                 return;
             }
 
-            virtual value invoke(stack &s, service_registry &sr, bool expects_value) const override
+            virtual value invoke(stack &s, service_registry &, bool) const override
             {
-                if(type_safe) {
-                    auto rv = detail::function_verb_type_check(s, *this, default_value);
-                    if(rv.has_value()) {
-                        return rv.get_value();
-                    }
+                detail::verb_argument_frame frame(name, s, sizeof...(argument_type));
+                value const *args = frame.arguments().data();
+
+                if(type_safe && !detail::verb_type_check<argument_type...>::check(args, 1)) {
+                    return default_value;
                 }
 
-                return detail::apply_verb_arguments<arity,
-                                                    result_type,
-                                                    false>()(name, functor, s, sr, expects_value);
+                // Arguments convert directly from the stack. They are popped
+                // when the frame goes out of scope.
+                return invoke_with_arguments(args,
+                                             std::make_index_sequence<sizeof...(argument_type)>());
             }
         };
 
+        namespace detail {
+            template <typename FnT, size_t ...I>
+            std::unique_ptr<verb> make_function_verb(std::string const &name,
+                                                     FnT functor,
+                                                     bool type_safe,
+                                                     value default_value,
+                                                     std::index_sequence<I...>)
+            {
+                return std::make_unique<function_verb<FnT,
+                                                      cog::compute_verb_result_type(functor),
+                                                      cog::compute_verb_argument_type<I>(functor)...>>(
+                        name,
+                        functor,
+                        type_safe,
+                        default_value);
+            }
+        }
+
         template <typename FnT>
         std::unique_ptr<verb> make_function_verb(std::string const &name,
                                                  FnT functor,
                                                  bool type_safe = false,
                                                  value default_value = value())
         {
-            return std::make_unique<function_verb<FnT,
-                                                  compute_verb_arity<FnT>(),
-                                                  compute_verb_result_type(functor)>>(name,
-                                                                                      functor,
-                                                                                      type_safe,
-                                                                                      default_value);
+            return detail::make_function_verb(name,
+                                              functor,
+                                              type_safe,
+                                              default_value,
+                                              std::make_index_sequence<compute_verb_arity<FnT>()>());
         }
 
-        template <typename FnT, size_t arity, value_type result_type>
+        template <typename FnT, value_type result_type, value_type ...argument_type>
         class service_verb : public verb {
         private:
             FnT functor;
             bool type_safe;
             value default_value;
 
+            template <size_t ...I>
+            value invoke_with_arguments(std::array<value, sizeof...(I)> const &args,
+                                        service_registry &sr,
+                                        bool expects_value,
+                                        std::index_sequence<I...>) const
+            {
+                return detail::invoke_verb_functor<result_type>::call(functor,
+                                                                      expects_value,
+                                                                      sr,
+                                                                      args[I]...);
+            }
+
         public:
             service_verb(std::string const &name,
                          FnT functor,
                          bool type_safe = false,
                          value default_value = value())
-                : verb(name,
-                       compute_verb_result_type(functor),
-                       compute_service_verb_argument_types(functor))
+                : verb(name, result_type, { argument_type... })
                 , functor(functor)
                 , type_safe(type_safe)
                 , default_value(default_value)
@@ -164,31 +237,55 @@ namespace gorc {
 
             virtual value invoke(stack &s, service_registry &sr, bool expects_value) const override
             {
-                if(type_safe) {
-                    auto rv = detail::function_verb_type_check(s, *this, default_value);
-                    if(rv.has_value()) {
-                        return rv.get_value();
-                    }
+                // Service verbs may push onto the data stack of the running
+                // continuation, so arguments are taken off before the call.
+                std::array<value, sizeof...(argument_type)> args;
+
+                {
+                    detail::verb_argument_frame frame(name, s, sizeof...(argument_type));
+                    std::copy_n(frame.arguments().data(), args.size(), args.begin());
+                }
+
+                if(type_safe && !detail::verb_type_check<argument_type...>::check(args.data(), 1)) {
+                    return default_value;
                 }
 
-                return detail::apply_verb_arguments<arity,
-                                                    result_type,
-                                                    true>()(name, functor, s, sr, expects_value);
+                return invoke_with_arguments(args,
+                                             sr,
+                                             expects_value,
+                                             std::make_index_sequence<sizeof...(argument_type)>());
             }
         };
 
+        namespace detail {
+            template <typename FnT, size_t ...I>
+            std::unique_ptr<verb> make_service_verb(std::string const &name,
+                                                    FnT functor,
+                                                    bool type_safe,
+                                                    value default_value,
+                                                    std::index_sequence<I...>)
+            {
+                return std::make_unique<service_verb<FnT,
+                                                     cog::compute_verb_result_type(functor),
+                                                     cog::compute_verb_argument_type<I + 2>(functor)...>>(
+                        name,
+                        functor,
+                        type_safe,
+                        default_value);
+            }
+        }
+
         template <typename FnT>
         std::unique_ptr<verb> make_service_verb(std::string const &name,
                                                 FnT functor,
                                                 bool type_safe = false,
                                                 value default_value = value())
         {
-            return std::make_unique<service_verb<FnT,
-                                                 compute_verb_arity<FnT>() - 2,
-                                                 compute_verb_result_type(functor)>>(name,
-                                                                                     functor,
-                                                                                     type_safe,
-                                                                                     default_value);
+            return detail::make_service_verb(name,
+                                             functor,
+                                             type_safe,
+                                             default_value,
+                                             std::make_index_sequence<compute_verb_arity<FnT>() - 2>());
         }
 
     }
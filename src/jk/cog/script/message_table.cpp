@@ -14,3 +14,18 @@ gorc::maybe<size_t> gorc::cog::message_table::get_offset(message_type t) const
 
     return nothing;
 }
+
+void gorc::cog::message_table::set_effect(message_type t, verb_effect e)
+{
+    effects[t] = e;
+}
+
+gorc::cog::verb_effect gorc::cog::message_table::get_effect(message_type t) const
+{
+    auto it = effects.find(t);
+    if(it != effects.end()) {
+        return it->second;
+    }
+
+    return verb_effect::world;
+}
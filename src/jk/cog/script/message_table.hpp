@@ -1,6 +1,7 @@
 #pragma once
 
 #include "message_type.hpp"
+#include "verb_effect.hpp"
 #include "utility/enum_hash.hpp"
 #include "utility/maybe.hpp"
 #include <unordered_map>
@@ -11,11 +12,17 @@ namespace gorc {
         class message_table {
         private:
             std::unordered_map<message_type, size_t, enum_hash<message_type>> offsets;
+            std::unordered_map<message_type, verb_effect, enum_hash<message_type>> effects;
 
         public:
             void set_offset(message_type, size_t);
             maybe<size_t> get_offset(message_type) const;
 
+            // Strongest effect of any verb reachable from the message handler.
+            // Handlers without a recorded effect are assumed to modify shared state.
+            void set_effect(message_type, verb_effect);
+            verb_effect get_effect(message_type) const;
+
             auto begin() const -> decltype(offsets.begin())
             {
                 return offsets.begin();
@@ -159,6 +159,54 @@ test_case(safe_service_verb)
     assert_eq(result2, value(10));
     assert_log_message(log_level::error, "could not convert argument 1 from int(0) to sector");
     assert_log_empty();
+
+    assert_true(stk.empty());
+}
+
+test_case(safe_verb_reports_each_argument)
+{
+    auto fn = [](thing_id, int, sector_id)
+    {
+        LOG_INFO("called functor");
+    };
+
+    auto vn = make_function_verb("myverb", fn, true, 10);
+
+    cog::stack stk;
+    service_registry sr;
+
+    stk.push_back(0);
+    stk.push_back(5);
+    stk.push_back(1.5f);
+
+    assert_eq(vn->invoke(stk, sr, true), value(10));
+    assert_log_message(log_level::error, "could not convert argument 3 from float(1.5) to sector");
+    assert_log_message(log_level::error, "could not convert argument 1 from int(0) to thing");
+    assert_log_empty();
+
+    assert_true(stk.empty());
+}
+
+test_case(service_verb_pushes_after_arguments)
+{
+    auto vn = make_service_verb("myverb", [](bool,
+                                             service_registry &sr,
+                                             int a) {
+            sr.get<cog::stack>().push_back(a * 2);
+        });
+
+    cog::stack stk;
+    service_registry sr;
+    sr.add(stk);
+
+    stk.push_back(1);
+    stk.push_back(21);
+
+    vn->invoke(stk, sr, false);
+
+    assert_eq(stk.size(), size_t(2));
+    assert_eq(stk[0], value(1));
+    assert_eq(stk[1], value(42));
 }
 
 test_case(safe_verb_order)
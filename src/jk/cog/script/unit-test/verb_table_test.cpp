@@ -48,6 +48,24 @@ test_case(verb_lookup)
     assert_log_empty();
 }
 
+test_case(verb_effect)
+{
+    verb_table vt;
+
+    vt.add_verb("myverb", [] { });
+    vt.add_verb("otherverb", [] { });
+    vt.add_synonym("myverb", "mysynonym");
+
+    vt.set_verb_effect("mysynonym", verb_effect::pure);
+
+    assert_true(vt.get_verb_effect(vt.get_verb_id("myverb")) == verb_effect::pure);
+    assert_true(vt.get_verb_effect(vt.get_verb_id("otherverb")) == verb_effect::world);
+
+    assert_throws_logged(vt.set_verb_effect("undefined", verb_effect::local));
+    assert_log_message(log_level::error, "undefined verb 'undefined' cannot have an effect");
+    assert_log_empty();
+}
+
 test_case(verb_deprecation)
 {
     verb_table vt;
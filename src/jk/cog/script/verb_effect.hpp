@@ -0,0 +1,19 @@
+#pragma once
+
+namespace gorc {
+    namespace cog {
+
+        // Side effects of a verb, ordered from weakest to strongest.
+        enum class verb_effect {
+            // Result depends only on the arguments
+            pure,
+
+            // Reads shared state, or modifies only the running continuation
+            local,
+
+            // Modifies state shared with other cogs or the engine
+            world
+        };
+
+    }
+}
@@ -8,6 +8,7 @@ void gorc::cog::verb_table::internal_add_verb(std::unique_ptr<verb> &&v)
     }
 
     verbs.push_back(std::forward<std::unique_ptr<verb>>(v));
+    effects.push_back(verb_effect::world);
 }
 
 void gorc::cog::verb_table::add_synonym(std::string const &name,
@@ -27,6 +28,22 @@ void gorc::cog::verb_table::add_deprecation(std::string const &name)
     std::get<1>(it->second) = true;
 }
 
+void gorc::cog::verb_table::set_verb_effect(std::string const &name, verb_effect effect)
+{
+    auto it = verb_index.find(name);
+    if(it == verb_index.end()) {
+        LOG_FATAL(format("undefined verb '%s' cannot have an effect") %
+                  name);
+    }
+
+    effects[static_cast<size_t>(std::get<0>(it->second))] = effect;
+}
+
+gorc::cog::verb_effect gorc::cog::verb_table::get_verb_effect(verb_id id) const
+{
+    return effects[static_cast<size_t>(static_cast<int>(id))];
+}
+
 gorc::verb_id gorc::cog::verb_table::get_verb_id(std::string const &name) const
 {
     auto it = verb_index.find(name);
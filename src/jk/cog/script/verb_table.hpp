@@ -4,6 +4,7 @@
 #include "type.hpp"
 #include "mock_verb.hpp"
 #include "function_verb.hpp"
+#include "verb_effect.hpp"
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -15,6 +16,7 @@ namespace gorc {
         class verb_table {
         private:
             std::vector<std::unique_ptr<verb>> verbs;
+            std::vector<verb_effect> effects;
             std::unordered_map<std::string, std::tuple<int, bool>> verb_index;
 
             void internal_add_verb(std::unique_ptr<verb> &&v);
@@ -54,6 +56,10 @@ namespace gorc {
 
             void add_deprecation(std::string const &name);
 
+            // Verbs are assumed to modify shared state unless declared otherwise.
+            void set_verb_effect(std::string const &name, verb_effect effect);
+            verb_effect get_verb_effect(verb_id) const;
+
             verb_id get_verb_id(std::string const &name) const;
             verb const& get_verb(verb_id) const;
         };
@@ -1,17 +1,13 @@
 #include "call_stack_frame.hpp"
 
-gorc::cog::call_stack_frame::call_stack_frame(cog_id instance_id,
-                                              size_t program_counter,
-                                              value sender,
-                                              value sender_id,
-                                              value source,
-                                              value param0,
-                                              value param1,
-                                              value param2,
-                                              value param3)
-    : instance_id(instance_id)
-    , program_counter(program_counter)
-    , sender(sender)
+gorc::cog::message_parameters::message_parameters(value sender,
+                                                  value sender_id,
+                                                  value source,
+                                                  value param0,
+                                                  value param1,
+                                                  value param2,
+                                                  value param3)
+    : sender(sender)
     , sender_id(sender_id)
     , source(source)
     , param0(param0)
@@ -22,28 +18,21 @@ gorc::cog::call_stack_frame::call_stack_frame(cog_id instance_id,
     return;
 }
 
-gorc::cog::call_stack_frame::call_stack_frame(deserialization_constructor_tag,
-                                              binary_input_stream &bis)
-    : instance_id(deserialization_constructor, bis)
-    , program_counter(binary_deserialize<size_t>(bis))
-    , sender(binary_deserialize<value>(bis))
+gorc::cog::message_parameters::message_parameters(deserialization_constructor_tag,
+                                                  binary_input_stream &bis)
+    : sender(binary_deserialize<value>(bis))
     , sender_id(binary_deserialize<value>(bis))
     , source(binary_deserialize<value>(bis))
     , param0(binary_deserialize<value>(bis))
     , param1(binary_deserialize<value>(bis))
     , param2(binary_deserialize<value>(bis))
     , param3(binary_deserialize<value>(bis))
-    , return_register(binary_deserialize<value>(bis))
-    , save_return_register(binary_deserialize<bool>(bis))
-    , push_return_register(binary_deserialize<bool>(bis))
 {
     return;
 }
 
-void gorc::cog::call_stack_frame::binary_serialize_object(binary_output_stream &bos) const
+void gorc::cog::message_parameters::binary_serialize_object(binary_output_stream &bos) const
 {
-    binary_serialize(bos, instance_id);
-    binary_serialize(bos, program_counter);
     binary_serialize(bos, sender);
     binary_serialize(bos, sender_id);
     binary_serialize(bos, source);
@@ -51,6 +40,35 @@ void gorc::cog::call_stack_frame::binary_serialize_object(binary_output_stream &
     binary_serialize(bos, param1);
     binary_serialize(bos, param2);
     binary_serialize(bos, param3);
+}
+
+gorc::cog::call_stack_frame::call_stack_frame(cog_id instance_id,
+                                              size_t program_counter,
+                                              size_t message_index)
+    : instance_id(instance_id)
+    , program_counter(program_counter)
+    , message_index(message_index)
+{
+    return;
+}
+
+gorc::cog::call_stack_frame::call_stack_frame(deserialization_constructor_tag,
+                                              binary_input_stream &bis)
+    : instance_id(deserialization_constructor, bis)
+    , program_counter(binary_deserialize<size_t>(bis))
+    , message_index(binary_deserialize<size_t>(bis))
+    , return_register(binary_deserialize<value>(bis))
+    , save_return_register(binary_deserialize<bool>(bis))
+    , push_return_register(binary_deserialize<bool>(bis))
+{
+    return;
+}
+
+void gorc::cog::call_stack_frame::binary_serialize_object(binary_output_stream &bos) const
+{
+    binary_serialize(bos, instance_id);
+    binary_serialize(bos, program_counter);
+    binary_serialize(bos, message_index);
     binary_serialize(bos, return_register);
     binary_serialize(bos, save_return_register);
     binary_serialize(bos, push_return_register);
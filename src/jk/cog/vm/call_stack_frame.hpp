@@ -10,10 +10,10 @@
 namespace gorc {
     namespace cog {
 
-        class call_stack_frame {
+        // Arguments of a message. Frames created by subroutine calls within a
+        // message handler refer to the parameters of the handler's frame.
+        class message_parameters {
         public:
-            cog_id instance_id;
-            size_t program_counter;
             value sender;
             value sender_id;
             value source;
@@ -22,6 +22,26 @@ namespace gorc {
             value param2;
             value param3;
 
+            message_parameters(value sender,
+                               value sender_id,
+                               value source,
+                               value param0,
+                               value param1,
+                               value param2,
+                               value param3);
+
+            message_parameters(deserialization_constructor_tag, binary_input_stream &);
+            void binary_serialize_object(binary_output_stream &) const;
+        };
+
+        class call_stack_frame {
+        public:
+            cog_id instance_id;
+            size_t program_counter;
+
+            // Index of the frame's message parameters within the continuation.
+            size_t message_index;
+
             value return_register;
 
             // Apply return register to next frame on return.
@@ -32,13 +52,7 @@ namespace gorc {
 
             call_stack_frame(cog_id instance_id,
                              size_t program_counter,
-                             value sender,
-                             value sender_id,
-                             value source,
-                             value param0,
-                             value param1,
-                             value param2,
-                             value param3);
+                             size_t message_index);
 
             call_stack_frame(deserialization_constructor_tag, binary_input_stream &);
             void binary_serialize_object(binary_output_stream &) const;
@@ -1,23 +1,67 @@
 #include "continuation.hpp"
 
-gorc::cog::continuation::continuation(call_stack_frame &&frame)
+gorc::cog::continuation::continuation(cog_id instance_id,
+                                      size_t program_counter,
+                                      message_parameters const &params)
 {
-    call_stack.push_back(std::forward<call_stack_frame>(frame));
+    push_message_frame(instance_id, program_counter, params);
 }
 
 gorc::cog::continuation::continuation(deserialization_constructor_tag, binary_input_stream &bis)
 {
     binary_deserialize_range<call_stack_frame>(bis, std::back_inserter(call_stack));
+    binary_deserialize_range<message_parameters>(bis, std::back_inserter(messages));
     binary_deserialize_range<value>(bis, std::back_inserter(data_stack));
 }
 
 void gorc::cog::continuation::binary_serialize_object(binary_output_stream &bos) const
 {
     binary_serialize_range(bos, call_stack);
+    binary_serialize_range(bos, messages);
     binary_serialize_range(bos, data_stack);
 }
 
+gorc::cog::call_stack_frame& gorc::cog::continuation::push_message_frame(
+        cog_id instance_id,
+        size_t program_counter,
+        message_parameters const &params)
+{
+    messages.push_back(params);
+    call_stack.emplace_back(instance_id, program_counter, messages.size() - 1);
+    return call_stack.back();
+}
+
+gorc::cog::call_stack_frame& gorc::cog::continuation::push_call_frame(size_t program_counter)
+{
+    call_stack.emplace_back(frame().instance_id, program_counter, frame().message_index);
+    return call_stack.back();
+}
+
+void gorc::cog::continuation::pop_frame()
+{
+    call_stack.pop_back();
+
+    // Message frames are nested, so parameters above the new top frame's are
+    // no longer referenced.
+    size_t live_messages = call_stack.empty() ? 0 : (call_stack.back().message_index + 1);
+    while(messages.size() > live_messages) {
+        messages.pop_back();
+    }
+}
+
+void gorc::cog::continuation::clear()
+{
+    call_stack.clear();
+    messages.clear();
+    data_stack.clear();
+}
+
 gorc::cog::call_stack_frame& gorc::cog::continuation::frame()
 {
     return call_stack.back();
 }
+
+gorc::cog::message_parameters& gorc::cog::continuation::message()
+{
+    return messages[call_stack.back().message_index];
+}
@@ -13,15 +13,33 @@ namespace gorc {
         class continuation {
         public:
             std::vector<call_stack_frame> call_stack;
+            std::vector<message_parameters> messages;
             cog::stack data_stack;
 
             continuation() = default;
-            explicit continuation(call_stack_frame &&frame);
+            continuation(cog_id instance_id,
+                         size_t program_counter,
+                         message_parameters const &params);
 
             continuation(deserialization_constructor_tag, binary_input_stream &);
             void binary_serialize_object(binary_output_stream &) const;
 
+            // Pushes the frame of a message handler with its own parameters.
+            call_stack_frame& push_message_frame(cog_id instance_id,
+                                                 size_t program_counter,
+                                                 message_parameters const &params);
+
+            // Pushes the frame of a subroutine. The frame shares the message
+            // parameters of the current frame.
+            call_stack_frame& push_call_frame(size_t program_counter);
+
+            void pop_frame();
+
+            // Empties the continuation without releasing its storage.
+            void clear();
+
             call_stack_frame& frame();
+            message_parameters& message();
         };
 
     }
@@ -0,0 +1,35 @@
+#include "continuation_pool.hpp"
+
+constexpr size_t gorc::cog::continuation_pool::max_free_continuations;
+constexpr size_t gorc::cog::continuation_pool::initial_call_depth;
+constexpr size_t gorc::cog::continuation_pool::initial_data_depth;
+
+std::unique_ptr<gorc::cog::continuation> gorc::cog::continuation_pool::acquire()
+{
+    if(free_continuations.empty()) {
+        auto rv = std::make_unique<continuation>();
+        rv->call_stack.reserve(initial_call_depth);
+        rv->messages.reserve(initial_call_depth);
+        rv->data_stack.reserve(initial_data_depth);
+        return rv;
+    }
+
+    auto rv = std::move(free_continuations.back());
+    free_continuations.pop_back();
+    return rv;
+}
+
+void gorc::cog::continuation_pool::release(std::unique_ptr<continuation> cc)
+{
+    if(!cc || free_continuations.size() >= max_free_continuations) {
+        return;
+    }
+
+    cc->clear();
+    free_continuations.push_back(std::move(cc));
+}
+
+size_t gorc::cog::continuation_pool::free_count() const
+{
+    return free_continuations.size();
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "continuation.hpp"
+#include <memory>
+#include <vector>
+
+namespace gorc {
+    namespace cog {
+
+        // Recycles continuations between messages. Released continuations keep
+        // their stack storage, so typical messages run without allocating.
+        class continuation_pool {
+        private:
+            std::vector<std::unique_ptr<continuation>> free_continuations;
+
+        public:
+            static constexpr size_t max_free_continuations = 64;
+            static constexpr size_t initial_call_depth = 8;
+            static constexpr size_t initial_data_depth = 32;
+
+            std::unique_ptr<continuation> acquire();
+            void release(std::unique_ptr<continuation> cc);
+
+            size_t free_count() const;
+        };
+
+    }
+}
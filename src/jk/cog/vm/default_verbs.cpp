@@ -79,13 +79,13 @@ namespace {
 
                 switch(param_num) {
                 case 0:
-                    return cc.frame().param0;
+                    return cc.message().param0;
                 case 1:
-                    return cc.frame().param1;
+                    return cc.message().param1;
                 case 2:
-                    return cc.frame().param2;
+                    return cc.message().param2;
                 case 3:
-                    return cc.frame().param3;
+                    return cc.message().param3;
                 default:
                     LOG_ERROR(format("getparam number %d is out of bounds") % param_num);
                     return value();
@@ -107,7 +107,7 @@ namespace {
 
             virtual cog::value invoke(cog::stack &, service_registry &sr, bool) const override
             {
-                return sr.get<continuation>().frame().sender_id;
+                return sr.get<continuation>().message().sender_id;
             }
         };
 
@@ -125,7 +125,7 @@ namespace {
 
             virtual cog::value invoke(cog::stack &, service_registry &sr, bool) const override
             {
-                return sr.get<continuation>().frame().sender;
+                return sr.get<continuation>().message().sender;
             }
         };
 
@@ -144,7 +144,7 @@ namespace {
             virtual cog::value invoke(cog::stack &, service_registry &sr, bool) const override
             {
                 return value_type_to_message_thing_type(
-                    sr.get<continuation>().frame().sender.get_type());
+                    sr.get<continuation>().message().sender.get_type());
             }
         };
 
@@ -162,7 +162,7 @@ namespace {
 
             virtual cog::value invoke(cog::stack &, service_registry &sr, bool) const override
             {
-                return sr.get<continuation>().frame().source;
+                return sr.get<continuation>().message().source;
             }
         };
 
@@ -181,7 +181,7 @@ namespace {
             virtual cog::value invoke(cog::stack &, service_registry &sr, bool) const override
             {
                 return value_type_to_message_thing_type(
-                    sr.get<continuation>().frame().source.get_type());
+                    sr.get<continuation>().message().source.get_type());
             }
         };
 
@@ -199,7 +199,10 @@ namespace {
                     cc.data_stack.push_back(value());
                 }
 
-                exec.add_sleep_record(std::make_unique<sleep_record>(continuation(cc),
+                auto sleeping_cc = sr.get<continuation_pool>().acquire();
+                *sleeping_cc = cc;
+
+                exec.add_sleep_record(std::make_unique<sleep_record>(std::move(sleeping_cc),
                                                                      time_delta(time)));
                 throw suspend_exception();
             });
@@ -216,9 +219,12 @@ namespace {
                     cc.data_stack.push_back(value());
                 }
 
+                auto waiting_cc = sr.get<continuation_pool>().acquire();
+                *waiting_cc = cc;
+
                 exec.add_wait_record(message_type::arrived,
                                      tid,
-                                     std::make_unique<continuation>(cc));
+                                     std::move(waiting_cc));
                 throw suspend_exception();
             });
 
@@ -362,25 +368,25 @@ namespace {
                 auto &cc = sr.get<continuation>();
                 auto &exec = sr.get<executor>();
 
-                auto frame = exec.create_message_frame(cog,
-                                                       msg,
-                                                       /* sender */ cc.frame().instance_id,
-                                                       /* TODO: senderid */ value(),
-                                                       /* TODO: source */ value(),
-                                                       param0,
-                                                       param1,
-                                                       param2,
-                                                       param3);
-                if(!frame.has_value()) {
+                auto addr = exec.get_message_handler(cog, msg);
+                if(!addr.has_value()) {
                     // Warning has already been logged
                     return value();
                 }
 
-                auto &real_frame = frame.get_value();
-                real_frame.save_return_register = false;
-                real_frame.push_return_register = ev;
+                auto &frame = cc.push_message_frame(cog,
+                                                    addr.get_value(),
+                                                    message_parameters(
+                                                        /* sender */ cc.frame().instance_id,
+                                                        /* TODO: senderid */ value(),
+                                                        /* TODO: source */ value(),
+                                                        param0,
+                                                        param1,
+                                                        param2,
+                                                        param3));
 
-                cc.call_stack.push_back(real_frame);
+                frame.save_return_register = false;
+                frame.push_return_register = ev;
 
                 throw restart_exception();
             }
@@ -411,25 +417,25 @@ namespace {
                 auto &cc = sr.get<continuation>();
                 auto &exec = sr.get<executor>();
 
-                auto frame = exec.create_message_frame(cog,
-                                                       msg,
-                                                       /* sender */ cc.frame().instance_id,
-                                                       /* TODO: senderid */ value(),
-                                                       /* TODO: source */ value(),
-                                                       value(),
-                                                       value(),
-                                                       value(),
-                                                       value());
-                if(!frame.has_value()) {
+                auto addr = exec.get_message_handler(cog, msg);
+                if(!addr.has_value()) {
                     // Warning has already been logged
                     return value();
                 }
 
-                auto &real_frame = frame.get_value();
-                real_frame.save_return_register = false;
-                real_frame.push_return_register = ev;
+                auto &frame = cc.push_message_frame(cog,
+                                                    addr.get_value(),
+                                                    message_parameters(
+                                                        /* sender */ cc.frame().instance_id,
+                                                        /* TODO: senderid */ value(),
+                                                        /* TODO: source */ value(),
+                                                        value(),
+                                                        value(),
+                                                        value(),
+                                                        value()));
 
-                cc.call_stack.push_back(real_frame);
+                frame.save_return_register = false;
+                frame.push_return_register = ev;
 
                 throw restart_exception();
             }
@@ -456,6 +462,19 @@ namespace {
                 return exec.get_master_cog();
             });
 
+        // Verbs which only touch the running continuation
+        for(auto const &name : { "returnex",
+                                 "getparam",
+                                 "getsenderid",
+                                 "getsenderref",
+                                 "getsendertype",
+                                 "getsourceref",
+                                 "getsourcetype",
+                                 "getselfcog",
+                                 "getmastercog" }) {
+            verbs.set_verb_effect(name, verb_effect::local);
+        }
+
         return;
     }
 
@@ -533,9 +552,34 @@ namespace {
         verbs.add_verb("vectorcross", [](vector<3> a, vector<3> b) {
                 return cross(a, b);
             });
+
+        // Bit and vector verbs depend only on their arguments. Random verbs
+        // share a generator, so they are left out and keep their order.
+        for(auto const &name : { "bitclear",
+                                 "bitset",
+                                 "bittest",
+                                 "vectorx",
+                                 "vectory",
+                                 "vectorz",
+                                 "vectorset",
+                                 "vectoradd",
+                                 "vectorsub",
+                                 "vectorscale",
+                                 "vectorlen",
+                                 "vectordist",
+                                 "vectornorm",
+                                 "vectordot",
+                                 "vectorcross" }) {
+            verbs.set_verb_effect(name, verb_effect::pure);
+        }
     }
 }
 
+void gorc::cog::seed_random_verbs(unsigned int seed)
+{
+    rng.seed(seed);
+}
+
 void gorc::cog::default_populate_verb_table(verb_table &verbs)
 {
     add_system_verbs(verbs);
@@ -7,5 +7,9 @@ namespace gorc {
 
         void default_populate_verb_table(verb_table &verbs);
 
+        // Restarts the generator behind rand and randvec. Seeding before a
+        // level starts makes its scripts repeatable.
+        void seed_random_verbs(unsigned int seed);
+
     }
 }
@@ -0,0 +1,104 @@
+#include "execution_profiler.hpp"
+#include <algorithm>
+
+gorc::cog::execution_profiler::execution_profiler()
+{
+    opcode_counts.fill(0);
+}
+
+void gorc::cog::execution_profiler::record_call_depth(size_t depth)
+{
+    if(current_message) {
+        current_message->max_call_depth = std::max(current_message->max_call_depth, depth);
+    }
+}
+
+void gorc::cog::execution_profiler::record_verb_call(std::string const &name,
+                                                     clock::duration time)
+{
+    auto &stats = verbs[name];
+    ++stats.calls;
+    stats.time += time;
+}
+
+void gorc::cog::execution_profiler::sample_queues(time_delta dt,
+                                                  size_t sleep_records,
+                                                  size_t wait_records,
+                                                  size_t timer_records,
+                                                  size_t pulse_records)
+{
+    elapsed += dt;
+
+    execution_queue_sample sample;
+    sample.time = elapsed;
+    sample.sleep_records = sleep_records;
+    sample.wait_records = wait_records;
+    sample.timer_records = timer_records;
+    sample.pulse_records = pulse_records;
+    queue_samples.push_back(sample);
+}
+
+uint64_t gorc::cog::execution_profiler::get_opcode_count(opcode op) const
+{
+    return opcode_counts[static_cast<uint8_t>(op)];
+}
+
+std::map<gorc::cog::execution_profiler::message_key, gorc::cog::execution_message_stats> const &
+    gorc::cog::execution_profiler::get_messages() const
+{
+    return messages;
+}
+
+std::map<std::string, gorc::cog::execution_verb_stats> const &
+    gorc::cog::execution_profiler::get_verbs() const
+{
+    return verbs;
+}
+
+std::vector<gorc::cog::execution_queue_sample> const &
+    gorc::cog::execution_profiler::get_queue_samples() const
+{
+    return queue_samples;
+}
+
+gorc::cog::execution_profiler_message_scope::execution_profiler_message_scope(
+        execution_profiler *profiler,
+        std::string const &script,
+        char const *message)
+    : profiler(profiler)
+{
+    if(!profiler) {
+        return;
+    }
+
+    auto &stats = profiler->messages[std::make_tuple(script, std::string(message))];
+    ++stats.sends;
+
+    previous_message = profiler->current_message;
+    profiler->current_message = &stats;
+}
+
+gorc::cog::execution_profiler_message_scope::~execution_profiler_message_scope()
+{
+    if(profiler) {
+        profiler->current_message = previous_message;
+    }
+}
+
+gorc::cog::execution_profiler_verb_scope::execution_profiler_verb_scope(
+        execution_profiler *profiler,
+        std::string const &name)
+    : profiler(profiler)
+    , name(name)
+{
+    if(profiler) {
+        start = execution_profiler::clock::now();
+    }
+}
+
+gorc::cog::execution_profiler_verb_scope::~execution_profiler_verb_scope()
+{
+    if(profiler) {
+        profiler->record_verb_call(name, execution_profiler::clock::now() - start);
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "opcode.hpp"
+#include "utility/time.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace gorc {
+    namespace cog {
+
+        class execution_message_stats {
+        public:
+            uint64_t sends = 0;
+            uint64_t instructions = 0;
+            size_t max_call_depth = 0;
+        };
+
+        class execution_verb_stats {
+        public:
+            uint64_t calls = 0;
+            std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero();
+        };
+
+        class execution_queue_sample {
+        public:
+            time_delta time;
+            size_t sleep_records;
+            size_t wait_records;
+            size_t timer_records;
+            size_t pulse_records;
+        };
+
+        // Counts instructions and times verb calls while cogs execute.
+        // Profiling is enabled by registering a profiler as a service of the
+        // executor. Message handlers that would run concurrently are run in
+        // sequence while a profiler is registered.
+        class execution_profiler {
+        public:
+            using clock = std::chrono::steady_clock;
+
+            // Handlers are identified by script filename and message name.
+            // Continuations resumed after a sleep or wait are recorded under
+            // the message name "resume".
+            using message_key = std::tuple<std::string, std::string>;
+
+        private:
+            std::array<uint64_t, 256> opcode_counts;
+            std::map<message_key, execution_message_stats> messages;
+            std::map<std::string, execution_verb_stats> verbs;
+            std::vector<execution_queue_sample> queue_samples;
+            time_delta elapsed = 0.0s;
+
+            execution_message_stats *current_message = nullptr;
+
+            friend class execution_profiler_message_scope;
+
+        public:
+            execution_profiler();
+
+            void count_instruction(opcode op)
+            {
+                ++opcode_counts[static_cast<uint8_t>(op)];
+                if(current_message) {
+                    ++current_message->instructions;
+                }
+            }
+
+            void record_call_depth(size_t depth);
+            void record_verb_call(std::string const &name, clock::duration time);
+            void sample_queues(time_delta dt,
+                               size_t sleep_records,
+                               size_t wait_records,
+                               size_t timer_records,
+                               size_t pulse_records);
+
+            uint64_t get_opcode_count(opcode op) const;
+            std::map<message_key, execution_message_stats> const &get_messages() const;
+            std::map<std::string, execution_verb_stats> const &get_verbs() const;
+            std::vector<execution_queue_sample> const &get_queue_samples() const;
+        };
+
+        // Attributes instructions to a message handler until destroyed.
+        // Does nothing when the profiler is null.
+        class execution_profiler_message_scope {
+        private:
+            execution_profiler *profiler;
+            execution_message_stats *previous_message = nullptr;
+
+        public:
+            execution_profiler_message_scope(execution_profiler *profiler,
+                                             std::string const &script,
+                                             char const *message);
+            ~execution_profiler_message_scope();
+
+            execution_profiler_message_scope(execution_profiler_message_scope const &) = delete;
+            execution_profiler_message_scope &
+                operator=(execution_profiler_message_scope const &) = delete;
+        };
+
+        // Times a verb call until destroyed, including calls that suspend
+        // the continuation. Does nothing when the profiler is null.
+        class execution_profiler_verb_scope {
+        private:
+            execution_profiler *profiler;
+            std::string const &name;
+            execution_profiler::clock::time_point start;
+
+        public:
+            execution_profiler_verb_scope(execution_profiler *profiler, std::string const &name);
+            ~execution_profiler_verb_scope();
+
+            execution_profiler_verb_scope(execution_profiler_verb_scope const &) = delete;
+            execution_profiler_verb_scope &
+                operator=(execution_profiler_verb_scope const &) = delete;
+        };
+
+    }
+}
@@ -1,6 +1,17 @@
 #include "executor.hpp"
 #include "log/log.hpp"
+#include "log/log_buffer.hpp"
+#include "profile/profiler.hpp"
 #include "utility/range.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+namespace {
+    // Update messages are sent concurrently only in batches of at least this size
+    constexpr size_t min_concurrent_update_messages = 8;
+}
 
 bool gorc::cog::detail::executor_link_comp::operator()(value left, value right) const
 {
@@ -35,6 +46,7 @@ gorc::cog::executor::executor(service_registry const &parent)
 {
     services.add(*this);
     services.add(vm);
+    services.add(continuations);
     return;
 }
 
@@ -44,33 +56,13 @@ gorc::cog::executor::executor(deserialization_constructor_tag, binary_input_stre
 {
     services.add(*this);
     services.add(vm);
+    services.add(continuations);
 
     binary_deserialize_range(bis, std::back_inserter(instances), [](auto &bis) {
         return std::make_unique<instance>(deserialization_constructor, bis);
     });
 
-    binary_deserialize_range(bis, std::back_inserter(sleep_records), [](auto &bis) {
-        return std::make_unique<sleep_record>(deserialization_constructor, bis);
-    });
-
-    binary_deserialize_range(bis, std::inserter(wait_records, wait_records.end()), [](auto &bis) {
-        auto mt = binary_deserialize<message_type>(bis);
-        auto obj = binary_deserialize<value>(bis);
-        auto cont = std::make_unique<continuation>(deserialization_constructor, bis);
-        return std::make_pair(std::make_tuple(mt, obj), std::move(cont));
-    });
-
-    binary_deserialize_range(bis, std::inserter(pulse_records, pulse_records.end()), [](auto &is) {
-        auto inst = binary_deserialize<cog_id>(is);
-        return std::make_pair(inst, pulse_record(deserialization_constructor, is));
-    });
-
-    binary_deserialize_range(bis, std::inserter(timer_records, timer_records.end()), [](auto &is) {
-        auto inst = binary_deserialize<cog_id>(is);
-        auto timer_id = binary_deserialize<value>(is);
-        return std::make_pair(std::make_tuple(inst, timer_id),
-                              timer_record(deserialization_constructor, is));
-    });
+    binary_deserialize_schedule(bis);
 
     binary_deserialize_range(bis, std::inserter(linkages, linkages.end()), [](auto &bis) {
         auto obj = binary_deserialize<value>(bis);
@@ -94,6 +86,23 @@ void gorc::cog::executor::binary_serialize_object(binary_output_stream &bos) con
         binary_serialize(bos, *em);
     });
 
+    binary_serialize_schedule(bos);
+
+    binary_serialize_range(bos, linkages, [](auto &bos, auto const &em) {
+        binary_serialize(bos, em.first);
+        binary_serialize(bos, em.second);
+    });
+
+    binary_serialize_range(bos, global_instance_map, [](auto &bos, auto const &em) {
+        binary_serialize(bos, em.first);
+        binary_serialize(bos, em.second);
+    });
+
+    binary_serialize(bos, master_cog);
+}
+
+void gorc::cog::executor::binary_serialize_schedule(binary_output_stream &bos) const
+{
     binary_serialize_range(bos, sleep_records, [](auto &bos, auto const &em) {
         binary_serialize(bos, *em);
     });
@@ -114,18 +123,42 @@ void gorc::cog::executor::binary_serialize_object(binary_output_stream &bos) con
         binary_serialize(bos, std::get<1>(em.first));
         binary_serialize(bos, em.second);
     });
+}
 
-    binary_serialize_range(bos, linkages, [](auto &bos, auto const &em) {
-        binary_serialize(bos, em.first);
-        binary_serialize(bos, em.second);
+void gorc::cog::executor::binary_deserialize_schedule(binary_input_stream &bis)
+{
+    binary_deserialize_range(bis, std::back_inserter(sleep_records), [](auto &bis) {
+        return std::make_unique<sleep_record>(deserialization_constructor, bis);
     });
 
-    binary_serialize_range(bos, global_instance_map, [](auto &bos, auto const &em) {
-        binary_serialize(bos, em.first);
-        binary_serialize(bos, em.second);
+    binary_deserialize_range(bis, std::inserter(wait_records, wait_records.end()), [](auto &bis) {
+        auto mt = binary_deserialize<message_type>(bis);
+        auto obj = binary_deserialize<value>(bis);
+        auto cont = std::make_unique<continuation>(deserialization_constructor, bis);
+        return std::make_pair(std::make_tuple(mt, obj), std::move(cont));
     });
 
-    binary_serialize(bos, master_cog);
+    binary_deserialize_range(bis, std::inserter(pulse_records, pulse_records.end()), [](auto &is) {
+        auto inst = binary_deserialize<cog_id>(is);
+        return std::make_pair(inst, pulse_record(deserialization_constructor, is));
+    });
+
+    binary_deserialize_range(bis, std::inserter(timer_records, timer_records.end()), [](auto &is) {
+        auto inst = binary_deserialize<cog_id>(is);
+        auto timer_id = binary_deserialize<value>(is);
+        return std::make_pair(std::make_tuple(inst, timer_id),
+                              timer_record(deserialization_constructor, is));
+    });
+}
+
+void gorc::cog::executor::restore_schedule(binary_input_stream &bis)
+{
+    sleep_records.clear();
+    wait_records.clear();
+    pulse_records.clear();
+    timer_records.clear();
+
+    binary_deserialize_schedule(bis);
 }
 
 void gorc::cog::executor::add_linkage(cog_id id, instance const &inst)
@@ -213,15 +246,7 @@ void gorc::cog::executor::set_pulse(cog_id instance_id, maybe<time_delta> durati
              [&](time_delta dt) { pulse_records.emplace(instance_id, pulse_record(dt)); });
 }
 
-gorc::maybe<gorc::cog::call_stack_frame> gorc::cog::executor::create_message_frame(cog_id target,
-                                                                                   message_type msg,
-                                                                                   value sender,
-                                                                                   value sender_id,
-                                                                                   value source,
-                                                                                   value param0,
-                                                                                   value param1,
-                                                                                   value param2,
-                                                                                   value param3)
+gorc::maybe<size_t> gorc::cog::executor::get_message_handler(cog_id target, message_type msg)
 {
     int inst_index = static_cast<int>(target);
     if(inst_index < 0 || static_cast<size_t>(inst_index) >= instances.size()) {
@@ -238,8 +263,7 @@ gorc::maybe<gorc::cog::call_stack_frame> gorc::cog::executor::create_message_fra
         return nothing;
     }
 
-    return call_stack_frame(
-        target, addr.get_value(), sender, sender_id, source, param0, param1, param2, param3);
+    return addr.get_value();
 }
 
 gorc::cog::value gorc::cog::executor::send(cog_id instance,
@@ -260,15 +284,29 @@ gorc::cog::value gorc::cog::executor::send(cog_id instance,
         return value();
     }
 
+    PROFILE_ZONE_TAGGED("cog message", inst->cog->filename.c_str(), as_string(t));
+    execution_profiler_message_scope ps(get_profiler(), inst->cog->filename, as_string(t));
+
     diagnostic_context dc(inst->cog->filename.c_str());
     LOG_DEBUG(format("instance %d received %s message %s "
                      "from sender %s due to source %s") %
               static_cast<int>(instance) % send_reason % as_string(t) % as_string(sender) %
               as_string(source));
 
-    continuation cc(call_stack_frame(
-        instance, addr.get_value(), sender, sender_id, source, param0, param1, param2, param3));
-    return vm.execute(globals, verbs, *this, services, cc);
+    auto cc = continuations.acquire();
+    cc->push_message_frame(instance,
+                           addr.get_value(),
+                           message_parameters(sender,
+                                              sender_id,
+                                              source,
+                                              param0,
+                                              param1,
+                                              param2,
+                                              param3));
+
+    auto rv = vm.execute(globals, verbs, *this, services, *cc);
+    continuations.release(std::move(cc));
+    return rv;
 }
 
 void gorc::cog::executor::send_to_all(message_type t,
@@ -320,11 +358,156 @@ void gorc::cog::executor::send_to_linked(message_type t,
     auto wait_rng = wait_records.equal_range(std::make_tuple(t, sender));
     for(auto it = wait_rng.first; it != wait_rng.second;) {
         auto curr_it = it++;
+        PROFILE_ZONE("cog resume");
+        execution_profiler_message_scope ps(
+                get_profiler(),
+                get_instance(curr_it->second->frame().instance_id).cog->filename,
+                "resume");
         vm.execute(globals, verbs, *this, services, *curr_it->second);
+        continuations.release(std::move(curr_it->second));
         wait_records.erase(curr_it);
     }
 }
 
+gorc::cog::executor::update_message::update_message(cog_id instance,
+                                                    message_type type,
+                                                    value sender_id,
+                                                    value param0,
+                                                    value param1)
+    : instance(instance)
+    , type(type)
+    , sender_id(sender_id)
+    , param0(param0)
+    , param1(param1)
+{
+    return;
+}
+
+bool gorc::cog::executor::is_concurrent_handler(cog_id instance, message_type msg) const
+{
+    auto const &inst = at_id(instances, instance);
+    return inst->cog->exports.get_effect(msg) != verb_effect::world;
+}
+
+gorc::cog::execution_profiler *gorc::cog::executor::get_profiler() const
+{
+    if(!services.has<execution_profiler>()) {
+        return nullptr;
+    }
+
+    return &services.get<execution_profiler>();
+}
+
+void gorc::cog::executor::send_update_messages()
+{
+    if(update_messages.size() == 1) {
+        auto msg = update_messages.front();
+        update_messages.clear();
+
+        send(msg.instance,
+             msg.type,
+             /* sender */ value(),
+             msg.sender_id,
+             /* source */ value(),
+             msg.param0,
+             msg.param1);
+        return;
+    }
+
+    // Handlers only modify their own instance and continuation. Diagnostics
+    // are captured per message and forwarded afterward in send order.
+    class update_result {
+    public:
+        std::unique_ptr<continuation> cc;
+        log_buffer log;
+        std::exception_ptr error;
+    };
+
+    std::vector<update_result> results(update_messages.size());
+    for(size_t i = 0; i < update_messages.size(); ++i) {
+        auto const &msg = update_messages[i];
+        auto const &inst = at_id(instances, msg.instance);
+
+        results[i].cc = continuations.acquire();
+        results[i].cc->push_message_frame(msg.instance,
+                                          inst->cog->exports.get_offset(msg.type).get_value(),
+                                          message_parameters(/* sender */ value(),
+                                                             msg.sender_id,
+                                                             /* source */ value(),
+                                                             msg.param0,
+                                                             msg.param1,
+                                                             /* param2 */ value(),
+                                                             /* param3 */ value()));
+    }
+
+    std::atomic<size_t> next_job(0);
+    execution_profiler *profiler = get_profiler();
+
+    auto update_thread = [&]() {
+        for(size_t i = next_job++; i < update_messages.size(); i = next_job++) {
+            auto const &msg = update_messages[i];
+            auto &result = results[i];
+
+            scoped_log_capture capture(result.log);
+            try {
+                auto const &inst = at_id(instances, msg.instance);
+                PROFILE_ZONE_TAGGED("cog message",
+                                    inst->cog->filename.c_str(),
+                                    as_string(msg.type));
+                execution_profiler_message_scope ps(profiler,
+                                                    inst->cog->filename,
+                                                    as_string(msg.type));
+
+                diagnostic_context dc(inst->cog->filename.c_str());
+                LOG_DEBUG(format("instance %d received direct message %s "
+                                 "from sender %s due to source %s") %
+                          static_cast<int>(msg.instance) % as_string(msg.type) %
+                          as_string(value()) % as_string(value()));
+
+                // Each handler sees its own continuation
+                service_registry handler_services(&services);
+                vm.execute(globals, verbs, *this, handler_services, *result.cc);
+            }
+            catch(...) {
+                result.error = std::current_exception();
+            }
+        }
+    };
+
+    // Profiler counters are not synchronized. Small batches finish sooner
+    // than workers wake up.
+    if(profiler || update_messages.size() < min_concurrent_update_messages) {
+        update_thread();
+    }
+    else {
+        if(!update_workers) {
+            size_t threads = std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+            update_workers = std::make_unique<worker_pool>(threads - 1);
+        }
+
+        update_workers->run(update_thread);
+        concurrent_update_messages += update_messages.size();
+    }
+
+    update_messages.clear();
+
+    // Every handler ran to completion or failure, so all diagnostics are
+    // forwarded before the first failure is reported.
+    std::exception_ptr first_error;
+    for(auto &result : results) {
+        result.log.replay();
+        if(!first_error) {
+            first_error = result.error;
+        }
+
+        continuations.release(std::move(result.cc));
+    }
+
+    if(first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
 void gorc::cog::executor::set_master_cog(cog_id id)
 {
     master_cog = id;
@@ -337,6 +520,8 @@ gorc::cog_id gorc::cog::executor::get_master_cog() const
 
 void gorc::cog::executor::update(time_delta dt)
 {
+    concurrent_update_messages = 0;
+
     // Decrement times first.
     // Continuations may insert new records. The new records shouldn't be decremented this frame.
     for(auto &timer_record : timer_records) {
@@ -353,57 +538,80 @@ void gorc::cog::executor::update(time_delta dt)
 
     // Intentionally quadratic. The timer records data structure may be modified by timer event
     // handlers. Repeatedly searching the map is still more efficient than copying this data.
+    // Consecutive due handlers which cannot modify the records are sent together.
     while(true) {
-        bool seen_any = false;
-        for(auto it = timer_records.begin(); it != timer_records.end(); ++it) {
-            if(it->second.remaining <= 0.0s) {
-                cog_id instance = std::get<0>(it->first);
-                value sender_id = std::get<1>(it->first);
-                value param0 = it->second.param0;
-                value param1 = it->second.param1;
-
-                timer_records.erase(it);
-
-                send(instance,
-                     message_type::timer,
-                     /* sender */ value(),
-                     sender_id,
-                     /* source */ value(),
-                     param0,
-                     param1);
-
-                seen_any = true;
+        for(auto it = timer_records.begin(); it != timer_records.end();) {
+            if(it->second.remaining > 0.0s) {
+                ++it;
+                continue;
+            }
+
+            cog_id instance = std::get<0>(it->first);
+            bool concurrent = is_concurrent_handler(instance, message_type::timer);
+
+            if(!update_messages.empty()) {
+                bool same_instance = std::any_of(update_messages.begin(),
+                                                 update_messages.end(),
+                                                 [&](update_message const &msg) {
+                                                     return msg.instance == instance;
+                                                 });
+                if(!concurrent || same_instance) {
+                    break;
+                }
+            }
+
+            update_messages.emplace_back(instance,
+                                         message_type::timer,
+                                         /* sender id */ std::get<1>(it->first),
+                                         it->second.param0,
+                                         it->second.param1);
+
+            it = timer_records.erase(it);
+
+            if(!concurrent) {
                 break;
             }
         }
 
-        if(!seen_any) {
+        if(update_messages.empty()) {
             break;
         }
+
+        send_update_messages();
     }
 
     // Intentionally quadratic. The pulse records data structure may be modified by pulse event
     // handlers. Repeatedly searching the map is still more efficient than copying this data.
     while(true) {
-        bool seen_any = false;
         for(auto it = pulse_records.begin(); it != pulse_records.end(); ++it) {
-            if(it->second.remaining <= 0.0s) {
-                it->second.remaining += it->second.duration;
+            if(it->second.remaining > 0.0s) {
+                continue;
+            }
 
-                send(it->first,
-                     message_type::pulse,
-                     /* sender */ value(),
-                     /* sender id */ value(),
-                     /* source */ value());
+            bool concurrent = is_concurrent_handler(it->first, message_type::pulse);
+            if(!concurrent && !update_messages.empty()) {
+                break;
+            }
+
+            it->second.remaining += it->second.duration;
+
+            update_messages.emplace_back(it->first,
+                                         message_type::pulse,
+                                         /* sender id */ value(),
+                                         /* param0 */ value(),
+                                         /* param1 */ value());
 
-                seen_any = true;
+            // A pulse which is still due is sent again before any later pulse
+            if(!concurrent || it->second.remaining <= 0.0s) {
                 break;
             }
         }
 
-        if(!seen_any) {
+        if(update_messages.empty()) {
             break;
         }
+
+        send_update_messages();
     }
 
     for(auto it = sleep_records.begin(); it != sleep_records.end();) {
@@ -412,10 +620,25 @@ void gorc::cog::executor::update(time_delta dt)
             std::swap(*it, sleep_records.back());
             sleep_records.pop_back();
 
-            vm.execute(globals, verbs, *this, services, sr->cc);
+            PROFILE_ZONE("cog resume");
+            execution_profiler_message_scope ps(
+                    get_profiler(),
+                    get_instance(sr->cc->frame().instance_id).cog->filename,
+                    "resume");
+            vm.execute(globals, verbs, *this, services, *sr->cc);
+            continuations.release(std::move(sr->cc));
         }
         else {
             ++it;
         }
     }
+
+    auto profiler = get_profiler();
+    if(profiler) {
+        profiler->sample_queues(dt,
+                                sleep_records.size(),
+                                wait_records.size(),
+                                timer_records.size(),
+                                pulse_records.size());
+    }
 }
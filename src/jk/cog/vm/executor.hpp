@@ -3,6 +3,8 @@
 #include "call_stack_frame.hpp"
 #include "content/asset_ref.hpp"
 #include "content/id.hpp"
+#include "continuation_pool.hpp"
+#include "execution_profiler.hpp"
 #include "executor_linkage.hpp"
 #include "heap.hpp"
 #include "instance.hpp"
@@ -15,6 +17,7 @@
 #include "timer_record.hpp"
 #include "utility/range.hpp"
 #include "utility/service_registry.hpp"
+#include "utility/worker_pool.hpp"
 #include "virtual_machine.hpp"
 #include <map>
 #include <memory>
@@ -49,6 +52,7 @@ namespace gorc {
             heap globals;
             verb_table &verbs;
             virtual_machine vm;
+            continuation_pool continuations;
             service_registry services;
 
             std::vector<std::unique_ptr<instance>> instances;
@@ -68,6 +72,36 @@ namespace gorc {
             cog_id master_cog;
 
             void add_linkage(cog_id id, instance const &inst);
+            void binary_deserialize_schedule(binary_input_stream &);
+
+            // Timer or pulse message due during an update
+            class update_message {
+            public:
+                cog_id instance;
+                message_type type;
+                value sender_id;
+                value param0;
+                value param1;
+
+                update_message(cog_id instance,
+                               message_type type,
+                               value sender_id,
+                               value param0,
+                               value param1);
+            };
+
+            // Due messages waiting to be sent. Reused between updates.
+            std::vector<update_message> update_messages;
+
+            // Sends large batches of update messages. Started on first use.
+            std::unique_ptr<worker_pool> update_workers;
+            size_t concurrent_update_messages = 0;
+
+            // Handlers which cannot modify shared state may run alongside
+            // handlers belonging to other instances.
+            bool is_concurrent_handler(cog_id instance, message_type msg) const;
+            execution_profiler *get_profiler() const;
+            void send_update_messages();
 
         public:
             executor(service_registry const &svc);
@@ -75,6 +109,14 @@ namespace gorc {
 
             void binary_serialize_object(binary_output_stream &) const;
 
+            // Writes only the scheduled work: sleeping and waiting
+            // continuations, pulses and timers.
+            void binary_serialize_schedule(binary_output_stream &) const;
+
+            // Replaces the scheduled work with work written by
+            // binary_serialize_schedule. Instances are left as they are.
+            void restore_schedule(binary_input_stream &);
+
             cog_id create_instance(asset_ref<cog::script>);
             cog_id create_instance(asset_ref<cog::script>, std::vector<value> const &);
             cog_id create_global_instance(asset_ref<cog::script>);
@@ -87,15 +129,8 @@ namespace gorc {
             void erase_timer_record(cog_id, value id);
             void set_pulse(cog_id, maybe<time_delta>);
 
-            maybe<call_stack_frame> create_message_frame(cog_id instance,
-                                                         message_type msg,
-                                                         value sender,
-                                                         value sender_id,
-                                                         value source,
-                                                         value param0,
-                                                         value param1,
-                                                         value param2,
-                                                         value param3);
+            // Returns the address of the instance's handler for the message.
+            maybe<size_t> get_message_handler(cog_id instance, message_type msg);
 
             value send(cog_id instance,
                        message_type msg,
@@ -131,10 +166,32 @@ namespace gorc {
 
             void update(time_delta dt);
 
+            // Number of timer and pulse messages sent concurrently during
+            // the most recent update.
+            inline size_t get_concurrent_update_messages() const
+            {
+                return concurrent_update_messages;
+            }
+
             inline auto get_linkages() const
             {
                 return make_range(linkages);
             }
+
+            inline heap& get_globals()
+            {
+                return globals;
+            }
+
+            inline heap const& get_globals() const
+            {
+                return globals;
+            }
+
+            inline auto get_instances() const
+            {
+                return make_range(instances);
+            }
         };
     }
 }
@@ -3,6 +3,7 @@
 #include "jk/cog/script/value.hpp"
 #include "io/binary_input_stream.hpp"
 #include "io/binary_output_stream.hpp"
+#include "utility/span.hpp"
 #include <vector>
 
 namespace gorc {
@@ -24,6 +25,11 @@ namespace gorc {
 
             size_t size() const;
 
+            inline span<value const> get_values() const
+            {
+                return make_span(values);
+            }
+
             inline auto begin() -> decltype(values.begin())
             {
                 return values.begin();
@@ -0,0 +1,45 @@
+#include "opcode.hpp"
+#include <stdexcept>
+
+char const *gorc::cog::as_string(opcode op)
+{
+    switch(op) {
+    case opcode::push: return "push";
+    case opcode::dup: return "dup";
+    case opcode::load: return "load";
+    case opcode::loadi: return "loadi";
+    case opcode::loadg: return "loadg";
+    case opcode::loadgi: return "loadgi";
+    case opcode::stor: return "stor";
+    case opcode::stori: return "stori";
+    case opcode::storg: return "storg";
+    case opcode::storgi: return "storgi";
+    case opcode::jmp: return "jmp";
+    case opcode::jal: return "jal";
+    case opcode::bt: return "bt";
+    case opcode::bf: return "bf";
+    case opcode::call: return "call";
+    case opcode::callv: return "callv";
+    case opcode::ret: return "ret";
+    case opcode::neg: return "neg";
+    case opcode::lnot: return "lnot";
+    case opcode::add: return "add";
+    case opcode::sub: return "sub";
+    case opcode::mul: return "mul";
+    case opcode::div: return "div";
+    case opcode::mod: return "mod";
+    case opcode::bor: return "bor";
+    case opcode::band: return "band";
+    case opcode::bxor: return "bxor";
+    case opcode::lor: return "lor";
+    case opcode::land: return "land";
+    case opcode::eq: return "eq";
+    case opcode::ne: return "ne";
+    case opcode::gt: return "gt";
+    case opcode::ge: return "ge";
+    case opcode::lt: return "lt";
+    case opcode::le: return "le";
+    }
+
+    throw std::range_error("not a valid opcode");
+}
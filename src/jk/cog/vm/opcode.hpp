@@ -50,5 +50,7 @@ namespace gorc {
             lt, // LT : less than
             le, // LE : less or equal
         };
+
+        char const *as_string(opcode);
     }
 }
@@ -4,16 +4,17 @@
 #include "utility/time.hpp"
 #include "io/binary_input_stream.hpp"
 #include "io/binary_output_stream.hpp"
+#include <memory>
 
 namespace gorc {
     namespace cog {
 
         class sleep_record {
         public:
-            continuation cc;
+            std::unique_ptr<continuation> cc;
             time_delta expiration_time;
 
-            sleep_record(continuation &&cc,
+            sleep_record(std::unique_ptr<continuation> &&cc,
                          time_delta expiration_time);
 
             sleep_record(deserialization_constructor_tag, binary_input_stream &bis);
@@ -0,0 +1,57 @@
+#include "test/test.hpp"
+#include "jk/cog/vm/continuation_pool.hpp"
+
+using namespace gorc;
+using namespace gorc::cog;
+
+begin_suite(continuation_pool_test);
+
+test_case(acquire_reserves_stacks)
+{
+    continuation_pool pool;
+    auto cc = pool.acquire();
+
+    assert_true(cc->call_stack.empty());
+    assert_true(cc->call_stack.capacity() >= continuation_pool::initial_call_depth);
+    assert_true(cc->data_stack.capacity() >= continuation_pool::initial_data_depth);
+}
+
+test_case(release_recycles)
+{
+    continuation_pool pool;
+    auto cc = pool.acquire();
+    cc->push_message_frame(
+            cog_id(0),
+            0,
+            message_parameters(value(), value(), value(), value(), value(), value(), value()));
+    cc->data_stack.push_back(5);
+
+    auto *original = cc.get();
+    pool.release(std::move(cc));
+    assert_eq(pool.free_count(), size_t(1));
+
+    auto recycled = pool.acquire();
+    assert_eq(recycled.get(), original);
+    assert_eq(pool.free_count(), size_t(0));
+    assert_true(recycled->call_stack.empty());
+    assert_true(recycled->messages.empty());
+    assert_true(recycled->data_stack.empty());
+}
+
+test_case(release_is_bounded)
+{
+    continuation_pool pool;
+
+    std::vector<std::unique_ptr<continuation>> held;
+    for(size_t i = 0; i < continuation_pool::max_free_continuations + 4; ++i) {
+        held.push_back(pool.acquire());
+    }
+
+    for(auto &cc : held) {
+        pool.release(std::move(cc));
+    }
+
+    assert_eq(pool.free_count(), continuation_pool::max_free_continuations);
+}
+
+end_suite(continuation_pool_test);
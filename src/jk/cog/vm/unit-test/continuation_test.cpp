@@ -0,0 +1,74 @@
+#include "test/test.hpp"
+#include "jk/cog/vm/continuation.hpp"
+
+using namespace gorc;
+using namespace gorc::cog;
+
+namespace {
+    message_parameters make_params(int first)
+    {
+        return message_parameters(first,
+                                  first + 1,
+                                  first + 2,
+                                  first + 3,
+                                  first + 4,
+                                  first + 5,
+                                  first + 6);
+    }
+}
+
+begin_suite(continuation_test);
+
+test_case(call_frame_shares_message)
+{
+    continuation cc(cog_id(1), 10, make_params(0));
+    cc.push_call_frame(20);
+
+    assert_eq(cc.call_stack.size(), size_t(2));
+    assert_eq(cc.messages.size(), size_t(1));
+    assert_eq(cc.frame().instance_id, cog_id(1));
+    assert_eq(cc.frame().program_counter, size_t(20));
+    assert_eq(cc.message().param0, value(3));
+
+    cc.pop_frame();
+    assert_eq(cc.messages.size(), size_t(1));
+    assert_eq(cc.message().sender, value(0));
+}
+
+test_case(message_frame_released_on_pop)
+{
+    continuation cc(cog_id(1), 10, make_params(0));
+    cc.push_message_frame(cog_id(2), 30, make_params(100));
+    cc.push_call_frame(40);
+
+    assert_eq(cc.messages.size(), size_t(2));
+    assert_eq(cc.frame().instance_id, cog_id(2));
+    assert_eq(cc.message().sender, value(100));
+
+    cc.pop_frame();
+    assert_eq(cc.messages.size(), size_t(2));
+
+    cc.pop_frame();
+    assert_eq(cc.messages.size(), size_t(1));
+    assert_eq(cc.message().sender, value(0));
+
+    cc.pop_frame();
+    assert_true(cc.call_stack.empty());
+    assert_true(cc.messages.empty());
+}
+
+test_case(clear_keeps_capacity)
+{
+    continuation cc(cog_id(1), 10, make_params(0));
+    cc.data_stack.push_back(5);
+
+    auto capacity = cc.call_stack.capacity();
+    cc.clear();
+
+    assert_true(cc.call_stack.empty());
+    assert_true(cc.messages.empty());
+    assert_true(cc.data_stack.empty());
+    assert_eq(cc.call_stack.capacity(), capacity);
+}
+
+end_suite(continuation_test);
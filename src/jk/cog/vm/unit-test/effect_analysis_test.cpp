@@ -0,0 +1,158 @@
+#include "test/test.hpp"
+#include "jk/cog/codegen/effect_analysis.hpp"
+#include "jk/cog/ir/ir_printer.hpp"
+
+using namespace gorc;
+using namespace gorc::cog;
+
+namespace {
+    class effect_analysis_fixture : public test::fixture {
+    public:
+        verb_table verbs;
+        script cog;
+        ir_printer ir;
+
+        effect_analysis_fixture()
+            : ir(cog.program, cog.exports)
+        {
+            verbs.add_verb("pureverb", [](int value) { return value; });
+            verbs.add_verb("localverb", []() { });
+            verbs.add_verb("worldverb", []() { });
+
+            verbs.set_verb_effect("pureverb", verb_effect::pure);
+            verbs.set_verb_effect("localverb", verb_effect::local);
+        }
+
+        void call(std::string const &name)
+        {
+            ir.callv(verbs.get_verb_id(name), diagnostic_context_location());
+        }
+
+        verb_effect analyze(message_type msg)
+        {
+            ir.finalize();
+            perform_effect_analysis(cog, verbs);
+            return cog.exports.get_effect(msg);
+        }
+    };
+}
+
+begin_suite_fixture(effect_analysis_test, effect_analysis_fixture);
+
+test_case(local_only_handler_is_pure)
+{
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.load(0);
+    ir.push(value(1));
+    ir.add();
+    ir.stor(0);
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::pure);
+}
+
+test_case(strongest_verb_effect_is_recorded)
+{
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.push(value(1));
+    call("pureverb");
+    call("localverb");
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::local);
+}
+
+test_case(global_store_is_world_effect)
+{
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.push(value(1));
+    ir.storg(0);
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::world);
+}
+
+test_case(world_verb_is_world_effect)
+{
+    ir.label(ir.get_export_label(message_type::timer, "timer"));
+    call("localverb");
+    call("worldverb");
+    ir.ret();
+
+    assert_eq(analyze(message_type::timer), verb_effect::world);
+}
+
+test_case(subroutine_effects_are_followed)
+{
+    auto subroutine = ir.get_named_label("subroutine");
+
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.jal(subroutine);
+    ir.ret();
+
+    ir.label(subroutine);
+    call("worldverb");
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::world);
+}
+
+test_case(branch_effects_are_followed)
+{
+    auto taken = ir.get_named_label("taken");
+
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.load(0);
+    ir.bt(taken);
+    ir.ret();
+
+    ir.label(taken);
+    call("localverb");
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::local);
+}
+
+test_case(fallthrough_after_branch_is_followed)
+{
+    auto skipped = ir.get_named_label("skipped");
+
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.load(0);
+    ir.bf(skipped);
+    call("worldverb");
+
+    ir.label(skipped);
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::world);
+}
+
+test_case(unreachable_code_is_ignored)
+{
+    auto other = ir.get_named_label("other");
+
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.jmp(other);
+    call("worldverb");
+
+    ir.label(other);
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::pure);
+}
+
+test_case(handlers_are_classified_separately)
+{
+    ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+    ir.ret();
+
+    ir.label(ir.get_export_label(message_type::timer, "timer"));
+    call("worldverb");
+    ir.ret();
+
+    assert_eq(analyze(message_type::pulse), verb_effect::pure);
+    assert_eq(cog.exports.get_effect(message_type::timer), verb_effect::world);
+}
+
+end_suite(effect_analysis_test);
@@ -0,0 +1,99 @@
+#include "jk/cog/vm/execution_profiler.hpp"
+#include "test/test.hpp"
+
+using namespace gorc;
+using namespace gorc::cog;
+
+begin_suite(execution_profiler_test);
+
+test_case(counts_opcodes)
+{
+    execution_profiler prof;
+
+    prof.count_instruction(opcode::push);
+    prof.count_instruction(opcode::push);
+    prof.count_instruction(opcode::add);
+
+    assert_eq(prof.get_opcode_count(opcode::push), uint64_t(2));
+    assert_eq(prof.get_opcode_count(opcode::add), uint64_t(1));
+    assert_eq(prof.get_opcode_count(opcode::ret), uint64_t(0));
+}
+
+test_case(attributes_instructions_to_nested_messages)
+{
+    execution_profiler prof;
+
+    {
+        execution_profiler_message_scope outer(&prof, "a.cog", "startup");
+        prof.count_instruction(opcode::push);
+
+        {
+            execution_profiler_message_scope inner(&prof, "b.cog", "user0");
+            prof.count_instruction(opcode::push);
+            prof.count_instruction(opcode::push);
+            prof.record_call_depth(3);
+        }
+
+        prof.count_instruction(opcode::ret);
+    }
+
+    {
+        execution_profiler_message_scope again(&prof, "a.cog", "startup");
+        prof.count_instruction(opcode::ret);
+    }
+
+    auto const &messages = prof.get_messages();
+    assert_eq(messages.size(), size_t(2));
+
+    auto const &outer = messages.at(std::make_tuple(std::string("a.cog"), std::string("startup")));
+    assert_eq(outer.sends, uint64_t(2));
+    assert_eq(outer.instructions, uint64_t(3));
+    assert_eq(outer.max_call_depth, size_t(0));
+
+    auto const &inner = messages.at(std::make_tuple(std::string("b.cog"), std::string("user0")));
+    assert_eq(inner.sends, uint64_t(1));
+    assert_eq(inner.instructions, uint64_t(2));
+    assert_eq(inner.max_call_depth, size_t(3));
+}
+
+test_case(null_profiler_scopes)
+{
+    std::string name = "print";
+    execution_profiler_message_scope ms(nullptr, "a.cog", "startup");
+    execution_profiler_verb_scope vs(nullptr, name);
+}
+
+test_case(times_verbs)
+{
+    execution_profiler prof;
+    std::string name = "print";
+
+    {
+        execution_profiler_verb_scope vs(&prof, name);
+    }
+
+    {
+        execution_profiler_verb_scope vs(&prof, name);
+    }
+
+    assert_eq(prof.get_verbs().size(), size_t(1));
+    assert_eq(prof.get_verbs().at("print").calls, uint64_t(2));
+}
+
+test_case(samples_queues)
+{
+    execution_profiler prof;
+
+    prof.sample_queues(0.5s, 1, 2, 3, 4);
+    prof.sample_queues(0.25s, 5, 6, 7, 8);
+
+    auto const &samples = prof.get_queue_samples();
+    assert_eq(samples.size(), size_t(2));
+    assert_eq(samples[1].time.count(), 0.75);
+    assert_eq(samples[1].sleep_records, size_t(5));
+    assert_eq(samples[1].wait_records, size_t(6));
+    assert_eq(samples[1].timer_records, size_t(7));
+    assert_eq(samples[1].pulse_records, size_t(8));
+}
+
+end_suite(execution_profiler_test);
@@ -0,0 +1,239 @@
+#include "test/test.hpp"
+#include "jk/cog/codegen/effect_analysis.hpp"
+#include "jk/cog/ir/ir_printer.hpp"
+#include "jk/cog/vm/executor.hpp"
+#include "io/memory_file.hpp"
+#include <string>
+
+using namespace gorc;
+using namespace gorc::cog;
+
+namespace {
+    class executor_fixture : public test::fixture {
+    public:
+        verb_table verbs;
+        service_registry services;
+
+        script local_cog;
+        script world_cog;
+        script noting_cog;
+        script failing_cog;
+
+        std::unique_ptr<executor> exec;
+
+        executor_fixture()
+        {
+            verbs.add_verb("worldverb", []() { });
+            verbs.add_verb("noteverb", [](int n) { LOG_INFO(format("note %d") % n); });
+            verbs.add_verb("failverb", []() { LOG_FATAL("handler failed"); });
+            verbs.set_verb_effect("noteverb", verb_effect::local);
+            verbs.set_verb_effect("failverb", verb_effect::local);
+            services.add(verbs);
+
+            // Both pulse handlers count their calls in their own heap
+            make_pulse_script(local_cog, false);
+            make_pulse_script(world_cog, true);
+
+            // Note the value of their first heap slot, and optionally fail
+            make_noting_script(noting_cog, false);
+            make_noting_script(failing_cog, true);
+
+            exec = std::make_unique<executor>(services);
+        }
+
+        void make_pulse_script(script &cog, bool call_world_verb)
+        {
+            ir_printer ir(cog.program, cog.exports);
+            ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+            ir.load(0);
+            ir.push(value(1));
+            ir.add();
+            ir.stor(0);
+
+            if(call_world_verb) {
+                ir.callv(verbs.get_verb_id("worldverb"), diagnostic_context_location());
+            }
+
+            ir.ret();
+            ir.finalize();
+
+            perform_effect_analysis(cog, verbs);
+        }
+
+        void make_noting_script(script &cog, bool fail)
+        {
+            cog.filename = fail ? "failing.cog" : "noting.cog";
+
+            ir_printer ir(cog.program, cog.exports);
+            ir.label(ir.get_export_label(message_type::pulse, "pulse"));
+            ir.load(0);
+            ir.callv(verbs.get_verb_id("noteverb"), diagnostic_context_location());
+
+            if(fail) {
+                ir.callv(verbs.get_verb_id("failverb"), diagnostic_context_location());
+            }
+
+            ir.ret();
+            ir.finalize();
+
+            perform_effect_analysis(cog, verbs);
+        }
+
+        std::vector<cog_id> make_pulsing_instances(script const &cog, size_t count)
+        {
+            std::vector<cog_id> rv;
+            for(size_t i = 0; i < count; ++i) {
+                auto id = exec->create_instance(asset_ref<script>(cog, asset_id(0)));
+                exec->get_instance(id).memory[0] = value(0);
+                exec->set_pulse(id, time_delta(1.0));
+                rv.push_back(id);
+            }
+
+            return rv;
+        }
+
+        int get_pulse_count(cog_id id)
+        {
+            return static_cast<int>(exec->get_instance(id).memory[0]);
+        }
+
+        std::string get_schedule()
+        {
+            memory_file mf;
+            {
+                binary_output_stream bos(mf);
+                exec->binary_serialize_schedule(bos);
+            }
+
+            return std::string(mf.data(), mf.size());
+        }
+    };
+}
+
+begin_suite_fixture(executor_test, executor_fixture);
+
+test_case(independent_pulses_are_batched)
+{
+    auto ids = make_pulsing_instances(local_cog, 32);
+
+    exec->update(time_delta(1.0));
+    assert_eq(exec->get_concurrent_update_messages(), size_t(32));
+
+    exec->update(time_delta(1.0));
+    assert_eq(exec->get_concurrent_update_messages(), size_t(32));
+
+    for(auto id : ids) {
+        assert_eq(get_pulse_count(id), 2);
+    }
+}
+
+test_case(world_effect_pulses_are_sent_serially)
+{
+    auto ids = make_pulsing_instances(world_cog, 32);
+
+    exec->update(time_delta(1.0));
+    assert_eq(exec->get_concurrent_update_messages(), size_t(0));
+
+    for(auto id : ids) {
+        assert_eq(get_pulse_count(id), 1);
+    }
+}
+
+test_case(small_batches_are_sent_serially)
+{
+    auto ids = make_pulsing_instances(local_cog, 3);
+
+    exec->update(time_delta(1.0));
+    assert_eq(exec->get_concurrent_update_messages(), size_t(0));
+
+    for(auto id : ids) {
+        assert_eq(get_pulse_count(id), 1);
+    }
+}
+
+test_case(world_effect_pulse_splits_batch)
+{
+    auto first = make_pulsing_instances(local_cog, 10);
+    auto world = make_pulsing_instances(world_cog, 1);
+    auto second = make_pulsing_instances(local_cog, 10);
+
+    exec->update(time_delta(1.0));
+    assert_eq(exec->get_concurrent_update_messages(), size_t(20));
+
+    assert_eq(get_pulse_count(world.front()), 1);
+    for(auto id : first) {
+        assert_eq(get_pulse_count(id), 1);
+    }
+
+    for(auto id : second) {
+        assert_eq(get_pulse_count(id), 1);
+    }
+}
+
+test_case(failed_handler_logs_whole_batch)
+{
+    auto ids = make_pulsing_instances(noting_cog, 4);
+    auto failing = make_pulsing_instances(failing_cog, 1);
+    auto rest = make_pulsing_instances(noting_cog, 4);
+    ids.insert(ids.end(), failing.begin(), failing.end());
+    ids.insert(ids.end(), rest.begin(), rest.end());
+
+    for(size_t i = 0; i < ids.size(); ++i) {
+        exec->get_instance(ids[i]).memory[0] = value(static_cast<int>(i));
+    }
+
+    assert_throws_logged(exec->update(time_delta(1.0)));
+    assert_eq(exec->get_concurrent_update_messages(), size_t(9));
+
+    for(int i = 0; i < 9; ++i) {
+        std::string filename = (i == 4) ? "failing.cog" : "noting.cog";
+        assert_log_message(log_level::info, str(format("%s: note %d") % filename % i));
+        if(i == 4) {
+            assert_log_message(log_level::error, "failing.cog: handler failed");
+        }
+    }
+
+    assert_log_empty();
+}
+
+test_case(schedule_follows_pending_work)
+{
+    auto idle_schedule = get_schedule();
+
+    auto id = make_pulsing_instances(local_cog, 1).front();
+    auto pulse_schedule = get_schedule();
+    assert_true(pulse_schedule != idle_schedule);
+
+    exec->add_timer_record(id, value(1), time_delta(5.0), value(), value());
+    assert_true(get_schedule() != pulse_schedule);
+
+    exec->erase_timer_record(id, value(1));
+    assert_eq(get_schedule(), pulse_schedule);
+
+    exec->set_pulse(id, nothing);
+    assert_eq(get_schedule(), idle_schedule);
+}
+
+test_case(restore_schedule_replaces_pending_work)
+{
+    auto id = make_pulsing_instances(local_cog, 1).front();
+    exec->add_timer_record(id, value(1), time_delta(5.0), value(), value());
+    auto saved_schedule = get_schedule();
+
+    exec->erase_timer_record(id, value(1));
+    exec->set_pulse(id, nothing);
+    exec->add_timer_record(id, value(2), time_delta(3.0), value(), value());
+
+    memory_file mf;
+    mf.write(saved_schedule.data(), saved_schedule.size());
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+    exec->restore_schedule(bis);
+
+    assert_eq(get_schedule(), saved_schedule);
+
+    exec->update(time_delta(1.0));
+    assert_eq(get_pulse_count(id), 1);
+}
+
+end_suite(executor_test);
@@ -1,5 +1,6 @@
 #include "virtual_machine.hpp"
 #include "continuation.hpp"
+#include "execution_profiler.hpp"
 #include "executor.hpp"
 #include "instance.hpp"
 #include "io/binary_input_stream.hpp"
@@ -22,6 +23,15 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
     // System verbs must modify the current continuation.
     services.add_or_replace(cc);
 
+    // Loads must not resize the global heap: message handlers without global
+    // stores may run concurrently.
+    heap const &const_globals = globals;
+
+    execution_profiler *profiler = nullptr;
+    if(services.has<execution_profiler>()) {
+        profiler = &services.get<execution_profiler>();
+    }
+
     instance *current_instance = &exec.get_instance(cc.frame().instance_id);
     memory_file::reader sr(current_instance->cog->program);
     sr.set_position(cc.frame().program_counter);
@@ -30,6 +40,10 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
 
     while(true) {
         opcode op = binary_deserialize<opcode>(bsr);
+        if(profiler) {
+            profiler->count_instruction(op);
+        }
+
         switch(op) {
         case opcode::push: {
             cog::value v(deserialization_constructor, bsr);
@@ -56,7 +70,7 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
 
         case opcode::loadg: {
             size_t addr = binary_deserialize<size_t>(bsr);
-            cc.data_stack.push_back(globals[addr]);
+            cc.data_stack.push_back(const_globals[addr]);
         } break;
 
         case opcode::loadgi: {
@@ -64,7 +78,7 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
             int idx = static_cast<int>(cc.data_stack.back());
             cc.data_stack.pop_back();
 
-            cc.data_stack.push_back(globals[static_cast<size_t>(addr + idx)]);
+            cc.data_stack.push_back(const_globals[static_cast<size_t>(addr + idx)]);
         } break;
 
         case opcode::stor: {
@@ -109,15 +123,10 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
             cc.call_stack.back().program_counter = sr.position();
 
             // Create new stack frame
-            cc.call_stack.push_back(call_stack_frame(cc.frame().instance_id,
-                                                     addr,
-                                                     cc.frame().sender,
-                                                     cc.frame().sender_id,
-                                                     cc.frame().source,
-                                                     cc.frame().param0,
-                                                     cc.frame().param1,
-                                                     cc.frame().param2,
-                                                     cc.frame().param3));
+            cc.push_call_frame(addr);
+            if(profiler) {
+                profiler->record_call_depth(cc.call_stack.size());
+            }
 
             // Jump
             sr.set_position(addr);
@@ -159,10 +168,17 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
             // Store current offset in current continuation
             cc.call_stack.back().program_counter = sr.position();
 
-            verbs.get_verb(verb_id(vid))
-                .invoke(cc.data_stack,
-                        services,
-                        /* expects value */ false);
+            auto const &v = verbs.get_verb(verb_id(vid));
+            {
+                execution_profiler_verb_scope vs(profiler, v.name);
+                v.invoke(cc.data_stack,
+                         services,
+                         /* expects value */ false);
+            }
+
+            // Verbs may run other continuations, which replace this one in the
+            // service registry.
+            services.add_or_replace(cc);
         } break;
 
         case opcode::callv: {
@@ -181,10 +197,16 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
             // Store current offset in current continuation
             cc.call_stack.back().program_counter = sr.position();
 
-            cog::value rv = verbs.get_verb(verb_id(vid))
-                                .invoke(cc.data_stack,
-                                        services,
-                                        /* expects value */ true);
+            auto const &v = verbs.get_verb(verb_id(vid));
+            cog::value rv;
+            {
+                execution_profiler_verb_scope vs(profiler, v.name);
+                rv = v.invoke(cc.data_stack,
+                              services,
+                              /* expects value */ true);
+            }
+
+            services.add_or_replace(cc);
             cc.data_stack.push_back(rv);
         } break;
 
@@ -194,7 +216,7 @@ gorc::cog::value gorc::cog::virtual_machine::internal_execute(heap &globals,
             bool save_return_register = cc.frame().save_return_register;
             bool push_return_register = cc.frame().push_return_register;
 
-            cc.call_stack.pop_back();
+            cc.pop_frame();
 
             if(cc.call_stack.empty()) {
                 return return_register;
@@ -5,6 +5,7 @@
 #include "content/image.hpp"
 #include "text/extract_path.hpp"
 #include "content/content_manager.hpp"
+#include "utility/fnv1a.hpp"
 #include <cstring>
 
 gorc::fourcc const gorc::colormap::type = "CMP"_4CC;
@@ -17,7 +18,7 @@ gorc::colormap_palette::colormap_palette(uninit_constructor_tag)
 gorc::colormap_palette::colormap_palette(deserialization_constructor_tag,
                                          binary_input_stream &bis)
 {
-    bis.read(data.data(), data.size() * sizeof(color_rgb8));
+    bis.read_span(make_span(data));
 }
 
 gorc::colormap_light_level::colormap_light_level(uninit_constructor_tag)
@@ -28,20 +29,19 @@ gorc::colormap_light_level::colormap_light_level(uninit_constructor_tag)
 gorc::colormap_light_level::colormap_light_level(deserialization_constructor_tag,
                                                  binary_input_stream &bis)
 {
-    for(auto &row : data) {
-        bis.read(row.data(), row.size() * sizeof(uint8_t));
-    }
+    static_assert(sizeof(data) == 64 * 256, "light level table must be tightly packed");
+    bis.read_span(make_span(data));
 }
 
 gorc::colormap_transparency_table::colormap_transparency_table(deserialization_constructor_tag,
                                                                binary_input_stream &bis)
 {
-    for(auto &row : data) {
-        bis.read(row.data(), row.size() * sizeof(uint8_t));
-    }
+    static_assert(sizeof(data) == 256 * 256, "transparency table must be tightly packed");
+    bis.read_span(make_span(data));
 }
 
 gorc::colormap::colormap(uninit_constructor_tag)
+    : rgba_levels(std::make_unique<colormap_rgba_levels>())
 {
     return;
 }
@@ -80,6 +80,8 @@ gorc::colormap::colormap(deserialization_constructor_tag, binary_input_stream &b
                                                 deserialization_constructor,
                                                 bis);
     }
+
+    update_rgba_levels();
 }
 
 namespace {
@@ -209,3 +211,35 @@ gorc::color_rgb8 gorc::colormap::get_light_color(int index) const
 {
     return get_color(index, 0);
 }
+
+void gorc::colormap::update_rgba_levels()
+{
+    if(!rgba_levels) {
+        rgba_levels = std::make_unique<colormap_rgba_levels>();
+    }
+
+    for(size_t level = 0; level < 64; ++level) {
+        auto const &light_level = light_levels->data[level];
+        auto &lut = rgba_levels->data[level];
+        for(size_t i = 0; i < 256; ++i) {
+            lut[i] = solid(palette->data[light_level[i]]);
+        }
+    }
+
+    rgba_hash = fnv1a_hash(rgba_levels->data.data(), sizeof(rgba_levels->data));
+}
+
+gorc::colormap_rgba_lut const& gorc::colormap::get_rgba_lut(int level) const
+{
+    return rgba_levels->data.at(level);
+}
+
+gorc::colormap_rgba_lut const& gorc::colormap::get_rgba_lut() const
+{
+    return get_rgba_lut(63);
+}
+
+gorc::colormap_rgba_lut const& gorc::colormap::get_light_rgba_lut() const
+{
+    return get_rgba_lut(0);
+}
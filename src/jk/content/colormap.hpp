@@ -30,6 +30,14 @@ namespace gorc {
         colormap_light_level(deserialization_constructor_tag, binary_input_stream &);
     };
 
+    // Palette colors for each color index, one table per light level.
+    using colormap_rgba_lut = std::array<color_rgba8, 256>;
+
+    class colormap_rgba_levels {
+    public:
+        std::array<colormap_rgba_lut, 64> data;
+    };
+
     class colormap_transparency_table {
     public:
         std::array<std::array<uint8_t, 256>, 256> data;
@@ -54,6 +62,12 @@ namespace gorc {
         std::unique_ptr<colormap_light_level> light_levels;
         std::unique_ptr<colormap_transparency_table> transparency_tables;
 
+        // Solid colors precomputed from the palette and light levels
+        std::unique_ptr<colormap_rgba_levels> rgba_levels;
+
+        // Fingerprint of the RGBA tables, for caches of decoded images
+        uint64_t rgba_hash = 0;
+
         explicit colormap(uninit_constructor_tag);
         colormap(deserialization_constructor_tag, binary_input_stream &);
 
@@ -63,6 +77,13 @@ namespace gorc {
 
         color_rgb8 get_color(int color_index) const;
         color_rgb8 get_light_color(int color_index) const;
+
+        // Rebuilds the RGBA tables after the palette or light levels change.
+        void update_rgba_levels();
+
+        colormap_rgba_lut const& get_rgba_lut(int light_level) const;
+        colormap_rgba_lut const& get_rgba_lut() const;
+        colormap_rgba_lut const& get_light_rgba_lut() const;
     };
 
     template <>
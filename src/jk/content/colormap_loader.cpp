@@ -9,7 +9,7 @@ std::unique_ptr<gorc::asset> gorc::colormap_loader::deserialize(input_stream &is
                                                                 service_registry const &,
                                                                 std::string const & /*name*/) const
 {
-    binary_input_stream bis(is);
+    binary_input_stream bis(is, binary_stream_buffer_size);
     return std::make_unique<colormap>(deserialization_constructor, bis);
 }
 
@@ -0,0 +1,113 @@
+#include "indexed_image.hpp"
+#include <array>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GORC_INDEXED_IMAGE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace {
+
+    using namespace gorc;
+
+    static_assert(sizeof(color_rgba8) == sizeof(uint32_t), "color_rgba8 must be tightly packed");
+
+    void make_lut(colormap_rgba_lut const &lut,
+                  maybe<int> transparent_index,
+                  colormap_rgba_lut &out)
+    {
+        out = lut;
+
+        maybe_if(transparent_index, [&](int index) {
+            if(index >= 0 && index < 256) {
+                get<3>(out[static_cast<size_t>(index)]) = 0;
+            }
+        });
+    }
+
+    void decode_texels_scalar(uint8_t const *texels,
+                              size_t count,
+                              color_rgba8 const *diffuse_lut,
+                              color_rgba8 const *light_lut,
+                              color_rgba8 *diffuse_out,
+                              color_rgba8 *light_out)
+    {
+        for(size_t i = 0; i < count; ++i) {
+            diffuse_out[i] = diffuse_lut[texels[i]];
+            light_out[i] = light_lut[texels[i]];
+        }
+    }
+
+#if defined(GORC_INDEXED_IMAGE_AVX2)
+    // Gathers eight texels from each table per iteration. Selected at run
+    // time, so the remainder of the build does not require AVX2.
+    __attribute__((target("avx2")))
+    void decode_texels_avx2(uint8_t const *texels,
+                            size_t count,
+                            color_rgba8 const *diffuse_lut,
+                            color_rgba8 const *light_lut,
+                            color_rgba8 *diffuse_out,
+                            color_rgba8 *light_out)
+    {
+        int const *diffuse_base = reinterpret_cast<int const *>(diffuse_lut);
+        int const *light_base = reinterpret_cast<int const *>(light_lut);
+
+        size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            __m128i packed = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(texels + i));
+            __m256i indices = _mm256_cvtepu8_epi32(packed);
+
+            __m256i diffuse = _mm256_i32gather_epi32(diffuse_base, indices, 4);
+            __m256i light = _mm256_i32gather_epi32(light_base, indices, 4);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(diffuse_out + i), diffuse);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(light_out + i), light);
+        }
+
+        decode_texels_scalar(texels + i,
+                             count - i,
+                             diffuse_lut,
+                             light_lut,
+                             diffuse_out + i,
+                             light_out + i);
+    }
+
+    bool has_avx2()
+    {
+        static bool const supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+#endif
+
+}
+
+void gorc::decode_indexed_texels(span<uint8_t const> texels,
+                                 colormap const &cmp,
+                                 maybe<int> transparent_index,
+                                 color_rgba8 *diffuse_out,
+                                 color_rgba8 *light_out)
+{
+    colormap_rgba_lut diffuse_lut;
+    colormap_rgba_lut light_lut;
+    make_lut(cmp.get_rgba_lut(), transparent_index, diffuse_lut);
+    make_lut(cmp.get_light_rgba_lut(), transparent_index, light_lut);
+
+#if defined(GORC_INDEXED_IMAGE_AVX2)
+    if(has_avx2()) {
+        decode_texels_avx2(texels.data(),
+                           texels.size(),
+                           diffuse_lut.data(),
+                           light_lut.data(),
+                           diffuse_out,
+                           light_out);
+        return;
+    }
+#endif
+
+    decode_texels_scalar(texels.data(),
+                         texels.size(),
+                         diffuse_lut.data(),
+                         light_lut.data(),
+                         diffuse_out,
+                         light_out);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "colormap.hpp"
+#include "math/color.hpp"
+#include "utility/maybe.hpp"
+#include "utility/span.hpp"
+#include <cstdint>
+
+namespace gorc {
+
+    // Converts 8-bit color indices into full-bright diffuse colors and light
+    // colors in a single pass. Texels equal to the transparent index receive
+    // zero alpha. Both output buffers must hold one color per texel.
+    void decode_indexed_texels(span<uint8_t const> texels,
+                               colormap const &cmp,
+                               maybe<int> transparent_index,
+                               color_rgba8 *diffuse_out,
+                               color_rgba8 *light_out);
+
+}
@@ -1,9 +1,13 @@
 #include "material_loader.hpp"
+#include "indexed_image.hpp"
 #include "libold/content/master_colormap.hpp"
 #include "material.hpp"
 #include "math/color.hpp"
 #include "raw_material.hpp"
 #include "renderer_object_factory.hpp"
+#include "texture_cache.hpp"
+#include "io/memory_file.hpp"
+#include "utility/fnv1a.hpp"
 #include <SFML/Graphics/Image.hpp>
 #include <boost/filesystem.hpp>
 
@@ -52,10 +56,17 @@ namespace {
     public:
         asset_ref<colormap> cmp;
         renderer_object_factory &obj_factory;
+        texture_cache *cache;
+        uint64_t material_hash;
 
-        indexed_material_processor(asset_ref<colormap> cmp, renderer_object_factory &obj_factory)
+        indexed_material_processor(asset_ref<colormap> cmp,
+                                   renderer_object_factory &obj_factory,
+                                   texture_cache *cache,
+                                   uint64_t material_hash)
             : cmp(cmp)
             , obj_factory(obj_factory)
+            , cache(cache)
+            , material_hash(material_hash)
         {
             return;
         }
@@ -65,78 +76,131 @@ namespace {
                                        material_id id,
                                        int cel_number) override
         {
-            grid<color_rgba8> col_img(make_size(color_tex_dim, color_tex_dim));
-            grid<color_rgba8> lht_img(make_size(color_tex_dim, color_tex_dim));
-
-            for(size_t y = 0; y < color_tex_dim; ++y) {
-                for(size_t x = 0; x < color_tex_dim; ++x) {
-                    col_img.get(x, y) = solid(cmp->get_color(cel.color_index));
-                    lht_img.get(x, y) = solid(cmp->get_light_color(cel.color_index));
-                }
-            }
+            grid<color_rgba8> col_img(make_size(color_tex_dim, color_tex_dim),
+                                      cmp->get_rgba_lut().at(cel.color_index));
+            grid<color_rgba8> lht_img(make_size(color_tex_dim, color_tex_dim),
+                                      cmp->get_light_rgba_lut().at(cel.color_index));
 
             obj_factory.set_material_image(id, cel_number, /* diffuse */ 0, col_img);
             obj_factory.set_material_image(id, cel_number, /* light */ 1, lht_img);
         }
 
-        virtual void process_texture_cel(raw_material_texture_record const &tex,
-                                         raw_material_cel_record const &cel,
-                                         raw_material const &mat,
-                                         material_id id,
-                                         int cel_number,
-                                         std::string const &base_name) override
+        void set_material_levels(material_id id,
+                                 int cel_number,
+                                 int channel,
+                                 std::vector<grid<color_rgba8>> const &levels)
         {
-            auto col_img = std::make_unique<grid<color_rgba8>>(make_size(tex.width, tex.height));
-            grid<color_rgba8> lht_img(make_size(tex.width, tex.height));
-
-            auto it = tex.image_data.at(0).begin();
-            auto end = tex.image_data.at(0).end();
+            if(levels.size() > 1) {
+                obj_factory.set_material_mipmaps(id, cel_number, channel, levels);
+            }
+            else {
+                obj_factory.set_material_image(id, cel_number, channel, levels.front());
+            }
+        }
 
-            int transparent_idx = -1;
+        void decode_texture_cel(raw_material_texture_record const &tex,
+                                raw_material_cel_record const &cel,
+                                raw_material const &mat,
+                                maybe<boost::filesystem::path> const &override_path,
+                                texture_cache_channels &channels)
+        {
+            maybe<int> transparent_idx;
             if(tex.uses_transparency) {
-                transparent_idx = mat.transparency;
+                transparent_idx = static_cast<int>(mat.transparency);
             }
 
-            for(size_t y = 0; y < tex.height; ++y) {
-                for(size_t x = 0; x < tex.width; ++x) {
-                    if(it == end) {
-                        LOG_FATAL(format("not enough data for texture %d") % cel.texture_index);
-                    }
+            // Use the mipmaps stored in the material, unless the diffuse
+            // image is replaced. Mipmaps are then generated by the renderer.
+            size_t level_count = override_path.has_value() ? 1 : tex.image_data.size();
 
-                    uint8_t idx = *it++;
-                    uint8_t alpha = 255;
-                    if(static_cast<int>(idx) == transparent_idx) {
-                        alpha = 0;
-                    }
+            channels.resize(2);
+            auto &col_levels = channels[0];
+            auto &lht_levels = channels[1];
 
-                    col_img->get(x, y) = make_color_rgba8(cmp->get_color(idx), alpha);
-                    lht_img.get(x, y) = make_color_rgba8(cmp->get_light_color(idx), alpha);
+            size_t width = tex.width;
+            size_t height = tex.height;
+            for(size_t level = 0; level < level_count && width > 0 && height > 0; ++level) {
+                auto const &texels = tex.image_data[level];
+                if(texels.size() < width * height) {
+                    LOG_FATAL(format("not enough data for texture %d") % cel.texture_index);
                 }
+
+                col_levels.emplace_back(make_size(width, height));
+                lht_levels.emplace_back(make_size(width, height));
+
+                decode_indexed_texels(make_span(texels.data(), width * height),
+                                      *cmp,
+                                      transparent_idx,
+                                      col_levels.back().data(),
+                                      lht_levels.back().data());
+
+                width >>= 1;
+                height >>= 1;
             }
 
-            // Check to see if there is an override for this cel
-            boost::filesystem::path p = base_name;
-            boost::filesystem::path newpath =
-                boost::filesystem::path("game/restricted/override/mat") / p.parent_path() /
-                boost::str(boost::format("%s-%d-0_rlt.png") % p.stem().generic_string() %
-                           cel_number);
-            if(boost::filesystem::exists(newpath)) {
+            if(col_levels.empty()) {
+                LOG_FATAL(format("not enough data for texture %d") % cel.texture_index);
+            }
+
+            if(override_path.has_value()) {
                 sf::Image img;
-                img.loadFromFile(newpath.generic_string());
+                img.loadFromFile(override_path.get_value().generic_string());
 
                 auto imgsize = img.getSize();
-                col_img = std::make_unique<grid<color_rgba8>>(make_size(imgsize.x, imgsize.y));
+                col_levels.clear();
+                col_levels.emplace_back(make_size(imgsize.x, imgsize.y));
+                auto &col_img = col_levels.back();
 
                 for(size_t y = 0; y < imgsize.y; ++y) {
                     for(size_t x = 0; x < imgsize.x; ++x) {
                         auto sfcol = img.getPixel(x, y);
-                        col_img->get(x, y) = make_color_rgba8(sfcol.r, sfcol.g, sfcol.b, sfcol.a);
+                        col_img.get(x, y) = make_color_rgba8(sfcol.r, sfcol.g, sfcol.b, sfcol.a);
                     }
                 }
             }
+        }
 
-            obj_factory.set_material_image(id, cel_number, /* diffuse */ 0, *col_img);
-            obj_factory.set_material_image(id, cel_number, /* light */ 1, lht_img);
+        virtual void process_texture_cel(raw_material_texture_record const &tex,
+                                         raw_material_cel_record const &cel,
+                                         raw_material const &mat,
+                                         material_id id,
+                                         int cel_number,
+                                         std::string const &base_name) override
+        {
+            // Check to see if there is an override for this cel
+            boost::filesystem::path p = base_name;
+            boost::filesystem::path newpath =
+                boost::filesystem::path("game/restricted/override/mat") / p.parent_path() /
+                boost::str(boost::format("%s-%d-0_rlt.png") % p.stem().generic_string() %
+                           cel_number);
+
+            boost::system::error_code ec;
+            auto override_time = boost::filesystem::last_write_time(newpath, ec);
+
+            maybe<boost::filesystem::path> override_path;
+            if(!ec) {
+                override_path = newpath;
+            }
+
+            texture_cache_key key;
+            key.material_hash = material_hash;
+            key.colormap_hash = cmp->rgba_hash;
+            key.override_time = override_path.has_value() ? static_cast<int64_t>(override_time) : 0;
+            key.cel = cel_number;
+
+            texture_cache_channels channels;
+            if(!cache || !cache->find(key, channels) || channels.size() != 2 ||
+               channels[0].empty() || channels[1].empty()) {
+                channels.clear();
+                decode_texture_cel(tex, cel, mat, override_path, channels);
+
+                if(cache) {
+                    cache->insert(key, channels);
+                }
+            }
+
+            set_material_levels(id, cel_number, /* diffuse */ 0, channels[0]);
+            set_material_levels(id, cel_number, /* light */ 1, channels[1]);
         }
     };
 }
@@ -149,7 +213,26 @@ std::unique_ptr<gorc::asset> gorc::material_loader::deserialize(input_stream &is
 {
     auto mat = std::make_unique<material>();
 
-    binary_input_stream bis(is);
+    texture_cache *cache = nullptr;
+    uint64_t material_hash = 0;
+
+    memory_file contents;
+    std::unique_ptr<memory_file::reader> contents_reader;
+    input_stream *material_stream = &is;
+
+    if(svc.has<texture_cache>()) {
+        // Decoded cels are cached by the contents of the material, so the
+        // whole file is read before parsing.
+        cache = &svc.get<texture_cache>();
+
+        is.copy_to(contents);
+        material_hash = fnv1a_hash(contents.data(), contents.size());
+
+        contents_reader = std::make_unique<memory_file::reader>(contents);
+        material_stream = contents_reader.get();
+    }
+
+    binary_input_stream bis(*material_stream);
     raw_material rm(deserialization_constructor, bis);
 
     material_id mid(static_cast<int>(id));
@@ -158,7 +241,9 @@ std::unique_ptr<gorc::asset> gorc::material_loader::deserialize(input_stream &is
     if(rm.bitdepth == 8) {
         proc = std::make_unique<indexed_material_processor>(
             svc.get<content::master_colormap>().cmp.get_value(),
-            svc.get<renderer_object_factory>());
+            svc.get<renderer_object_factory>(),
+            cache,
+            material_hash);
     }
     else {
         LOG_FATAL("unknown pixel format");
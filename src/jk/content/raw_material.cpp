@@ -70,7 +70,7 @@ gorc::raw_material_texture_record::raw_material_texture_record(deserialization_c
         auto &data = image_data.back();
 
         data.resize(next_width * next_height);
-        bis.read(&data[0], data.size());
+        bis.read_span(make_span(data));
 
         next_width >>= 1;
         next_height >>= 1;
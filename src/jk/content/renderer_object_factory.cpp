@@ -4,3 +4,11 @@ gorc::renderer_object_factory::~renderer_object_factory()
 {
     return;
 }
+
+void gorc::renderer_object_factory::set_material_mipmaps(material_id id,
+                                                         int cel,
+                                                         int channel,
+                                                         std::vector<grid<color_rgba8>> const &levels)
+{
+    set_material_image(id, cel, channel, levels.front());
+}
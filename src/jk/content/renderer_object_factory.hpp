@@ -3,6 +3,7 @@
 #include "math/grid.hpp"
 #include "math/color.hpp"
 #include "content/id.hpp"
+#include <vector>
 
 namespace gorc {
 
@@ -14,6 +15,13 @@ namespace gorc {
                                         int cel,
                                         int channel,
                                         grid<color_rgba8> const &img) = 0;
+
+        // Sets a material image with a precomputed mipmap chain. The first
+        // level is the full size image. By default, only the first level is used.
+        virtual void set_material_mipmaps(material_id,
+                                          int cel,
+                                          int channel,
+                                          std::vector<grid<color_rgba8>> const &levels);
     };
 
 }
@@ -0,0 +1,290 @@
+#include "texture_cache.hpp"
+#include "io/native_file.hpp"
+#include "log/log.hpp"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    using namespace gorc;
+
+    // Pack layout, in native byte order:
+    //   header: magic, version, entry count, session
+    //   index:  one record per entry, ordered by key
+    //   payloads
+    //
+    // Each payload holds a channel count, and for each channel a level count
+    // followed by the width, height and RGBA texels of each level.
+    constexpr char pack_magic[4] = { 'G', 'T', 'X', 'C' };
+    constexpr uint32_t pack_version = 2;
+
+    constexpr size_t header_size = sizeof(pack_magic) + 3 * sizeof(uint32_t);
+    constexpr size_t index_record_size = 3 * sizeof(uint64_t) + sizeof(int32_t) +
+                                         2 * sizeof(uint64_t) + sizeof(uint32_t);
+
+    class pack_reader {
+    private:
+        span<char const> data;
+        size_t offset = 0;
+
+    public:
+        explicit pack_reader(span<char const> data)
+            : data(data)
+        {
+            return;
+        }
+
+        template <typename T>
+        bool read(T &out)
+        {
+            if(data.size() - offset < sizeof(T)) {
+                return false;
+            }
+
+            std::memcpy(&out, data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        bool read_bytes(void *dest, size_t size)
+        {
+            if(data.size() - offset < size) {
+                return false;
+            }
+
+            std::memcpy(dest, data.data() + offset, size);
+            offset += size;
+            return true;
+        }
+    };
+
+    template <typename T>
+    void append(std::vector<char> &buffer, T const &value)
+    {
+        char const *first = reinterpret_cast<char const*>(&value);
+        buffer.insert(buffer.end(), first, first + sizeof(T));
+    }
+}
+
+constexpr size_t gorc::texture_cache::default_max_size;
+
+gorc::texture_cache_entry::texture_cache_entry(span<char const> payload, uint32_t last_used)
+    : payload(payload)
+    , last_used(last_used)
+{
+    return;
+}
+
+gorc::texture_cache::texture_cache(path const &filename, size_t max_size)
+    : filename(filename)
+    , max_size(max_size)
+{
+    if(boost::filesystem::exists(filename)) {
+        read_pack();
+    }
+}
+
+void gorc::texture_cache::read_pack()
+{
+    try {
+        pack = std::make_unique<mapped_file>(filename);
+    }
+    catch(std::exception const &e) {
+        LOG_WARNING(format("could not open texture cache %s: %s") %
+                    filename.generic_string() %
+                    e.what());
+        return;
+    }
+
+    auto data = pack->data();
+    pack_reader rd(data);
+
+    char magic[4];
+    uint32_t version = 0;
+    uint32_t entry_count = 0;
+    uint32_t pack_session = 0;
+    if(!rd.read_bytes(magic, sizeof(magic)) ||
+       !rd.read(version) ||
+       !rd.read(entry_count) ||
+       !rd.read(pack_session) ||
+       std::memcmp(magic, pack_magic, sizeof(magic)) != 0 ||
+       version != pack_version) {
+        LOG_WARNING(format("ignoring texture cache %s: unknown format") %
+                    filename.generic_string());
+        pack.reset();
+        return;
+    }
+
+    session = pack_session + 1;
+
+    for(uint32_t i = 0; i < entry_count; ++i) {
+        texture_cache_key key;
+        uint64_t payload_offset = 0;
+        uint64_t payload_size = 0;
+        uint32_t last_used = 0;
+        if(!rd.read(key.material_hash) ||
+           !rd.read(key.colormap_hash) ||
+           !rd.read(key.override_time) ||
+           !rd.read(key.cel) ||
+           !rd.read(payload_offset) ||
+           !rd.read(payload_size) ||
+           !rd.read(last_used) ||
+           payload_offset > data.size() ||
+           payload_size > data.size() - payload_offset) {
+            LOG_WARNING(format("ignoring texture cache %s: truncated index") %
+                        filename.generic_string());
+            entries.clear();
+            session = 1;
+            pack.reset();
+            return;
+        }
+
+        entries.emplace(key, texture_cache_entry(make_span(data.data() + payload_offset, payload_size),
+                                                 last_used));
+    }
+}
+
+bool gorc::texture_cache::find(texture_cache_key const &key, texture_cache_channels &out)
+{
+    auto it = entries.find(key);
+    if(it == entries.end()) {
+        return false;
+    }
+
+    auto const &payload = it->second.payload;
+    pack_reader rd(payload);
+    texture_cache_channels channels;
+
+    uint32_t channel_count = 0;
+    if(!rd.read(channel_count)) {
+        return false;
+    }
+
+    for(uint32_t channel = 0; channel < channel_count; ++channel) {
+        uint32_t level_count = 0;
+        if(!rd.read(level_count)) {
+            return false;
+        }
+
+        channels.emplace_back();
+        auto &levels = channels.back();
+        for(uint32_t level = 0; level < level_count; ++level) {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            if(!rd.read(width) || !rd.read(height) ||
+               uint64_t(width) * uint64_t(height) > payload.size()) {
+                return false;
+            }
+
+            levels.emplace_back(make_size(size_t(width), size_t(height)));
+            if(!rd.read_bytes(levels.back().data(),
+                              size_t(width) * size_t(height) * sizeof(color_rgba8))) {
+                return false;
+            }
+        }
+    }
+
+    // Usage is saved with the pack, so that a session which only reads the
+    // cache still keeps its entries from being evicted.
+    if(it->second.last_used != session) {
+        it->second.last_used = session;
+        modified = true;
+    }
+
+    out = std::move(channels);
+    return true;
+}
+
+void gorc::texture_cache::insert(texture_cache_key const &key,
+                                 texture_cache_channels const &channels)
+{
+    inserted_payloads.emplace_back();
+    auto &payload = inserted_payloads.back();
+
+    append(payload, static_cast<uint32_t>(channels.size()));
+    for(auto const &levels : channels) {
+        append(payload, static_cast<uint32_t>(levels.size()));
+        for(auto const &level : levels) {
+            append(payload, static_cast<uint32_t>(get<0>(level.size)));
+            append(payload, static_cast<uint32_t>(get<1>(level.size)));
+
+            char const *texels = reinterpret_cast<char const*>(level.data());
+            payload.insert(payload.end(), texels, texels + volume(level.size) * sizeof(color_rgba8));
+        }
+    }
+
+    entries.erase(key);
+    entries.emplace(key, texture_cache_entry(make_span(payload.data(), payload.size()), session));
+    modified = true;
+}
+
+void gorc::texture_cache::evict_to_max_size()
+{
+    std::vector<std::map<texture_cache_key, texture_cache_entry>::iterator> by_last_used;
+    for(auto it = entries.begin(); it != entries.end(); ++it) {
+        by_last_used.push_back(it);
+    }
+
+    std::stable_sort(by_last_used.begin(),
+                     by_last_used.end(),
+                     [](auto const &a, auto const &b) {
+                         return a->second.last_used > b->second.last_used;
+                     });
+
+    size_t total_size = 0;
+    for(auto const &it : by_last_used) {
+        total_size += it->second.payload.size();
+        if(total_size > max_size) {
+            entries.erase(it);
+        }
+    }
+}
+
+void gorc::texture_cache::save()
+{
+    if(!modified) {
+        return;
+    }
+
+    evict_to_max_size();
+
+    std::vector<char> header;
+    header.insert(header.end(), pack_magic, pack_magic + sizeof(pack_magic));
+    append(header, pack_version);
+    append(header, static_cast<uint32_t>(entries.size()));
+    append(header, session);
+
+    uint64_t payload_offset = header_size + entries.size() * index_record_size;
+    for(auto const &entry : entries) {
+        append(header, entry.first.material_hash);
+        append(header, entry.first.colormap_hash);
+        append(header, entry.first.override_time);
+        append(header, entry.first.cel);
+        append(header, payload_offset);
+        append(header, static_cast<uint64_t>(entry.second.payload.size()));
+        append(header, entry.second.last_used);
+        payload_offset += entry.second.payload.size();
+    }
+
+    // Write to a temporary file, so a failed save does not damage the
+    // existing pack. The current mapping stays valid after the rename.
+    path temp_filename = filename;
+    temp_filename += ".tmp";
+
+    {
+        auto f = make_native_file(temp_filename);
+        f->write(header.data(), header.size());
+        for(auto const &entry : entries) {
+            f->write(entry.second.payload.data(), entry.second.payload.size());
+        }
+    }
+
+    boost::filesystem::rename(temp_filename, filename);
+    modified = false;
+}
+
+size_t gorc::texture_cache::size() const
+{
+    return entries.size();
+}
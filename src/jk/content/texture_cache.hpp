@@ -0,0 +1,89 @@
+#pragma once
+
+#include "io/mapped_file.hpp"
+#include "io/path.hpp"
+#include "math/color.hpp"
+#include "math/grid.hpp"
+#include "utility/span.hpp"
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace gorc {
+
+    // Identifies the decoded images of one material cel. Cels without an
+    // override image use an override time of zero.
+    class texture_cache_key {
+    public:
+        uint64_t material_hash = 0;
+        uint64_t colormap_hash = 0;
+        int64_t override_time = 0;
+        int32_t cel = 0;
+
+        inline bool operator<(texture_cache_key const &k) const
+        {
+            return std::tie(material_hash, colormap_hash, override_time, cel) <
+                   std::tie(k.material_hash, k.colormap_hash, k.override_time, k.cel);
+        }
+    };
+
+    // Mip chains for each channel of a cel, largest level first.
+    using texture_cache_channels = std::vector<std::vector<grid<color_rgba8>>>;
+
+    class texture_cache_entry {
+    public:
+        span<char const> payload;
+
+        // Number of the last session which found or inserted the entry
+        uint32_t last_used = 0;
+
+        texture_cache_entry(span<char const> payload, uint32_t last_used);
+    };
+
+    // Persistent store of decoded material cels. The pack file is memory
+    // mapped when the cache is opened, and its index is read into memory.
+    // Inserted entries are kept in memory until save rewrites the pack.
+    // Not thread safe.
+    //
+    // Each time the pack is opened counts as a new session. When the pack is
+    // rewritten it keeps the most recently used entries that fit in max_size,
+    // so stale cels do not accumulate.
+    class texture_cache {
+    private:
+        path filename;
+        size_t max_size;
+        uint32_t session = 1;
+        std::unique_ptr<mapped_file> pack;
+        std::list<std::vector<char>> inserted_payloads;
+        std::map<texture_cache_key, texture_cache_entry> entries;
+        bool modified = false;
+
+        void read_pack();
+        void evict_to_max_size();
+
+    public:
+        static constexpr size_t default_max_size = 512 * 1024 * 1024;
+
+        explicit texture_cache(path const &filename, size_t max_size = default_max_size);
+
+        texture_cache(texture_cache const &) = delete;
+        texture_cache& operator=(texture_cache const &) = delete;
+
+        // Fills out with the images stored for key. Returns false when the
+        // key is not cached.
+        bool find(texture_cache_key const &key, texture_cache_channels &out);
+
+        void insert(texture_cache_key const &key, texture_cache_channels const &channels);
+
+        // Writes the pack file, if any entries have been inserted or found
+        // since it was opened. Least recently used entries are dropped to keep the payloads within
+        // max_size.
+        void save();
+
+        size_t size() const;
+    };
+
+}
@@ -29,4 +29,47 @@ test_case(get_color_and_light_color)
     assert_eq(cmp.get_light_color(15), make_color_rgb8(0, 0, 0));
 }
 
+test_case(rgba_luts)
+{
+    colormap cmp(uninit_constructor);
+    cmp.palette = std::make_unique<colormap_palette>(uninit_constructor);
+    cmp.light_levels = std::make_unique<colormap_light_level>(uninit_constructor);
+
+    for(int i = 0; i < 256; ++i) {
+        uint8_t value = static_cast<uint8_t>(i);
+        cmp.palette->data[i] = make_color_rgb8(value, 0, 255 - value);
+    }
+
+    for(int i = 0; i < 64; ++i) {
+        for(int j = 0; j < 256; ++j) {
+            cmp.light_levels->data[i][j] = static_cast<uint8_t>((i + j) % 256);
+        }
+    }
+
+    cmp.update_rgba_levels();
+
+    for(int i = 0; i < 64; ++i) {
+        for(int j = 0; j < 256; ++j) {
+            assert_eq(cmp.get_rgba_lut(i)[j], solid(cmp.get_color(j, i)));
+        }
+    }
+
+    assert_eq(cmp.get_rgba_lut()[12], solid(cmp.get_color(12)));
+    assert_eq(cmp.get_light_rgba_lut()[15], solid(cmp.get_light_color(15)));
+
+    // Changing a palette entry in use changes the table fingerprint
+    auto original_hash = cmp.rgba_hash;
+    cmp.palette->data[20] = make_color_rgb8(1, 2, 3);
+    cmp.update_rgba_levels();
+    assert_true(cmp.rgba_hash != original_hash);
+}
+
+test_case(uninit_rgba_luts_are_allocated)
+{
+    colormap cmp(uninit_constructor);
+
+    assert_eq(cmp.get_rgba_lut()[0], make_color_rgba8(0, 0, 0, 0));
+    assert_eq(cmp.get_light_rgba_lut()[255], make_color_rgba8(0, 0, 0, 0));
+}
+
 end_suite(colormap_test);
@@ -0,0 +1,68 @@
+#include "test/test.hpp"
+#include "jk/content/indexed_image.hpp"
+#include <vector>
+
+using namespace gorc;
+
+namespace {
+    colormap make_mock_colormap()
+    {
+        colormap cmp(uninit_constructor);
+        cmp.palette = std::make_unique<colormap_palette>(uninit_constructor);
+        cmp.light_levels = std::make_unique<colormap_light_level>(uninit_constructor);
+
+        for(int i = 0; i < 256; ++i) {
+            uint8_t value = static_cast<uint8_t>(i);
+            cmp.palette->data[i] = make_color_rgb8(value, value / 2, 255 - value);
+        }
+
+        for(int i = 0; i < 64; ++i) {
+            for(int j = 0; j < 256; ++j) {
+                cmp.light_levels->data[i][j] = static_cast<uint8_t>((j * 3 + i) % 256);
+            }
+        }
+
+        cmp.update_rgba_levels();
+        return cmp;
+    }
+}
+
+begin_suite(indexed_image_test);
+
+test_case(decode_matches_colormap)
+{
+    auto cmp = make_mock_colormap();
+
+    // Not a multiple of any vector width
+    std::vector<uint8_t> texels;
+    for(int i = 0; i < 1037; ++i) {
+        texels.push_back(static_cast<uint8_t>((i * 7) % 256));
+    }
+
+    std::vector<color_rgba8> diffuse(texels.size());
+    std::vector<color_rgba8> light(texels.size());
+    decode_indexed_texels(make_span(texels), cmp, nothing, diffuse.data(), light.data());
+
+    for(size_t i = 0; i < texels.size(); ++i) {
+        assert_eq(diffuse[i], solid(cmp.get_color(texels[i])));
+        assert_eq(light[i], solid(cmp.get_light_color(texels[i])));
+    }
+}
+
+test_case(decode_transparent_index)
+{
+    auto cmp = make_mock_colormap();
+
+    std::vector<uint8_t> texels { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 3, 3 };
+    std::vector<color_rgba8> diffuse(texels.size());
+    std::vector<color_rgba8> light(texels.size());
+    decode_indexed_texels(make_span(texels), cmp, 3, diffuse.data(), light.data());
+
+    for(size_t i = 0; i < texels.size(); ++i) {
+        uint8_t alpha = (texels[i] == 3) ? 0 : 255;
+        assert_eq(diffuse[i], make_color_rgba8(cmp.get_color(texels[i]), alpha));
+        assert_eq(light[i], make_color_rgba8(cmp.get_light_color(texels[i]), alpha));
+    }
+}
+
+end_suite(indexed_image_test);
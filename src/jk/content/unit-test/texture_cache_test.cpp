@@ -0,0 +1,235 @@
+#include "test/test.hpp"
+#include "jk/content/texture_cache.hpp"
+#include "io/native_file.hpp"
+#include <boost/filesystem.hpp>
+#include <string>
+
+using namespace gorc;
+
+namespace {
+    class scoped_temp_path {
+    public:
+        path filename;
+
+        scoped_temp_path()
+            : filename(boost::filesystem::temp_directory_path() /
+                       boost::filesystem::unique_path("gorc-texture-cache-%%%%-%%%%"))
+        {
+            return;
+        }
+
+        ~scoped_temp_path()
+        {
+            boost::system::error_code ec;
+            boost::filesystem::remove(filename, ec);
+        }
+    };
+
+    texture_cache_key make_key(int cel)
+    {
+        texture_cache_key key;
+        key.material_hash = 0x1234;
+        key.colormap_hash = 0x5678;
+        key.override_time = 0;
+        key.cel = cel;
+        return key;
+    }
+
+    texture_cache_channels make_channels(uint8_t seed)
+    {
+        texture_cache_channels channels(2);
+        for(auto &levels : channels) {
+            size_t dim = 4;
+            for(int level = 0; level < 3; ++level, dim /= 2) {
+                levels.emplace_back(make_size(dim, dim));
+                for(size_t i = 0; i < dim * dim; ++i) {
+                    uint8_t v = static_cast<uint8_t>(seed + i + level);
+                    levels.back().data()[i] = make_color_rgba8(v, v, seed, 255);
+                }
+            }
+
+            ++seed;
+        }
+
+        return channels;
+    }
+
+    bool channels_equal(texture_cache_channels const &a, texture_cache_channels const &b)
+    {
+        if(a.size() != b.size()) {
+            return false;
+        }
+
+        for(size_t i = 0; i < a.size(); ++i) {
+            if(a[i].size() != b[i].size()) {
+                return false;
+            }
+
+            for(size_t j = 0; j < a[i].size(); ++j) {
+                auto const &x = a[i][j];
+                auto const &y = b[i][j];
+                if(x.size != y.size ||
+                   !std::equal(x.data(), x.data() + volume(x.size), y.data())) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+begin_suite(texture_cache_test);
+
+test_case(missing_pack)
+{
+    scoped_temp_path tmp;
+    texture_cache cache(tmp.filename);
+
+    texture_cache_channels out;
+    assert_eq(cache.size(), size_t(0));
+    assert_true(!cache.find(make_key(0), out));
+}
+
+test_case(insert_find)
+{
+    scoped_temp_path tmp;
+    texture_cache cache(tmp.filename);
+
+    auto channels = make_channels(10);
+    cache.insert(make_key(1), channels);
+
+    texture_cache_channels out;
+    assert_true(cache.find(make_key(1), out));
+    assert_true(channels_equal(out, channels));
+    assert_true(!cache.find(make_key(2), out));
+}
+
+test_case(round_trip)
+{
+    scoped_temp_path tmp;
+
+    auto first = make_channels(10);
+    auto second = make_channels(50);
+
+    {
+        texture_cache cache(tmp.filename);
+        cache.insert(make_key(0), first);
+        cache.insert(make_key(1), second);
+        cache.save();
+    }
+
+    texture_cache cache(tmp.filename);
+    assert_eq(cache.size(), size_t(2));
+
+    texture_cache_channels out;
+    assert_true(cache.find(make_key(0), out));
+    assert_true(channels_equal(out, first));
+    assert_true(cache.find(make_key(1), out));
+    assert_true(channels_equal(out, second));
+
+    // Entries loaded from the pack are kept when the pack is rewritten
+    auto third = make_channels(90);
+    cache.insert(make_key(2), third);
+    cache.save();
+
+    texture_cache reopened(tmp.filename);
+    assert_eq(reopened.size(), size_t(3));
+    assert_true(reopened.find(make_key(0), out));
+    assert_true(channels_equal(out, first));
+    assert_true(reopened.find(make_key(2), out));
+    assert_true(channels_equal(out, third));
+}
+
+test_case(save_drops_least_recently_used)
+{
+    scoped_temp_path tmp;
+
+    // Payload size of each entry built by make_channels
+    size_t const entry_size = 228;
+    size_t const max_size = entry_size * 2 + entry_size / 2;
+
+    {
+        texture_cache cache(tmp.filename, max_size);
+        cache.insert(make_key(0), make_channels(10));
+        cache.insert(make_key(1), make_channels(20));
+        cache.save();
+    }
+
+    {
+        texture_cache cache(tmp.filename, max_size);
+        assert_eq(cache.size(), size_t(2));
+
+        texture_cache_channels out;
+        assert_true(cache.find(make_key(1), out));
+        cache.insert(make_key(2), make_channels(30));
+        cache.save();
+        assert_eq(cache.size(), size_t(2));
+    }
+
+    texture_cache cache(tmp.filename, max_size);
+    assert_eq(cache.size(), size_t(2));
+
+    texture_cache_channels out;
+    assert_true(!cache.find(make_key(0), out));
+    assert_true(cache.find(make_key(1), out));
+    assert_true(channels_equal(out, make_channels(20)));
+    assert_true(cache.find(make_key(2), out));
+    assert_true(channels_equal(out, make_channels(30)));
+}
+
+test_case(read_only_session_saves_usage)
+{
+    scoped_temp_path tmp;
+
+    size_t const entry_size = 228;
+    size_t const max_size = entry_size * 2 + entry_size / 2;
+
+    {
+        texture_cache cache(tmp.filename, max_size);
+        cache.insert(make_key(0), make_channels(10));
+        cache.insert(make_key(1), make_channels(20));
+        cache.save();
+    }
+
+    {
+        texture_cache cache(tmp.filename, max_size);
+
+        texture_cache_channels out;
+        assert_true(cache.find(make_key(1), out));
+        cache.save();
+    }
+
+    {
+        texture_cache cache(tmp.filename, max_size);
+        cache.insert(make_key(2), make_channels(30));
+        cache.save();
+    }
+
+    texture_cache cache(tmp.filename, max_size);
+    assert_eq(cache.size(), size_t(2));
+
+    texture_cache_channels out;
+    assert_true(!cache.find(make_key(0), out));
+    assert_true(cache.find(make_key(1), out));
+    assert_true(cache.find(make_key(2), out));
+}
+
+test_case(unknown_format)
+{
+    scoped_temp_path tmp;
+
+    {
+        auto f = make_native_file(tmp.filename);
+        std::string junk = "not a texture cache";
+        f->write(junk.data(), junk.size());
+    }
+
+    texture_cache cache(tmp.filename);
+    assert_log_message(log_level::warning,
+                       "ignoring texture cache " + tmp.filename.generic_string() +
+                       ": unknown format");
+    assert_eq(cache.size(), size_t(0));
+}
+
+end_suite(texture_cache_test);
@@ -1,9 +1,11 @@
 #include "gob_file.hpp"
+#include <stdexcept>
 
 gorc::gob_file::gob_file(path const &container_filename,
                          size_t chunk_offset,
                          size_t chunk_length)
     : file(container_filename)
+    , chunk_offset(chunk_offset)
     , chunk_end(chunk_offset + chunk_length)
 {
     file.set_position(chunk_offset);
@@ -21,3 +23,32 @@ bool gorc::gob_file::at_end()
 {
     return file.position() >= chunk_end;
 }
+
+void gorc::gob_file::seek(ssize_t offset)
+{
+    ssize_t new_position = static_cast<ssize_t>(position()) + offset;
+    if(new_position < 0 || static_cast<size_t>(new_position) > size()) {
+        throw std::range_error("gob_file::seek invalid offset");
+    }
+
+    set_position(static_cast<size_t>(new_position));
+}
+
+void gorc::gob_file::set_position(size_t offset)
+{
+    if(offset > size()) {
+        throw std::range_error("gob_file::set_position invalid offset");
+    }
+
+    file.set_position(chunk_offset + offset);
+}
+
+size_t gorc::gob_file::position()
+{
+    return file.position() - chunk_offset;
+}
+
+size_t gorc::gob_file::size()
+{
+    return chunk_end - chunk_offset;
+}
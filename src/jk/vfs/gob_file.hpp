@@ -1,14 +1,15 @@
 #pragma once
 
-#include "io/input_stream.hpp"
+#include "io/read_only_file.hpp"
 #include "io/native_file.hpp"
 #include <string>
 
 namespace gorc {
 
-    class gob_file : public input_stream {
+    class gob_file : public read_only_file {
     private:
         native_read_only_file file;
+        size_t const chunk_offset;
         size_t const chunk_end;
 
     public:
@@ -18,5 +19,11 @@ namespace gorc {
 
         virtual size_t read_some(void *dest, size_t size) override;
         virtual bool at_end() override;
+
+        virtual void seek(ssize_t offset) override;
+        virtual void set_position(size_t offset) override;
+        virtual size_t position() override;
+
+        virtual size_t size() override;
     };
 }
@@ -1,6 +1,7 @@
 #include "gob_virtual_container.hpp"
 #include "io/native_file.hpp"
 #include "log/log.hpp"
+#include <vector>
 
 namespace {
     struct gob_header {
@@ -32,10 +33,17 @@ gorc::gob_virtual_container::gob_virtual_container(path const &container_filenam
         LOG_FATAL("container is not a valid GOB");
     }
 
-    gob_entry entry;
-    for(uint32_t i = 0; i < header.index_count; ++i) {
-        file->read(&entry, sizeof(gob_entry));
+    // Read the whole index table at once
+    size_t max_index_count = (file->size() - sizeof(gob_header)) / sizeof(gob_entry);
+    if(header.index_count > max_index_count) {
+        LOG_FATAL("container index is truncated");
+    }
+
+    std::vector<gob_entry> entries(header.index_count);
+    file->read(entries.data(), entries.size() * sizeof(gob_entry));
 
+    files.reserve(entries.size());
+    for(auto &entry : entries) {
         // Convert path separators for boost path.
         std::replace_if(entry.chunk_name,
                         entry.chunk_name + 128,
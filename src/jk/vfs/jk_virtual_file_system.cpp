@@ -6,10 +6,21 @@
 #include "utility/string_search.hpp"
 #include "utility/string_view.hpp"
 #include <boost/filesystem.hpp>
+#include <algorithm>
 
 using namespace gorc;
 
 namespace {
+    // Index and map keys are lowercase generic paths. JK names files without
+    // regard to case, so every key is built here, whether it names a GOB
+    // entry, a loose file or a requested path.
+    std::string make_index_key(path const &p)
+    {
+        std::string rv = p.generic_string();
+        std::transform(rv.begin(), rv.end(), rv.begin(), tolower);
+        return rv;
+    }
+
     void load_gob(path const &filename,
                   vfs_map &map,
                   std::vector<std::unique_ptr<virtual_container>> &ctrs)
@@ -29,7 +40,7 @@ namespace {
         }
 
         for(auto const &file : *cnt) {
-            map.emplace(file.name.generic_string(), &file);
+            map.emplace(make_index_key(file.name), &file);
         }
 
         ctrs.push_back(std::move(cnt));
@@ -54,14 +65,66 @@ namespace {
         return;
     }
 
+    void load_loose_files(path const &base_path,
+                          std::vector<std::tuple<std::string, path>> &files)
+    {
+        if(boost::filesystem::exists(base_path) &&
+           boost::filesystem::is_directory(base_path)) {
+            std::string base_generic = base_path.generic_string();
+            for(boost::filesystem::recursive_directory_iterator dir_iter(base_path);
+                dir_iter != boost::filesystem::recursive_directory_iterator();
+                ++dir_iter) {
+                if(boost::filesystem::is_regular_file(dir_iter->status())) {
+                    std::string rel = dir_iter->path().generic_string();
+                    rel.erase(0, base_generic.size());
+                    while(!rel.empty() && rel.front() == '/') {
+                        rel.erase(0, 1);
+                    }
+
+                    files.emplace_back(make_index_key(rel), dir_iter->path());
+                }
+            }
+        }
+
+        return;
+    }
+
+    // Index keys are relative paths with no empty, '.' or '..' components.
+    // Anything else must be resolved against the underlying directories.
+    bool is_indexable(std::string const &generic_p)
+    {
+        if(generic_p.empty() || generic_p.front() == '/' || generic_p.back() == '/') {
+            return false;
+        }
+
+        size_t seg_begin = 0;
+        while(seg_begin <= generic_p.size()) {
+            size_t seg_end = generic_p.find('/', seg_begin);
+            if(seg_end == std::string::npos) {
+                seg_end = generic_p.size();
+            }
+
+            auto seg_len = seg_end - seg_begin;
+            if(seg_len == 0 ||
+               (seg_len == 1 && generic_p[seg_begin] == '.') ||
+               (seg_len == 2 && generic_p[seg_begin] == '.' && generic_p[seg_begin + 1] == '.')) {
+                return false;
+            }
+
+            seg_begin = seg_end + 1;
+        }
+
+        return true;
+    }
+
     std::unique_ptr<input_stream> find_in_gobs(path const &orig_path,
                                                path const &base_path,
                                                std::string const &generic_p,
                                                vfs_map const &map)
     {
         path in_bare_directory = base_path / orig_path;
-        if(boost::filesystem::exists(in_bare_directory) &&
-           boost::filesystem::is_regular_file(in_bare_directory)) {
+        boost::system::error_code ec;
+        if(boost::filesystem::is_regular_file(in_bare_directory, ec)) {
             return make_native_read_only_file(in_bare_directory);
         }
 
@@ -72,12 +135,50 @@ namespace {
 
         return nullptr;
     }
+
+    void index_gob_files(vfs_index &index, vfs_map const &map)
+    {
+        for(auto const &file : map) {
+            index.emplace(file.first, vfs_index_entry(file.second));
+        }
+    }
+
+    void index_loose_files(vfs_index &index,
+                           std::vector<std::tuple<std::string, path>> const &files)
+    {
+        for(auto const &file : files) {
+            index.emplace(std::get<0>(file), vfs_index_entry(std::get<1>(file)));
+        }
+    }
+}
+
+gorc::vfs_index_entry::vfs_index_entry(virtual_file const *gob_file)
+    : gob_file(gob_file)
+{
+    return;
+}
+
+gorc::vfs_index_entry::vfs_index_entry(path const &loose_file)
+    : loose_file(loose_file)
+{
+    return;
+}
+
+std::unique_ptr<gorc::input_stream> gorc::vfs_index_entry::open() const
+{
+    if(gob_file) {
+        return gob_file->open();
+    }
+
+    return make_native_read_only_file(loose_file);
 }
 
 gorc::jk_virtual_file_system::jk_virtual_file_system(path const &resource_path)
     : resource_path(resource_path)
 {
     load_gobs(resource_path, resource_file_map, containers);
+    load_loose_files(resource_path, resource_loose_files);
+    rebuild_index();
     return;
 }
 
@@ -88,51 +189,92 @@ gorc::jk_virtual_file_system::jk_virtual_file_system(path const &resource_path,
 {
     load_gobs(resource_path, resource_file_map, containers);
     load_gobs(game_path, game_file_map, containers);
+    load_loose_files(resource_path, resource_loose_files);
+    load_loose_files(game_path, game_loose_files);
+    rebuild_index();
     return;
 }
 
+void gorc::jk_virtual_file_system::rebuild_index()
+{
+    merged_index.clear();
+
+    // Insertion order is lookup precedence: the first source to claim a name wins.
+    index_gob_files(merged_index, episode_file_map);
+
+    if(game_path.has_value()) {
+        index_loose_files(merged_index, game_loose_files);
+        index_gob_files(merged_index, game_file_map);
+    }
+
+    index_loose_files(merged_index, resource_loose_files);
+    index_gob_files(merged_index, resource_file_map);
+}
+
 void gorc::jk_virtual_file_system::set_current_episode(virtual_container const &episode_ctr)
 {
     episode_file_map.clear();
     for(auto const &file : episode_ctr) {
-        episode_file_map.emplace(file.name.generic_string(), &file);
+        episode_file_map.emplace(make_index_key(file.name), &file);
     }
+
+    rebuild_index();
+}
+
+std::unique_ptr<gorc::input_stream>
+    gorc::jk_virtual_file_system::find_unindexed(std::string const &generic_p) const
+{
+    path normalized_p(generic_p);
+
+    // Try from the current episode:
+    auto ep_fn_it = episode_file_map.find(generic_p);
+    if(ep_fn_it != episode_file_map.end()) {
+        return ep_fn_it->second->open();
+    }
+
+    // Try from the current mod:
+    if(game_path.has_value()) {
+        auto game_file = find_in_gobs(normalized_p,
+                                      game_path.get_value(),
+                                      generic_p,
+                                      game_file_map);
+        if(game_file) {
+            return game_file;
+        }
+    }
+
+    // Try from resources
+    return find_in_gobs(normalized_p,
+                        resource_path,
+                        generic_p,
+                        resource_file_map);
 }
 
 std::tuple<gorc::path, std::unique_ptr<gorc::input_stream>>
     gorc::jk_virtual_file_system::find(path const &original_p,
                                        std::vector<path> const &prefixes) const
 {
+    // Indexed files are found with one hash probe per prefix, and no
+    // filesystem calls.
     for(auto const &prefix : prefixes) {
         path p = prefix / original_p;
-        std::string generic_p = p.generic_string();
-        std::transform(generic_p.begin(), generic_p.end(), generic_p.begin(), tolower);
-        path normalized_p(generic_p);
-
-        // Try from the current episode:
-        auto ep_fn_it = episode_file_map.find(generic_p);
-        if(ep_fn_it != episode_file_map.end()) {
-            return std::make_tuple(p, ep_fn_it->second->open());
-        }
-
-        // Try from the current mod:
-        if(game_path.has_value()) {
-            auto game_file = find_in_gobs(normalized_p,
-                                          game_path.get_value(),
-                                          generic_p,
-                                          game_file_map);
-            if(game_file) {
-                return std::make_tuple(p, std::move(game_file));
+        std::string generic_p = make_index_key(p);
+
+        if(is_indexable(generic_p)) {
+            auto it = merged_index.find(generic_p);
+            if(it != merged_index.end()) {
+                return std::make_tuple(p, it->second.open());
             }
         }
+    }
 
-        // Try from resources
-        auto res_file = find_in_gobs(normalized_p,
-                                     resource_path,
-                                     generic_p,
-                                     resource_file_map);
-        if(res_file) {
-            return std::make_tuple(p, std::move(res_file));
+    // Paths the index cannot answer, and loose files created after the index
+    // was built, are found by probing the underlying directories.
+    for(auto const &prefix : prefixes) {
+        path p = prefix / original_p;
+        auto file = find_unindexed(make_index_key(p));
+        if(file) {
+            return std::make_tuple(p, std::move(file));
         }
     }
 
@@ -146,6 +288,17 @@ std::unique_ptr<gorc::input_stream> gorc::jk_virtual_file_system::open(path cons
     return std::get<1>(find(p, { path() }));
 }
 
+gorc::maybe<gorc::vfs_index_entry const*>
+    gorc::jk_virtual_file_system::find_entry(path const &p) const
+{
+    auto it = merged_index.find(make_index_key(p));
+    if(it == merged_index.end()) {
+        return nothing;
+    }
+
+    return &it->second;
+}
+
 namespace {
     void list_from_gob(std::map<std::string, std::string> &out_map,
                        vfs_map const &vm)
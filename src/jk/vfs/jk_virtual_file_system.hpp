@@ -13,6 +13,21 @@ namespace gorc {
 
     typedef std::unordered_map<std::string, virtual_file const *> vfs_map;
 
+    // Resolved location of a file visible through the JK file system: either an
+    // entry in a GOB container, or a loose file in a game or resource directory.
+    class vfs_index_entry {
+    public:
+        virtual_file const *gob_file = nullptr;
+        path loose_file;
+
+        explicit vfs_index_entry(virtual_file const *gob_file);
+        explicit vfs_index_entry(path const &loose_file);
+
+        std::unique_ptr<input_stream> open() const;
+    };
+
+    typedef std::unordered_map<std::string, vfs_index_entry> vfs_index;
+
     class jk_virtual_file_system : public virtual_file_system {
     private:
         path const resource_path;
@@ -24,6 +39,18 @@ namespace gorc {
 
         std::vector<std::unique_ptr<virtual_container>> containers;
 
+        // Loose files found under the game and resource directories at startup,
+        // keyed by their lowercase generic path relative to the directory.
+        std::vector<std::tuple<std::string, path>> game_loose_files;
+        std::vector<std::tuple<std::string, path>> resource_loose_files;
+
+        // Every file visible through the file system, keyed by lowercase
+        // generic path. Earlier sources shadow later ones.
+        vfs_index merged_index;
+
+        void rebuild_index();
+        std::unique_ptr<input_stream> find_unindexed(std::string const &generic_p) const;
+
     public:
         jk_virtual_file_system(path const &resource_path);
         jk_virtual_file_system(path const &resource_path,
@@ -35,6 +62,11 @@ namespace gorc {
         virtual std::tuple<path, std::unique_ptr<input_stream>>
             find(path const &filename, std::vector<path> const &prefixes) const override;
 
+        // Returns the indexed location of a file, or nothing if the file is not
+        // indexed. Files which are not indexed, such as loose files created
+        // after construction, may still be found by open().
+        maybe<vfs_index_entry const*> find_entry(path const &filename) const;
+
         std::map<std::string, std::string> list_files() const;
     };
 
@@ -0,0 +1,73 @@
+#include "test/test.hpp"
+#include "jk/vfs/gob_file.hpp"
+#include <boost/filesystem.hpp>
+#include <string>
+
+using namespace gorc;
+
+namespace {
+    class scoped_container {
+    public:
+        path filename;
+
+        scoped_container()
+            : filename(boost::filesystem::temp_directory_path() /
+                       boost::filesystem::unique_path("gorc-gob-file-%%%%-%%%%"))
+        {
+            auto f = make_native_file(filename);
+            std::string contents = "0123456789";
+            f->write(contents.data(), contents.size());
+        }
+
+        ~scoped_container()
+        {
+            boost::system::error_code ec;
+            boost::filesystem::remove(filename, ec);
+        }
+    };
+
+    std::string read_string(read_only_file &f, size_t size)
+    {
+        std::string rv(size, '\0');
+        f.read(&rv[0], size);
+        return rv;
+    }
+}
+
+begin_suite(gob_file_test);
+
+test_case(read_chunk)
+{
+    scoped_container ctr;
+    gob_file f(ctr.filename, 3, 4);
+
+    assert_eq(f.size(), size_t(4));
+    assert_eq(f.position(), size_t(0));
+    assert_eq(read_string(f, 4), std::string("3456"));
+    assert_true(f.at_end());
+}
+
+test_case(seek_within_chunk)
+{
+    scoped_container ctr;
+    gob_file f(ctr.filename, 3, 4);
+
+    f.set_position(2);
+    assert_eq(f.position(), size_t(2));
+    assert_eq(read_string(f, 2), std::string("56"));
+
+    f.seek(-3);
+    assert_eq(f.position(), size_t(1));
+    assert_eq(read_string(f, 1), std::string("4"));
+}
+
+test_case(seek_outside_chunk)
+{
+    scoped_container ctr;
+    gob_file f(ctr.filename, 3, 4);
+
+    assert_throws(f.set_position(5), std::range_error, "gob_file::set_position invalid offset");
+    assert_throws(f.seek(-1), std::range_error, "gob_file::seek invalid offset");
+}
+
+end_suite(gob_file_test);
@@ -0,0 +1,170 @@
+#include "test/test.hpp"
+#include "jk/vfs/jk_virtual_file_system.hpp"
+#include "jk/vfs/gob_virtual_container.hpp"
+#include "io/native_file.hpp"
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace gorc;
+
+namespace {
+    std::string read_all(input_stream &f)
+    {
+        std::string rv;
+        char buf[64];
+        while(!f.at_end()) {
+            size_t amt = f.read_some(buf, sizeof(buf));
+            rv.append(buf, amt);
+        }
+
+        return rv;
+    }
+
+    void write_file(path const &filename, std::string const &contents)
+    {
+        boost::filesystem::create_directories(filename.parent_path());
+        auto f = make_native_file(filename);
+        f->write(contents.data(), contents.size());
+    }
+
+    typedef std::vector<std::pair<std::string, std::string>> gob_contents;
+
+    void write_gob(path const &filename, gob_contents const &files)
+    {
+        uint32_t const header_size = 16;
+        uint32_t const entry_size = 136;
+
+        std::string header("GOB ", 4);
+        uint32_t header_values[] = { header_size,
+                                     0,
+                                     static_cast<uint32_t>(files.size()) };
+        header.append(reinterpret_cast<char const *>(header_values), sizeof(header_values));
+
+        std::string index;
+        std::string data;
+        uint32_t offset = header_size + entry_size * static_cast<uint32_t>(files.size());
+        for(auto const &file : files) {
+            uint32_t chunk[] = { offset + static_cast<uint32_t>(data.size()),
+                                 static_cast<uint32_t>(file.second.size()) };
+            index.append(reinterpret_cast<char const *>(chunk), sizeof(chunk));
+
+            char name[128] = { 0 };
+            std::strncpy(name, file.first.c_str(), sizeof(name) - 1);
+            index.append(name, sizeof(name));
+
+            data += file.second;
+        }
+
+        write_file(filename, header + index + data);
+    }
+}
+
+class jk_virtual_file_system_test_fixture : public test::fixture {
+public:
+    path const root;
+    path const resource;
+    path const game;
+
+    jk_virtual_file_system_test_fixture()
+        : root(boost::filesystem::temp_directory_path() /
+               boost::filesystem::unique_path("gorc-jk-vfs-%%%%-%%%%"))
+        , resource(root / "resource")
+        , game(root / "game")
+    {
+        boost::filesystem::create_directories(resource);
+        boost::filesystem::create_directories(game);
+    }
+
+    ~jk_virtual_file_system_test_fixture()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(root, ec);
+    }
+};
+
+begin_suite_fixture(jk_virtual_file_system_test, jk_virtual_file_system_test_fixture);
+
+test_case(open_gob_file)
+{
+    write_gob(resource / "res1.gob", { { "mat\\dflt.mat", "gob" } });
+
+    jk_virtual_file_system vfs(resource);
+    assert_eq(read_all(*vfs.open("mat/dflt.mat")), std::string("gob"));
+    assert_true(vfs.find_entry("mat/dflt.mat").has_value());
+}
+
+test_case(loose_file_over_gob)
+{
+    write_gob(resource / "res1.gob", { { "mat\\dflt.mat", "gob" } });
+    write_file(resource / "mat" / "dflt.mat", "loose");
+
+    jk_virtual_file_system vfs(resource);
+    assert_eq(read_all(*vfs.open("mat/dflt.mat")), std::string("loose"));
+}
+
+test_case(game_over_resource)
+{
+    write_gob(resource / "res1.gob", { { "mat\\dflt.mat", "resource" } });
+    write_gob(game / "mod.gob", { { "mat\\dflt.mat", "game" } });
+
+    jk_virtual_file_system vfs(resource, game);
+    assert_eq(read_all(*vfs.open("mat/dflt.mat")), std::string("game"));
+}
+
+test_case(episode_over_resource)
+{
+    write_gob(resource / "res1.gob", { { "jkl\\01narshadda.jkl", "resource gob" },
+                                       { "jkl\\02narshadda.jkl", "resource gob" } });
+    write_file(resource / "jkl" / "02narshadda.jkl", "resource loose");
+    write_gob(root / "episode.gob", { { "jkl\\01narshadda.jkl", "episode" },
+                                      { "jkl\\02narshadda.jkl", "episode" } });
+
+    jk_virtual_file_system vfs(resource);
+    gob_virtual_container episode(root / "episode.gob");
+    vfs.set_current_episode(episode);
+
+    assert_eq(read_all(*vfs.open("jkl/01narshadda.jkl")), std::string("episode"));
+    assert_eq(read_all(*vfs.open("jkl/02narshadda.jkl")), std::string("episode"));
+}
+
+test_case(loose_file_names_ignore_case)
+{
+    write_file(resource / "MAT" / "Dflt.MAT", "loose");
+
+    jk_virtual_file_system vfs(resource);
+    assert_true(vfs.find_entry("mat/dflt.mat").has_value());
+    assert_true(vfs.find_entry("Mat/DFLT.mat").has_value());
+}
+
+test_case(find_tries_prefixes_in_order)
+{
+    write_gob(resource / "res1.gob", { { "3do\\mat\\dflt.mat", "3do" } });
+
+    jk_virtual_file_system vfs(resource);
+    auto f = vfs.find("dflt.mat", { "mat", "3do/mat" });
+    assert_eq(std::get<0>(f), path("3do/mat/dflt.mat"));
+    assert_eq(read_all(*std::get<1>(f)), std::string("3do"));
+}
+
+test_case(file_created_after_startup)
+{
+    jk_virtual_file_system vfs(resource);
+    write_file(resource / "mat" / "new.mat", "new");
+
+    assert_true(!vfs.find_entry("mat/new.mat").has_value());
+    assert_eq(read_all(*vfs.open("mat/new.mat")), std::string("new"));
+}
+
+test_case(file_not_found)
+{
+    jk_virtual_file_system vfs(resource);
+
+    assert_throws_logged(vfs.open("mat/missing.mat"));
+    assert_log_message(log_level::error, "mat/missing.mat: file not found");
+    assert_log_empty();
+}
+
+end_suite(jk_virtual_file_system_test);
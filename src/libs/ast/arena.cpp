@@ -0,0 +1,46 @@
+#include "arena.hpp"
+#include "utility/runtime_assert.hpp"
+#include <algorithm>
+
+constexpr size_t gorc::ast_arena::initial_block_size;
+constexpr size_t gorc::ast_arena::max_block_size;
+
+gorc::ast_arena::ast_arena()
+    : next_block_size(initial_block_size)
+{
+    return;
+}
+
+gorc::ast_arena::~ast_arena()
+{
+    for(auto *record = destructors; record; record = record->next) {
+        record->destroy(record->object);
+    }
+}
+
+void* gorc::ast_arena::allocate_block(size_t size, size_t alignment)
+{
+    runtime_assert(alignment <= alignof(std::max_align_t),
+                   "ast_arena does not support over-aligned types");
+
+    // Oversized requests get a block of their own, and the current block
+    // stays open for later small requests.
+    if(size > next_block_size / 4) {
+        blocks.emplace_back(new char[size]);
+        return blocks.back().get();
+    }
+
+    blocks.emplace_back(new char[next_block_size]);
+    cursor = blocks.back().get();
+    block_end = cursor + next_block_size;
+    next_block_size = std::min(next_block_size * 2, max_block_size);
+
+    void *rv = cursor;
+    cursor += size;
+    return rv;
+}
+
+size_t gorc::ast_arena::block_count() const
+{
+    return blocks.size();
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gorc {
+
+    // Bump-pointer allocator for objects which share a single lifetime.
+    // Memory is taken from large blocks and only released when the arena is
+    // destroyed. Destructors run in reverse order of construction, and only
+    // for objects which are not trivially destructible.
+    class ast_arena {
+    private:
+        class destructor_record {
+        public:
+            void (*destroy)(void *);
+            void *object;
+            destructor_record *next;
+        };
+
+        std::vector<std::unique_ptr<char[]>> blocks;
+        char *cursor = nullptr;
+        char *block_end = nullptr;
+        size_t next_block_size;
+
+        destructor_record *destructors = nullptr;
+
+        void* allocate_block(size_t size, size_t alignment);
+
+        template <typename T>
+        static void destroy_object(void *object)
+        {
+            reinterpret_cast<T*>(object)->~T();
+        }
+
+        template <typename T, typename ...ArgT>
+        T* internal_emplace(std::true_type /* trivially destructible */, ArgT &&...args)
+        {
+            void *mem = allocate(sizeof(T), alignof(T));
+            return new(mem) T(std::forward<ArgT>(args)...);
+        }
+
+        template <typename T, typename ...ArgT>
+        T* internal_emplace(std::false_type /* trivially destructible */, ArgT &&...args)
+        {
+            // Allocate the record first, so that a constructed object is
+            // always registered.
+            void *record_mem = allocate(sizeof(destructor_record), alignof(destructor_record));
+            void *mem = allocate(sizeof(T), alignof(T));
+            T *rv = new(mem) T(std::forward<ArgT>(args)...);
+
+            destructors = new(record_mem) destructor_record { &destroy_object<T>, rv, destructors };
+            return rv;
+        }
+
+    public:
+        static constexpr size_t initial_block_size = 64 * 1024;
+        static constexpr size_t max_block_size = 1024 * 1024;
+
+        ast_arena();
+        ~ast_arena();
+
+        ast_arena(ast_arena const &) = delete;
+        ast_arena& operator=(ast_arena const &) = delete;
+
+        void* allocate(size_t size, size_t alignment)
+        {
+            size_t space = static_cast<size_t>(block_end - cursor);
+            void *p = cursor;
+            if(cursor && std::align(alignment, size, p, space)) {
+                cursor = static_cast<char*>(p) + size;
+                return p;
+            }
+
+            return allocate_block(size, alignment);
+        }
+
+        template <typename T, typename ...ArgT>
+        T* emplace(ArgT &&...args)
+        {
+            return internal_emplace<T>(std::is_trivially_destructible<T>(),
+                                       std::forward<ArgT>(args)...);
+        }
+
+        size_t block_count() const;
+    };
+
+    // Standard allocator backed by an ast_arena. Memory is reclaimed when the
+    // arena is destroyed. A default-constructed allocator uses the free store.
+    template <typename T>
+    class ast_allocator {
+        template <typename U> friend class ast_allocator;
+
+    private:
+        ast_arena *arena = nullptr;
+
+    public:
+        using value_type = T;
+
+        ast_allocator() = default;
+
+        explicit ast_allocator(ast_arena &arena)
+            : arena(&arena)
+        {
+            return;
+        }
+
+        template <typename U>
+        ast_allocator(ast_allocator<U> const &other)
+            : arena(other.arena)
+        {
+            return;
+        }
+
+        T* allocate(size_t n)
+        {
+            if(n > static_cast<size_t>(-1) / sizeof(T)) {
+                throw std::bad_alloc();
+            }
+
+            if(arena) {
+                return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+            }
+
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T *p, size_t)
+        {
+            if(!arena) {
+                ::operator delete(p);
+            }
+        }
+
+        template <typename U>
+        bool operator==(ast_allocator<U> const &other) const
+        {
+            return arena == other.arena;
+        }
+
+        template <typename U>
+        bool operator!=(ast_allocator<U> const &other) const
+        {
+            return arena != other.arena;
+        }
+    };
+
+}
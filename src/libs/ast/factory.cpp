@@ -1,6 +0,0 @@
-#include "factory.hpp"
-
-gorc::ast_factory::factory_factory::~factory_factory()
-{
-    return;
-}
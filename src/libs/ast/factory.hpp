@@ -1,59 +1,45 @@
 #pragma once
 
 #include "node.hpp"
+#include "arena.hpp"
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
-#include <vector>
+#include <type_traits>
 
 namespace gorc {
 
+    // Owns every node of an AST. Nodes are allocated from a single arena and
+    // destroyed together with the factory. Nodes which use an ast_allocator
+    // (such as ast_list_node) also allocate their contents from the arena.
     class ast_factory {
     private:
-        class factory_factory {
-        public:
-            virtual ~factory_factory();
-        };
-
-        template <typename NodeT>
-        class factory_factory_impl : public factory_factory {
-        private:
-            std::vector<std::unique_ptr<NodeT>> nodes;
-
-        public:
-            template <typename ...ArgT>
-            NodeT* emplace(ArgT &&...args)
-            {
-                nodes.emplace_back(std::make_unique<NodeT>(std::forward<ArgT>(args)...));
-                return nodes.back().get();
-            }
-        };
-
-        std::unordered_map<std::type_index, std::unique_ptr<factory_factory>> factories;
-
-        template <typename NodeT>
-        factory_factory_impl<NodeT>& get_factory()
+        ast_arena arena;
+
+        template <typename NodeT, typename ...ArgT>
+        NodeT* emplace(std::true_type /* uses allocator */, ArgT &&...args)
         {
-            auto it = factories.find(typeid(NodeT));
-            if(it == factories.end()) {
-                it = factories.emplace(std::type_index(typeid(NodeT)),
-                                       std::make_unique<factory_factory_impl<NodeT>>()).first;
-            }
+            return arena.emplace<NodeT>(std::allocator_arg,
+                                        ast_allocator<char>(arena),
+                                        std::forward<ArgT>(args)...);
+        }
 
-            return *reinterpret_cast<factory_factory_impl<NodeT>*>(it->second.get());
+        template <typename NodeT, typename ...ArgT>
+        NodeT* emplace(std::false_type /* uses allocator */, ArgT &&...args)
+        {
+            return arena.emplace<NodeT>(std::forward<ArgT>(args)...);
         }
 
     public:
         template <typename NodeT, typename ...ArgT>
         NodeT* make(ArgT &&...args)
         {
-            return get_factory<NodeT>().emplace(std::forward<ArgT>(args)...);
+            return emplace<NodeT>(std::uses_allocator<NodeT, ast_allocator<char>>(),
+                                  std::forward<ArgT>(args)...);
         }
 
         template <typename VariantT, typename NodeT, typename ...ArgT>
         VariantT* make_var(ArgT &&...args)
         {
-            return get_factory<VariantT>().emplace(make<NodeT>(std::forward<ArgT>(args)...));
+            return make<VariantT>(make<NodeT>(std::forward<ArgT>(args)...));
         }
     };
 
@@ -3,6 +3,8 @@
 #include "log/diagnostic_context_location.hpp"
 #include "log/diagnostic_context.hpp"
 #include "utility/variant.hpp"
+#include "arena.hpp"
+#include <memory>
 #include <vector>
 
 namespace gorc {
@@ -43,7 +45,9 @@ namespace gorc {
     template <typename ElementT>
     class ast_list_node : public visitable_ast_node<ast_list_node<ElementT>> {
     public:
-        std::vector<ElementT> elements;
+        using allocator_type = ast_allocator<ElementT>;
+
+        std::vector<ElementT, allocator_type> elements;
 
         ast_list_node(diagnostic_context_location const &location)
             : visitable_ast_node<ast_list_node<ElementT>>(location)
@@ -56,6 +60,25 @@ namespace gorc {
         {
             elements.push_back(first);
         }
+
+        ast_list_node(std::allocator_arg_t,
+                      allocator_type const &alloc,
+                      diagnostic_context_location const &location)
+            : visitable_ast_node<ast_list_node<ElementT>>(location)
+            , elements(alloc)
+        {
+            return;
+        }
+
+        ast_list_node(std::allocator_arg_t,
+                      allocator_type const &alloc,
+                      diagnostic_context_location const &location,
+                      ElementT const &first)
+            : visitable_ast_node<ast_list_node<ElementT>>(location)
+            , elements(alloc)
+        {
+            elements.push_back(first);
+        }
     };
 
     template <typename VisitorT, typename EmT>
@@ -0,0 +1,112 @@
+#include "test/test.hpp"
+#include "ast/arena.hpp"
+#include "log/log.hpp"
+#include <vector>
+
+namespace {
+
+    class arena_mock_object {
+    public:
+        int value;
+
+        arena_mock_object(int value)
+            : value(value)
+        {
+            return;
+        }
+
+        ~arena_mock_object()
+        {
+            LOG_INFO(gorc::format("arena_mock_object destructor %d") % value);
+        }
+    };
+
+}
+
+begin_suite(ast_arena_test);
+
+test_case(destructors_run_in_reverse_order)
+{
+    auto arena = std::make_unique<gorc::ast_arena>();
+
+    auto first = arena->emplace<arena_mock_object>(1);
+    auto second = arena->emplace<arena_mock_object>(2);
+
+    assert_eq(first->value, 1);
+    assert_eq(second->value, 2);
+    assert_log_empty();
+
+    arena.reset();
+
+    assert_log_message(gorc::log_level::info, "arena_mock_object destructor 2");
+    assert_log_message(gorc::log_level::info, "arena_mock_object destructor 1");
+    assert_log_empty();
+}
+
+test_case(small_objects_share_block)
+{
+    gorc::ast_arena arena;
+
+    std::vector<int*> values;
+    for(int i = 0; i < 1000; ++i) {
+        values.push_back(arena.emplace<int>(i));
+    }
+
+    assert_eq(arena.block_count(), size_t(1));
+    for(int i = 0; i < 1000; ++i) {
+        assert_eq(*values[i], i);
+    }
+}
+
+test_case(allocations_are_aligned)
+{
+    gorc::ast_arena arena;
+
+    arena.emplace<char>('a');
+    auto d = arena.emplace<double>(5.0);
+
+    assert_eq(reinterpret_cast<uintptr_t>(d) % alignof(double), uintptr_t(0));
+    assert_eq(*d, 5.0);
+}
+
+test_case(oversized_allocation_gets_own_block)
+{
+    gorc::ast_arena arena;
+
+    arena.emplace<int>(5);
+    assert_eq(arena.block_count(), size_t(1));
+
+    arena.allocate(gorc::ast_arena::max_block_size * 2, alignof(int));
+    assert_eq(arena.block_count(), size_t(2));
+
+    // Small allocations continue in the original block
+    arena.emplace<int>(6);
+    assert_eq(arena.block_count(), size_t(2));
+}
+
+test_case(allocator_in_container)
+{
+    gorc::ast_arena arena;
+
+    std::vector<int, gorc::ast_allocator<int>> values((gorc::ast_allocator<int>(arena)));
+    for(int i = 0; i < 10000; ++i) {
+        values.push_back(i);
+    }
+
+    assert_eq(values.size(), size_t(10000));
+    assert_eq(values[9999], 9999);
+    assert_true(values.get_allocator() == gorc::ast_allocator<int>(arena));
+    assert_true(values.get_allocator() != gorc::ast_allocator<int>());
+}
+
+test_case(default_allocator_uses_free_store)
+{
+    std::vector<int, gorc::ast_allocator<int>> values;
+    for(int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+
+    assert_eq(values[99], 99);
+}
+
+end_suite(ast_arena_test);
@@ -43,4 +43,17 @@ test_case(destructors_called)
     assert_log_empty();
 }
 
+test_case(list_node_uses_arena)
+{
+    gorc::ast_factory fac;
+
+    auto list = fac.make<gorc::ast_list_node<int>>(gorc::diagnostic_context_location(), 5);
+    list->elements.push_back(6);
+
+    assert_eq(list->elements.size(), size_t(2));
+    assert_eq(list->elements.front(), 5);
+    assert_eq(list->elements.back(), 6);
+    assert_true(list->elements.get_allocator() != gorc::ast_allocator<int>());
+}
+
 end_suite(ast_factory_test);
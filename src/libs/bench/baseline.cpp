@@ -0,0 +1,40 @@
+#include "baseline.hpp"
+#include <unordered_map>
+
+std::vector<gorc::bench::benchmark_comparison>
+    gorc::bench::compare_to_baseline(benchmark_report const &current,
+                                     benchmark_report const &baseline,
+                                     std::string const &calibration_name)
+{
+    std::unordered_map<std::string, benchmark_result const *> baseline_map;
+    for(auto const &result : baseline.benchmarks) {
+        baseline_map.emplace(result.name, &result);
+    }
+
+    double scale = 1.0;
+    for(auto const &result : current.benchmarks) {
+        auto it = baseline_map.find(result.name);
+        if(result.name == calibration_name &&
+           it != baseline_map.end() &&
+           it->second->median_ns > 0.0) {
+            scale = result.median_ns / it->second->median_ns;
+        }
+    }
+
+    std::vector<benchmark_comparison> rv;
+    for(auto const &result : current.benchmarks) {
+        auto it = baseline_map.find(result.name);
+        if(it == baseline_map.end() || it->second->median_ns <= 0.0) {
+            continue;
+        }
+
+        benchmark_comparison cmp;
+        cmp.name = result.name;
+        cmp.baseline_ns = it->second->median_ns;
+        cmp.current_ns = result.median_ns;
+        cmp.change = result.median_ns / (it->second->median_ns * scale) - 1.0;
+        rv.push_back(cmp);
+    }
+
+    return rv;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "result.hpp"
+#include <string>
+#include <vector>
+
+namespace gorc {
+    namespace bench {
+
+        class benchmark_comparison {
+        public:
+            std::string name;
+            double baseline_ns = 0.0;
+            double current_ns = 0.0;
+
+            // Relative change in median time after scaling by the
+            // calibration benchmark. Positive values are slower.
+            double change = 0.0;
+        };
+
+        // Compares benchmarks present in both reports. When both contain the
+        // calibration benchmark, baseline times are scaled by its ratio, so
+        // that a baseline recorded on another machine remains comparable.
+        std::vector<benchmark_comparison> compare_to_baseline(benchmark_report const &current,
+                                                              benchmark_report const &baseline,
+                                                              std::string const &calibration_name);
+
+    }
+}
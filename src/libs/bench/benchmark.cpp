@@ -0,0 +1,30 @@
+#include "benchmark.hpp"
+
+namespace {
+    volatile uint64_t consumed_value = 0;
+}
+
+gorc::bench::benchmark::~benchmark()
+{
+    return;
+}
+
+size_t gorc::bench::benchmark::get_operation_count() const
+{
+    return 1;
+}
+
+size_t gorc::bench::benchmark::get_byte_count() const
+{
+    return 0;
+}
+
+gorc::bench::benchmark_registry::benchmark_registry()
+{
+    return;
+}
+
+void gorc::bench::consume(uint64_t value)
+{
+    consumed_value = consumed_value + value;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "utility/global.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace gorc {
+    namespace bench {
+
+        // A benchmark performs one batch of operations each time it is run.
+        // Setup belongs in the constructor and is not timed.
+        class benchmark {
+        public:
+            virtual ~benchmark();
+
+            virtual void run() = 0;
+
+            // Operations performed by each call to run
+            virtual size_t get_operation_count() const;
+
+            // Bytes processed by each call to run, or zero when throughput
+            // is not meaningful
+            virtual size_t get_byte_count() const;
+        };
+
+        using benchmark_factory = std::function<std::unique_ptr<benchmark>()>;
+
+        class benchmark_registry : public global {
+            template <typename GlobalT> friend class ::gorc::global_factory;
+
+        private:
+            benchmark_registry();
+
+        public:
+            // Ordered by name, so related benchmarks run together
+            std::map<std::string, benchmark_factory> factories;
+        };
+
+        // Registers a benchmark at static initialization time
+        template <typename T>
+        class benchmark_registration {
+        public:
+            explicit benchmark_registration(std::string const &name)
+            {
+                get_global<benchmark_registry>()->factories.emplace(name, [] {
+                        return std::make_unique<T>();
+                    });
+            }
+        };
+
+        // Keeps a computed value alive, so the work producing it is not
+        // optimized away.
+        void consume(uint64_t value);
+
+    }
+}
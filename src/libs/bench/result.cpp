@@ -0,0 +1,77 @@
+#include "result.hpp"
+#include "text/json_specification.hpp"
+
+using namespace gorc;
+using namespace gorc::bench;
+
+namespace {
+
+    json_specification<benchmark_result> benchmark_result_spec(
+            /* Members */
+            {
+                { "name", make_json_member(&benchmark_result::name) },
+                { "samples", make_json_member(&benchmark_result::samples) },
+                { "runs_per_sample", make_json_member(&benchmark_result::runs_per_sample) },
+                { "operations", make_json_member(&benchmark_result::operations) },
+                { "bytes", make_json_member(&benchmark_result::bytes) },
+                { "min_ns", make_json_member(&benchmark_result::min_ns) },
+                { "median_ns", make_json_member(&benchmark_result::median_ns) },
+                { "mean_ns", make_json_member(&benchmark_result::mean_ns) },
+                { "max_ns", make_json_member(&benchmark_result::max_ns) },
+                { "stddev_ns", make_json_member(&benchmark_result::stddev_ns) }
+            },
+
+            /* Required members */
+            { "name", "median_ns" }
+        );
+
+    json_specification<benchmark_report> benchmark_report_spec(
+            /* Members */
+            {
+                { "benchmarks", [](json_input_stream &f, benchmark_report &rep) {
+                        json_deserialize_array(f, [&](json_input_stream &f) {
+                            rep.benchmarks.emplace_back(deserialization_constructor, f);
+                        });
+                    }
+                }
+            }
+        );
+
+}
+
+gorc::bench::benchmark_result::benchmark_result(deserialization_constructor_tag,
+                                                json_input_stream &f)
+{
+    json_deserialize_with_specification(f, benchmark_result_spec, *this);
+}
+
+void gorc::bench::benchmark_result::json_serialize_object(json_output_stream &f) const
+{
+    json_serialize_members(f, [&] {
+        json_serialize_member(f, "name", [&] { json_serialize(f, name); });
+        json_serialize_member(f, "samples", [&] { json_serialize(f, samples); });
+        json_serialize_member(f, "runs_per_sample", [&] { json_serialize(f, runs_per_sample); });
+        json_serialize_member(f, "operations", [&] { json_serialize(f, operations); });
+        json_serialize_member(f, "bytes", [&] { json_serialize(f, bytes); });
+        json_serialize_member(f, "min_ns", [&] { json_serialize(f, min_ns); });
+        json_serialize_member(f, "median_ns", [&] { json_serialize(f, median_ns); });
+        json_serialize_member(f, "mean_ns", [&] { json_serialize(f, mean_ns); });
+        json_serialize_member(f, "max_ns", [&] { json_serialize(f, max_ns); });
+        json_serialize_member(f, "stddev_ns", [&] { json_serialize(f, stddev_ns); });
+    });
+}
+
+gorc::bench::benchmark_report::benchmark_report(deserialization_constructor_tag,
+                                                json_input_stream &f)
+{
+    json_deserialize_with_specification(f, benchmark_report_spec, *this);
+}
+
+void gorc::bench::benchmark_report::json_serialize_object(json_output_stream &f) const
+{
+    json_serialize_members(f, [&] {
+        json_serialize_member(f, "benchmarks", [&] {
+            json_serialize_array(f, benchmarks);
+        });
+    });
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "text/json_input_stream.hpp"
+#include "text/json_output_stream.hpp"
+#include "utility/constructor_tag.hpp"
+#include <string>
+#include <vector>
+
+namespace gorc {
+    namespace bench {
+
+        // Timings are in nanoseconds per operation
+        class benchmark_result {
+        public:
+            std::string name;
+            size_t samples = 0;
+            size_t runs_per_sample = 0;
+            size_t operations = 0;
+            size_t bytes = 0;
+
+            double min_ns = 0.0;
+            double median_ns = 0.0;
+            double mean_ns = 0.0;
+            double max_ns = 0.0;
+            double stddev_ns = 0.0;
+
+            benchmark_result() = default;
+            benchmark_result(deserialization_constructor_tag, json_input_stream &);
+
+            void json_serialize_object(json_output_stream &) const;
+        };
+
+        // Results of one run of the suite, as stored for comparison
+        class benchmark_report {
+        public:
+            std::vector<benchmark_result> benchmarks;
+
+            benchmark_report() = default;
+            benchmark_report(deserialization_constructor_tag, json_input_stream &);
+
+            void json_serialize_object(json_output_stream &) const;
+        };
+
+    }
+}
@@ -0,0 +1,61 @@
+#include "runner.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+
+namespace {
+
+    using clock = std::chrono::steady_clock;
+
+    constexpr size_t max_runs_per_sample = size_t(1) << 30;
+
+    clock::duration time_runs(gorc::bench::benchmark &b, size_t runs)
+    {
+        auto start = clock::now();
+        for(size_t i = 0; i < runs; ++i) {
+            b.run();
+        }
+
+        return clock::now() - start;
+    }
+
+}
+
+gorc::bench::benchmark_result gorc::bench::run_benchmark(std::string const &name,
+                                                         benchmark &b,
+                                                         run_options const &options)
+{
+    // Calibrate the number of runs per sample. Calibration also warms caches.
+    size_t runs = 1;
+    while(runs < max_runs_per_sample && time_runs(b, runs) < options.min_sample_time) {
+        runs *= 2;
+    }
+
+    for(size_t i = 0; i < options.warmup_samples; ++i) {
+        time_runs(b, runs);
+    }
+
+    size_t operations = std::max(b.get_operation_count(), size_t(1));
+    double operations_per_sample = static_cast<double>(runs) * static_cast<double>(operations);
+
+    std::vector<double> samples;
+    samples.reserve(options.samples);
+    for(size_t i = 0; i < options.samples; ++i) {
+        double ns = std::chrono::duration<double, std::nano>(time_runs(b, runs)).count();
+        samples.push_back(ns / operations_per_sample);
+    }
+
+    auto stats = compute_statistics(samples);
+
+    benchmark_result rv;
+    rv.name = name;
+    rv.samples = samples.size();
+    rv.runs_per_sample = runs;
+    rv.operations = operations;
+    rv.bytes = b.get_byte_count();
+    rv.min_ns = stats.min;
+    rv.median_ns = stats.median;
+    rv.mean_ns = stats.mean;
+    rv.max_ns = stats.max;
+    rv.stddev_ns = stats.stddev;
+    return rv;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "result.hpp"
+#include <chrono>
+
+namespace gorc {
+    namespace bench {
+
+        class run_options {
+        public:
+            size_t warmup_samples = 3;
+            size_t samples = 20;
+
+            // Each sample repeats the benchmark until it takes at least
+            // this long, so that timer resolution does not dominate.
+            std::chrono::steady_clock::duration min_sample_time = std::chrono::milliseconds(10);
+        };
+
+        benchmark_result run_benchmark(std::string const &name,
+                                       benchmark &b,
+                                       run_options const &options);
+
+    }
+}
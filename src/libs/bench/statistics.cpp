@@ -0,0 +1,32 @@
+#include "statistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+gorc::bench::sample_statistics gorc::bench::compute_statistics(std::vector<double> samples)
+{
+    sample_statistics rv;
+    if(samples.empty()) {
+        return rv;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    size_t n = samples.size();
+    rv.min = samples.front();
+    rv.max = samples.back();
+    rv.median = (n % 2 == 1) ? samples[n / 2]
+                             : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+    rv.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(n);
+
+    if(n > 1) {
+        double sum_sq = 0.0;
+        for(double sample : samples) {
+            sum_sq += (sample - rv.mean) * (sample - rv.mean);
+        }
+
+        rv.stddev = std::sqrt(sum_sq / static_cast<double>(n - 1));
+    }
+
+    return rv;
+}
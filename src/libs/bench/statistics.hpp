@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+
+namespace gorc {
+    namespace bench {
+
+        class sample_statistics {
+        public:
+            double min = 0.0;
+            double median = 0.0;
+            double mean = 0.0;
+            double max = 0.0;
+            double stddev = 0.0;
+        };
+
+        // Summarizes a set of samples. Standard deviation is the sample
+        // deviation, and zero for fewer than two samples.
+        sample_statistics compute_statistics(std::vector<double> samples);
+
+    }
+}
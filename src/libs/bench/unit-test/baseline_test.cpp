@@ -0,0 +1,53 @@
+#include "test/test.hpp"
+#include "bench/baseline.hpp"
+
+using namespace gorc;
+
+namespace {
+    bench::benchmark_result make_result(std::string const &name, double median_ns)
+    {
+        bench::benchmark_result rv;
+        rv.name = name;
+        rv.median_ns = median_ns;
+        return rv;
+    }
+}
+
+begin_suite(baseline_test);
+
+test_case(unscaled)
+{
+    bench::benchmark_report baseline;
+    baseline.benchmarks.push_back(make_result("a", 100.0));
+    baseline.benchmarks.push_back(make_result("b", 100.0));
+
+    bench::benchmark_report current;
+    current.benchmarks.push_back(make_result("a", 150.0));
+    current.benchmarks.push_back(make_result("c", 10.0));
+
+    auto cmp = bench::compare_to_baseline(current, baseline, "calibration");
+    assert_eq(cmp.size(), size_t(1));
+    assert_eq(cmp[0].name, std::string("a"));
+    assert_eq(cmp[0].baseline_ns, 100.0);
+    assert_eq(cmp[0].current_ns, 150.0);
+    assert_eq(cmp[0].change, 0.5);
+}
+
+test_case(scaled_by_calibration)
+{
+    bench::benchmark_report baseline;
+    baseline.benchmarks.push_back(make_result("a", 100.0));
+    baseline.benchmarks.push_back(make_result("calibration", 10.0));
+
+    // Everything is twice as slow on this machine
+    bench::benchmark_report current;
+    current.benchmarks.push_back(make_result("a", 200.0));
+    current.benchmarks.push_back(make_result("calibration", 20.0));
+
+    auto cmp = bench::compare_to_baseline(current, baseline, "calibration");
+    assert_eq(cmp.size(), size_t(2));
+    assert_eq(cmp[0].change, 0.0);
+    assert_eq(cmp[1].change, 0.0);
+}
+
+end_suite(baseline_test);
@@ -0,0 +1,47 @@
+#include "test/test.hpp"
+#include "bench/result.hpp"
+#include "io/memory_file.hpp"
+
+using namespace gorc;
+
+begin_suite(result_test);
+
+test_case(round_trip)
+{
+    bench::benchmark_report report;
+    report.benchmarks.emplace_back();
+
+    auto &result = report.benchmarks.back();
+    result.name = "ecs/iterate";
+    result.samples = 20;
+    result.runs_per_sample = 64;
+    result.operations = 1000;
+    result.bytes = 0;
+    result.min_ns = 1.5;
+    result.median_ns = 2.0;
+    result.mean_ns = 2.25;
+    result.max_ns = 4.0;
+    result.stddev_ns = 0.5;
+
+    memory_file mf;
+    {
+        json_output_stream jos(mf);
+        json_serialize(jos, report);
+    }
+
+    memory_file::reader mr(mf);
+    json_input_stream jis(mr);
+    bench::benchmark_report loaded(deserialization_constructor, jis);
+
+    assert_eq(loaded.benchmarks.size(), size_t(1));
+
+    auto const &loaded_result = loaded.benchmarks.front();
+    assert_eq(loaded_result.name, std::string("ecs/iterate"));
+    assert_eq(loaded_result.samples, size_t(20));
+    assert_eq(loaded_result.runs_per_sample, size_t(64));
+    assert_eq(loaded_result.operations, size_t(1000));
+    assert_eq(loaded_result.median_ns, 2.0);
+    assert_eq(loaded_result.stddev_ns, 0.5);
+}
+
+end_suite(result_test);
@@ -0,0 +1,49 @@
+#include "test/test.hpp"
+#include "bench/runner.hpp"
+
+using namespace gorc;
+
+namespace {
+    class counting_benchmark : public bench::benchmark {
+    public:
+        size_t runs = 0;
+
+        virtual void run() override
+        {
+            ++runs;
+        }
+
+        virtual size_t get_operation_count() const override
+        {
+            return 10;
+        }
+    };
+}
+
+begin_suite(runner_test);
+
+test_case(collects_samples)
+{
+    bench::run_options options;
+    options.warmup_samples = 2;
+    options.samples = 5;
+    options.min_sample_time = std::chrono::microseconds(100);
+
+    counting_benchmark b;
+    auto result = bench::run_benchmark("counting", b, options);
+
+    assert_eq(result.name, std::string("counting"));
+    assert_eq(result.samples, size_t(5));
+    assert_eq(result.operations, size_t(10));
+    assert_true(result.runs_per_sample >= size_t(1));
+
+    // Calibration doubles the runs per sample, then warmup and measured
+    // samples repeat it.
+    size_t calibration_runs = 2 * result.runs_per_sample - 1;
+    assert_eq(b.runs, calibration_runs + 7 * result.runs_per_sample);
+
+    assert_true(result.min_ns <= result.median_ns);
+    assert_true(result.median_ns <= result.max_ns);
+}
+
+end_suite(runner_test);
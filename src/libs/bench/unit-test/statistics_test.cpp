@@ -0,0 +1,41 @@
+#include "test/test.hpp"
+#include "bench/statistics.hpp"
+
+using namespace gorc;
+
+begin_suite(statistics_test);
+
+test_case(empty)
+{
+    auto stats = bench::compute_statistics({});
+    assert_eq(stats.median, 0.0);
+    assert_eq(stats.stddev, 0.0);
+}
+
+test_case(odd_count)
+{
+    auto stats = bench::compute_statistics({ 5.0, 1.0, 3.0 });
+    assert_eq(stats.min, 1.0);
+    assert_eq(stats.median, 3.0);
+    assert_eq(stats.mean, 3.0);
+    assert_eq(stats.max, 5.0);
+    assert_eq(stats.stddev, 2.0);
+}
+
+test_case(even_count)
+{
+    auto stats = bench::compute_statistics({ 4.0, 1.0, 2.0, 3.0 });
+    assert_eq(stats.median, 2.5);
+    assert_eq(stats.mean, 2.5);
+}
+
+test_case(single_sample)
+{
+    auto stats = bench::compute_statistics({ 7.0 });
+    assert_eq(stats.min, 7.0);
+    assert_eq(stats.median, 7.0);
+    assert_eq(stats.max, 7.0);
+    assert_eq(stats.stddev, 0.0);
+}
+
+end_suite(statistics_test);
@@ -1,8 +1,12 @@
 #include "content_manager.hpp"
 #include "loader_registry.hpp"
 #include "log/log.hpp"
+#include "log/log_buffer.hpp"
+#include "profile/profiler.hpp"
 #include "vfs/virtual_file_system.hpp"
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace {
 
@@ -59,6 +63,8 @@ void gorc::content_manager::finalize_internal(asset_id id)
     auto const &unsafe_ref = at_id(assets, id);
     if(!unsafe_ref.content) {
         std::string safe_name = unsafe_ref.name;
+        PROFILE_ZONE_TAGGED("content load", safe_name.c_str());
+
         diagnostic_context dc(safe_name.c_str());
         auto const &loader = services.get<loader_registry>().get_loader(unsafe_ref.type);
 
@@ -87,6 +93,90 @@ void gorc::content_manager::finalize_internal(asset_id id)
     }
 }
 
+void gorc::content_manager::preload_internal(fourcc type, std::vector<std::string> const &names)
+{
+    auto const &loader = services.get<loader_registry>().get_loader(type);
+    if(!loader.is_thread_safe()) {
+        return;
+    }
+
+    std::vector<asset_id> pending;
+    for(auto const &name : names) {
+        std::string real_name = canonical_content_name(name);
+
+        auto loaded_it = asset_map.find(real_name);
+        if(loaded_it == asset_map.end()) {
+            asset_id new_element(assets.size());
+            assets.emplace_back(type, real_name);
+            loaded_it = asset_map.emplace(real_name, new_element).first;
+            pending.push_back(new_element);
+        }
+        else if(!at_id(assets, loaded_it->second).content &&
+                std::find(pending.begin(), pending.end(), loaded_it->second) == pending.end()) {
+            pending.push_back(loaded_it->second);
+        }
+    }
+
+    if(pending.empty()) {
+        return;
+    }
+
+    // Workers only read the assets vector. Diagnostics are captured per asset
+    // and forwarded afterward, so log output does not depend on scheduling.
+    class preload_result {
+    public:
+        std::unique_ptr<asset> content;
+        log_buffer log;
+    };
+
+    std::vector<preload_result> results(pending.size());
+    auto const &vfs = services.get<virtual_file_system>();
+    std::atomic<size_t> next_job(0);
+
+    auto preload_thread = [&]() {
+        for(size_t i = next_job++; i < pending.size(); i = next_job++) {
+            auto const &name = at_id(assets, pending[i]).name;
+            auto &result = results[i];
+
+            PROFILE_ZONE_TAGGED("content preload", name.c_str());
+
+            scoped_log_capture capture(result.log);
+            try {
+                diagnostic_context dc(name.c_str());
+                auto file = vfs.find(name, loader.get_prefixes());
+                result.content =
+                    loader.deserialize(*std::get<1>(file), *this, pending[i], services, name);
+            }
+            catch(...) {
+                result.content.reset();
+            }
+        }
+    };
+
+    size_t threads = std::max(size_t(1), std::min(size_t(std::thread::hardware_concurrency()),
+                                                   pending.size()));
+
+    std::vector<std::thread> thread_pool;
+    for(size_t i = 1; i < threads; ++i) {
+        thread_pool.emplace_back(preload_thread);
+    }
+
+    preload_thread();
+
+    for(auto &thread : thread_pool) {
+        thread.join();
+    }
+
+    for(size_t i = 0; i < pending.size(); ++i) {
+        // Failed assets are retried by finalize_internal, which reports the
+        // error and substitutes the default asset in the usual order.
+        if(results[i].content) {
+            results[i].log.replay();
+            at_id(assets, pending[i]).content = std::move(results[i].content);
+        }
+    }
+}
+
 gorc::asset const &gorc::content_manager::load_from_id(asset_id id)
 {
     finalize_internal(id);
@@ -35,6 +35,7 @@ namespace gorc {
 
         asset_id load_internal(fourcc type, std::string const &name);
         void finalize_internal(asset_id id);
+        void preload_internal(fourcc type, std::vector<std::string> const &names);
 
     public:
         explicit content_manager(service_registry const &services);
@@ -53,6 +54,15 @@ namespace gorc {
 
         asset const &load_from_id(asset_id id);
 
+        // Loads a batch of assets ahead of time. When the loader is thread safe,
+        // ids are assigned in order and the assets are deserialized concurrently.
+        // Assets that fail to load are left for load() to report.
+        template <typename T>
+        void preload(std::vector<std::string> const &names)
+        {
+            preload_internal(T::type, names);
+        }
+
         template <typename T>
         asset_id load_id(std::string const &name)
         {
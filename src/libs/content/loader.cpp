@@ -9,3 +9,8 @@ gorc::maybe<char const *> gorc::loader::get_default() const
 {
     return nothing;
 }
+
+bool gorc::loader::is_thread_safe() const
+{
+    return false;
+}
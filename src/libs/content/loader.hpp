@@ -22,5 +22,9 @@ namespace gorc {
 
         virtual std::vector<path> const &get_prefixes() const = 0;
         virtual maybe<char const *> get_default() const;
+
+        // Returns true when deserialize may run on several threads at once.
+        // Such loaders must not load other assets through the content manager.
+        virtual bool is_thread_safe() const;
     };
 }
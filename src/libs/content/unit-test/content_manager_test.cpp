@@ -48,7 +48,7 @@ namespace {
                 return std::make_unique<memory_file::reader>(default_mf);
             }
 
-            LOG_FATAL(format("could not open") % p.generic_string());
+            LOG_FATAL(format("could not open %s") % p.generic_string());
         }
 
         virtual std::tuple<path, std::unique_ptr<input_stream>>
@@ -104,6 +104,51 @@ namespace {
     MAKE_ID_TYPE(mock_asset);
 
     fourcc const mock_loader::type = "MOCK"_4CC;
+
+    class threaded_mock_asset : public asset {
+    public:
+        static fourcc const type;
+
+        int value;
+
+        threaded_mock_asset(int value)
+            : value(value)
+        {
+            return;
+        }
+    };
+
+    fourcc const threaded_mock_asset::type = "TMCK"_4CC;
+
+    class threaded_mock_loader : public loader {
+    public:
+        static fourcc const type;
+
+        virtual std::vector<path> const &get_prefixes() const override
+        {
+            static std::vector<path> rv = {""};
+            return rv;
+        }
+
+        virtual bool is_thread_safe() const override
+        {
+            return true;
+        }
+
+        virtual std::unique_ptr<asset> deserialize(input_stream &is,
+                                                   content_manager &,
+                                                   asset_id id,
+                                                   service_registry const &,
+                                                   std::string const &) const override
+        {
+            LOG_INFO(format("called threaded_mock_loader for asset %d") % static_cast<int>(id));
+            int value;
+            is.read(&value, sizeof(int));
+            return std::make_unique<threaded_mock_asset>(value);
+        }
+    };
+
+    fourcc const threaded_mock_loader::type = "TMCK"_4CC;
 }
 
 namespace gorc {
@@ -123,6 +168,7 @@ public:
     content_manager_test_fixture()
     {
         loaders.emplace_loader<mock_loader>();
+        loaders.emplace_loader<threaded_mock_loader>();
         services.add(loaders);
         services.add<virtual_file_system>(vfs);
     }
@@ -152,6 +198,7 @@ test_case(default_load)
     content_manager content(services);
 
     auto dne_ref = content.load<mock_asset>("dne");
+    assert_log_message(log_level::error, "dne: could not open dne");
     assert_log_message(log_level::error, "dne: failed to load asset dne, using default instead");
     assert_log_message(log_level::info, "dflt: called mock_loader for asset 0");
     assert_log_empty();
@@ -242,4 +289,53 @@ test_case(get_asset)
     assert_eq(foo_ref, foo_ref2);
 }
 
+test_case(preload_ignores_unsafe_loader)
+{
+    content_manager content(services);
+
+    content.preload<mock_asset>({ "foo", "bar" });
+    assert_log_empty();
+
+    content.load<mock_asset>("bar");
+    assert_log_message(log_level::info, "bar: called mock_loader for asset 0");
+    assert_log_empty();
+}
+
+test_case(preload_assigns_ids_in_order)
+{
+    content_manager content(services);
+
+    content.load<threaded_mock_asset>("foo");
+    assert_log_message(log_level::info, "foo: called threaded_mock_loader for asset 0");
+    assert_log_empty();
+
+    content.preload<threaded_mock_asset>({ "fnord", "FOO", "bar", "fnord" });
+    assert_log_message(log_level::info, "fnord: called threaded_mock_loader for asset 1");
+    assert_log_message(log_level::info, "bar: called threaded_mock_loader for asset 2");
+    assert_log_empty();
+
+    auto bar_ref = content.load<threaded_mock_asset>("bar");
+    auto fnord_ref = content.load<threaded_mock_asset>("fnord");
+    assert_log_empty();
+
+    assert_eq(static_cast<int>(bar_ref.get_id()), 2);
+    assert_eq(bar_ref->value, 10);
+    assert_eq(static_cast<int>(fnord_ref.get_id()), 1);
+    assert_eq(fnord_ref->value, 58);
+}
+
+test_case(preload_defers_failures)
+{
+    content_manager content(services);
+
+    content.preload<threaded_mock_asset>({ "dne", "foo" });
+    assert_log_message(log_level::info, "foo: called threaded_mock_loader for asset 1");
+    assert_log_empty();
+
+    assert_throws_logged(content.load<threaded_mock_asset>("dne"));
+    assert_log_message(log_level::error, "dne: could not open dne");
+    assert_log_message(log_level::error, "dne: failed to load asset dne");
+    assert_log_empty();
+}
+
 end_suite(content_manager_test);
@@ -9,9 +9,12 @@
 #include "utility/maybe.hpp"
 #include "utility/service_registry.hpp"
 #include "log/log.hpp"
+#include "profile/profiler.hpp"
+#include "profile/type_name.hpp"
 
 #include <vector>
 #include <memory>
+#include <string>
 
 namespace gorc {
 
@@ -21,6 +24,7 @@ namespace gorc {
         sequential_entity_generator<IdT> entities;
         component_relational_mapping<IdT> components;
         std::vector<std::unique_ptr<aspect>> aspects;
+        std::vector<std::string> aspect_names;
 
     public:
         event_bus &bus;
@@ -100,12 +104,14 @@ namespace gorc {
         void emplace_aspect(ArgT &&...args)
         {
             aspects.push_back(std::make_unique<T>(*this, std::forward<ArgT>(args)...));
+            aspect_names.push_back(profile::get_short_type_name(typeid(T)));
         }
 
         void update(time_delta dt)
         {
-            for(auto &aspect : aspects) {
-                aspect->update(dt);
+            for(size_t i = 0; i < aspects.size(); ++i) {
+                PROFILE_ZONE_TAGGED("ecs aspect", aspect_names[i].c_str());
+                aspects[i]->update(dt);
             }
 
             components.flush_erase_queue();
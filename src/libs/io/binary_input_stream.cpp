@@ -1,32 +1,88 @@
 #include "binary_input_stream.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 namespace {
     gorc::service_registry default_services;
 }
 
-gorc::binary_input_stream::binary_input_stream(input_stream &stream)
+gorc::binary_input_stream::binary_input_stream(input_stream &stream, size_t buffer_size)
     : stream(stream)
+    , buffer(buffer_size)
     , services(default_services)
 {
     return;
 }
 
 gorc::binary_input_stream::binary_input_stream(input_stream &stream,
-                                               service_registry const &services)
+                                               service_registry const &services,
+                                               size_t buffer_size)
     : stream(stream)
+    , buffer(buffer_size)
     , services(services)
 {
     return;
 }
 
+gorc::binary_input_stream::binary_input_stream(binary_input_stream &&other)
+    : stream(other.stream)
+    , buffer(std::move(other.buffer))
+    , buffer_offset(other.buffer_offset)
+    , buffer_filled(other.buffer_filled)
+    , services(other.services)
+{
+    other.buffer.clear();
+    other.buffer_offset = 0;
+    other.buffer_filled = 0;
+}
+
+size_t gorc::binary_input_stream::refill_buffer()
+{
+    buffer_offset = 0;
+    buffer_filled = stream.read_some(buffer.data(), buffer.size());
+    return buffer_filled;
+}
+
+void gorc::binary_input_stream::read_buffered(void *dest, size_t size)
+{
+    if(read_some(dest, size) != size) {
+        char const *msg = at_end() ?
+                          "input_stream::read size exceeds bounds" :
+                          "input_stream::read system error";
+        throw std::runtime_error(msg);
+    }
+}
+
 size_t gorc::binary_input_stream::read_some(void *dest, size_t size)
 {
-    return stream.read_some(dest, size);
+    char *dest_bytes = static_cast<char *>(dest);
+
+    size_t amt = std::min(buffer_filled - buffer_offset, size);
+    if(amt > 0) {
+        std::memcpy(dest_bytes, buffer.data() + buffer_offset, amt);
+        buffer_offset += amt;
+    }
+
+    size_t remaining = size - amt;
+    if(remaining == 0) {
+        return amt;
+    }
+
+    if(remaining >= buffer.size()) {
+        // Large reads bypass the buffer entirely.
+        return amt + stream.read_some(dest_bytes + amt, remaining);
+    }
+
+    size_t refill_amt = std::min(refill_buffer(), remaining);
+    std::memcpy(dest_bytes + amt, buffer.data(), refill_amt);
+    buffer_offset = refill_amt;
+
+    return amt + refill_amt;
 }
 
 bool gorc::binary_input_stream::at_end()
 {
-    return stream.at_end();
+    return buffer_offset == buffer_filled && stream.at_end();
 }
 
 std::string gorc::binary_input_stream::read_string()
@@ -37,7 +93,9 @@ std::string gorc::binary_input_stream::read_string()
     std::string rv;
     rv.resize(amt);
 
-    stream.read(&rv[0], amt);
+    if(amt > 0) {
+        read_bytes(&rv[0], amt);
+    }
 
     return rv;
 }
@@ -2,28 +2,72 @@
 
 #include <type_traits>
 #include <string>
+#include <vector>
+#include <cstring>
 #include "input_stream.hpp"
 #include "utility/constructor_tag.hpp"
 #include "utility/service_registry.hpp"
+#include "utility/span.hpp"
 #include "utility/time.hpp"
 #include "utility/flag_set.hpp"
 
 namespace gorc {
 
+    // Recommended read-ahead size for binary streams that own their underlying stream.
+    constexpr size_t binary_stream_buffer_size = 64 * 1024;
+
     class binary_input_stream : public input_stream {
     private:
         input_stream &stream;
 
+        // Read-ahead buffer. When empty, reads are passed directly to the underlying stream.
+        // A buffered stream may consume more of the underlying stream than it returns.
+        std::vector<char> buffer;
+        size_t buffer_offset = 0;
+        size_t buffer_filled = 0;
+
+        size_t refill_buffer();
+        void read_buffered(void *dest, size_t size);
+
+        inline void read_bytes(void *dest, size_t size)
+        {
+            if(buffer_filled - buffer_offset >= size) {
+                std::memcpy(dest, buffer.data() + buffer_offset, size);
+                buffer_offset += size;
+            }
+            else {
+                read_buffered(dest, size);
+            }
+        }
+
     public:
         service_registry const &services;
 
-        explicit binary_input_stream(input_stream &stream);
-        binary_input_stream(input_stream &stream, service_registry const &services);
+        explicit binary_input_stream(input_stream &stream, size_t buffer_size = 0);
+        binary_input_stream(input_stream &stream,
+                            service_registry const &services,
+                            size_t buffer_size = 0);
+
+        binary_input_stream(binary_input_stream const &) = delete;
+        binary_input_stream(binary_input_stream &&);
+
+        binary_input_stream& operator=(binary_input_stream const &) = delete;
+        binary_input_stream& operator=(binary_input_stream &&) = delete;
 
         template <typename T>
         typename std::enable_if<std::is_fundamental<T>::value, void>::type read_value(T &out)
         {
-            stream.read(&out, sizeof(T));
+            read_bytes(&out, sizeof(T));
+        }
+
+        template <typename T>
+        void read_span(span<T> dest)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "read_span requires a trivially copyable type");
+            if(!dest.empty()) {
+                read_bytes(dest.data(), dest.size_bytes());
+            }
         }
 
         std::string read_string();
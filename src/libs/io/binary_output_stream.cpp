@@ -1,32 +1,88 @@
 #include "binary_output_stream.hpp"
+#include "log/log.hpp"
+#include <exception>
 
 namespace {
     gorc::service_registry default_services;
 }
 
-gorc::binary_output_stream::binary_output_stream(output_stream &stream)
+gorc::binary_output_stream::binary_output_stream(output_stream &stream, size_t buffer_size)
     : stream(stream)
+    , buffer(buffer_size)
     , services(default_services)
 {
     return;
 }
 
 gorc::binary_output_stream::binary_output_stream(output_stream &stream,
-                                                 service_registry const &services)
+                                                 service_registry const &services,
+                                                 size_t buffer_size)
     : stream(stream)
+    , buffer(buffer_size)
     , services(services)
 {
     return;
 }
 
+gorc::binary_output_stream::binary_output_stream(binary_output_stream &&other)
+    : stream(other.stream)
+    , buffer(std::move(other.buffer))
+    , buffer_used(other.buffer_used)
+    , services(other.services)
+{
+    other.buffer.clear();
+    other.buffer_used = 0;
+}
+
+gorc::binary_output_stream::~binary_output_stream()
+{
+    try {
+        flush();
+    }
+    catch(std::exception const &e) {
+        LOG_ERROR(format("failed to flush binary output stream: %s") % e.what());
+    }
+}
+
+void gorc::binary_output_stream::write_buffered(void const *src, size_t size)
+{
+    flush();
+
+    if(size >= buffer.size()) {
+        // Large writes bypass the buffer entirely.
+        stream.write(src, size);
+    }
+    else {
+        std::memcpy(buffer.data(), src, size);
+        buffer_used = size;
+    }
+}
+
+void gorc::binary_output_stream::flush()
+{
+    if(buffer_used > 0) {
+        // Reset first so a failed write is not repeated on destruction.
+        size_t amt = buffer_used;
+        buffer_used = 0;
+        stream.write(buffer.data(), amt);
+    }
+}
+
 void gorc::binary_output_stream::write_string(std::string const &str)
 {
     size_t amt = str.size();
     write_value<size_t>(amt);
-    stream.write(str.data(), amt);
+
+    if(amt > 0) {
+        write_bytes(str.data(), amt);
+    }
 }
 
 size_t gorc::binary_output_stream::write_some(void const *src, size_t size)
 {
-    return stream.write_some(src, size);
+    if(size > 0) {
+        write_bytes(src, size);
+    }
+
+    return size;
 }
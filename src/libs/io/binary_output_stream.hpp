@@ -2,8 +2,11 @@
 
 #include <type_traits>
 #include <string>
+#include <vector>
+#include <cstring>
 #include "output_stream.hpp"
 #include "utility/service_registry.hpp"
+#include "utility/span.hpp"
 #include "utility/time.hpp"
 #include "utility/flag_set.hpp"
 
@@ -13,20 +16,59 @@ namespace gorc {
     private:
         output_stream &stream;
 
+        // Write-behind buffer. When empty, writes are passed directly to the underlying stream.
+        // Buffered data reaches the underlying stream on flush or destruction.
+        std::vector<char> buffer;
+        size_t buffer_used = 0;
+
+        void write_buffered(void const *src, size_t size);
+
+        inline void write_bytes(void const *src, size_t size)
+        {
+            if(buffer.size() - buffer_used >= size) {
+                std::memcpy(buffer.data() + buffer_used, src, size);
+                buffer_used += size;
+            }
+            else {
+                write_buffered(src, size);
+            }
+        }
+
     public:
         service_registry const &services;
 
-        explicit binary_output_stream(output_stream &stream);
-        binary_output_stream(output_stream &stream, service_registry const &services);
+        explicit binary_output_stream(output_stream &stream, size_t buffer_size = 0);
+        binary_output_stream(output_stream &stream,
+                             service_registry const &services,
+                             size_t buffer_size = 0);
+        ~binary_output_stream();
+
+        binary_output_stream(binary_output_stream const &) = delete;
+        binary_output_stream(binary_output_stream &&);
+
+        binary_output_stream& operator=(binary_output_stream const &) = delete;
+        binary_output_stream& operator=(binary_output_stream &&) = delete;
 
         template <typename T>
         typename std::enable_if<std::is_fundamental<T>::value, void>::type write_value(T &out)
         {
-            stream.write(&out, sizeof(T));
+            write_bytes(&out, sizeof(T));
+        }
+
+        template <typename T>
+        void write_span(span<T const> src)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "write_span requires a trivially copyable type");
+            if(!src.empty()) {
+                write_bytes(src.data(), src.size_bytes());
+            }
         }
 
         void write_string(std::string const &str);
 
+        void flush();
+
         virtual size_t write_some(void const *src, size_t size) override;
     };
 
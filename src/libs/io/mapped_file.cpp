@@ -0,0 +1,80 @@
+#include "mapped_file.hpp"
+#include "native_file.hpp"
+#include <system_error>
+
+#ifndef PLATFORM_MINGW
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef PLATFORM_MINGW
+gorc::mapped_file::mapped_file(path const &filename)
+{
+    auto file = make_native_read_only_file(filename);
+    buffer.resize(file->size());
+    file->read(buffer.data(), buffer.size());
+}
+
+gorc::mapped_file::~mapped_file()
+{
+    return;
+}
+#else
+gorc::mapped_file::mapped_file(path const &filename)
+{
+    int fd = -1;
+    do {
+        fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    } while(fd < 0 && errno == EINTR);
+
+    if(fd < 0) {
+        throw std::system_error(errno, std::generic_category());
+    }
+
+    struct stat st;
+    if(::fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category());
+    }
+
+    // Empty files cannot be mapped, but also have nothing to map.
+    if(st.st_size > 0) {
+        void *result = ::mmap(nullptr,
+                              static_cast<size_t>(st.st_size),
+                              PROT_READ,
+                              MAP_PRIVATE,
+                              fd,
+                              0);
+        if(result == MAP_FAILED) {
+            int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category());
+        }
+
+        mapping = result;
+        mapping_size = static_cast<size_t>(st.st_size);
+    }
+
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+}
+
+gorc::mapped_file::~mapped_file()
+{
+    if(mapping) {
+        ::munmap(mapping, mapping_size);
+    }
+}
+#endif
+
+gorc::span<char const> gorc::mapped_file::data() const
+{
+    if(mapping) {
+        return make_span(static_cast<char const*>(mapping), mapping_size);
+    }
+
+    return make_span(buffer.data(), buffer.size());
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "path.hpp"
+#include "utility/span.hpp"
+#include <vector>
+
+namespace gorc {
+
+    // Read-only view of the entire contents of a file. The file is memory
+    // mapped where the platform supports it, and read into memory otherwise.
+    class mapped_file {
+    private:
+        void *mapping = nullptr;
+        size_t mapping_size = 0;
+
+        std::vector<char> buffer;
+
+    public:
+        mapped_file(path const &filename);
+        ~mapped_file();
+
+        mapped_file(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file const&) = delete;
+
+        span<char const> data() const;
+    };
+
+}
@@ -0,0 +1,151 @@
+#include "snapshot_image.hpp"
+#include "log/log.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    constexpr uint32_t snapshot_record_magic = 0x50414E53U; // 'SNAP'
+    constexpr uint32_t end_of_region = 0xFFFFFFFFU;
+}
+
+gorc::span<char> gorc::snapshot_image::reserve_region(uint32_t id, size_t size)
+{
+    auto it = regions.find(id);
+    if(it == regions.end()) {
+        auto spare_it = spare.find(id);
+        if(spare_it != spare.end()) {
+            it = regions.emplace(id, std::move(spare_it->second)).first;
+            spare.erase(spare_it);
+        }
+        else {
+            it = regions.emplace(id, std::vector<char>()).first;
+        }
+    }
+
+    it->second.resize(size);
+    return make_span(it->second);
+}
+
+gorc::span<char const> gorc::snapshot_image::get_region(uint32_t id) const
+{
+    auto it = regions.find(id);
+    if(it == regions.end()) {
+        return span<char const>(nullptr, 0);
+    }
+
+    return span<char const>(it->second.data(), it->second.size());
+}
+
+bool gorc::snapshot_image::has_region(uint32_t id) const
+{
+    return regions.find(id) != regions.end();
+}
+
+void gorc::snapshot_image::erase_region(uint32_t id)
+{
+    regions.erase(id);
+}
+
+void gorc::snapshot_image::clear()
+{
+    spare.clear();
+    spare.swap(regions);
+}
+
+size_t gorc::snapshot_image::size() const
+{
+    return regions.size();
+}
+
+void gorc::snapshot_image::apply_record(binary_input_stream &is)
+{
+    if(binary_deserialize<uint32_t>(is) != snapshot_record_magic) {
+        LOG_FATAL("stream does not contain a snapshot record");
+    }
+
+    auto region_count = binary_deserialize<uint32_t>(is);
+
+    std::map<uint32_t, std::vector<char>> next_regions;
+    for(uint32_t i = 0; i < region_count; ++i) {
+        auto id = binary_deserialize<uint32_t>(is);
+        auto size = static_cast<size_t>(binary_deserialize<uint64_t>(is));
+
+        // Pages left out of the record are unchanged from the previous image.
+        auto &bytes = next_regions[id];
+        auto it = regions.find(id);
+        if(it != regions.end()) {
+            bytes = std::move(it->second);
+        }
+
+        bytes.resize(size);
+
+        while(true) {
+            auto page = binary_deserialize<uint32_t>(is);
+            if(page == end_of_region) {
+                break;
+            }
+
+            size_t offset = static_cast<size_t>(page) * snapshot_page_size;
+            if(offset >= size) {
+                LOG_FATAL(format("snapshot page %d is outside region %d") % page % id);
+            }
+
+            size_t length = std::min(snapshot_page_size, size - offset);
+            is.read_span(span<char>(bytes.data() + offset, length));
+        }
+    }
+
+    regions = std::move(next_regions);
+}
+
+size_t gorc::snapshot_image::apply_records(binary_input_stream &is)
+{
+    size_t records = 0;
+    while(!is.at_end()) {
+        apply_record(is);
+        ++records;
+    }
+
+    return records;
+}
+
+void gorc::snapshot_page_tracker::write(binary_output_stream &os, snapshot_image &image)
+{
+    last_pages_written = 0;
+    last_pages_total = 0;
+
+    binary_serialize<uint32_t>(os, snapshot_record_magic);
+    binary_serialize<uint32_t>(os, static_cast<uint32_t>(image.size()));
+
+    for(auto const &region : image) {
+        auto const &bytes = region.second;
+        auto prev = previous.get_region(region.first);
+
+        binary_serialize<uint32_t>(os, region.first);
+        binary_serialize<uint64_t>(os, bytes.size());
+
+        for(size_t offset = 0; offset < bytes.size(); offset += snapshot_page_size) {
+            size_t length = std::min(snapshot_page_size, bytes.size() - offset);
+            ++last_pages_total;
+
+            bool dirty = (offset + length > prev.size()) ||
+                         std::memcmp(bytes.data() + offset, prev.data() + offset, length) != 0;
+            if(!dirty) {
+                continue;
+            }
+
+            binary_serialize<uint32_t>(os, static_cast<uint32_t>(offset / snapshot_page_size));
+            os.write_span(span<char const>(bytes.data() + offset, length));
+            ++last_pages_written;
+        }
+
+        binary_serialize<uint32_t>(os, end_of_region);
+    }
+
+    std::swap(previous, image);
+}
+
+void gorc::snapshot_page_tracker::reset()
+{
+    previous = snapshot_image();
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "binary_input_stream.hpp"
+#include "binary_output_stream.hpp"
+#include "utility/span.hpp"
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace gorc {
+
+    // Unit in which snapshot regions are compared and written.
+    constexpr size_t snapshot_page_size = 4096;
+
+    // A copy of some state as numbered byte regions. Regions are copied out of
+    // the live state in one pass, so the copy can be written out while the
+    // state moves on.
+    class snapshot_image {
+    private:
+        std::map<uint32_t, std::vector<char>> regions;
+
+        // Storage of regions dropped by clear, reused when they are reserved again.
+        std::map<uint32_t, std::vector<char>> spare;
+
+    public:
+        using const_iterator = std::map<uint32_t, std::vector<char>>::const_iterator;
+
+        // Sizes the region and returns its bytes for the caller to fill.
+        // Storage is kept between captures.
+        span<char> reserve_region(uint32_t id, size_t size);
+
+        template <typename T>
+        void set_region(uint32_t id, span<T const> data)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "snapshot regions require a trivially copyable type");
+            auto dest = reserve_region(id, data.size_bytes());
+            if(!data.empty()) {
+                std::memcpy(dest.data(), data.data(), data.size_bytes());
+            }
+        }
+
+        // Returns an empty span when the region is not present.
+        span<char const> get_region(uint32_t id) const;
+        bool has_region(uint32_t id) const;
+
+        void erase_region(uint32_t id);
+
+        // Drops every region. Their storage is kept for the next capture.
+        void clear();
+
+        size_t size() const;
+
+        inline const_iterator begin() const
+        {
+            return regions.begin();
+        }
+
+        inline const_iterator end() const
+        {
+            return regions.end();
+        }
+
+        // Reads one record written by snapshot_page_tracker and applies it.
+        // Applying every record of a stream in order rebuilds the last image.
+        void apply_record(binary_input_stream &is);
+
+        // Applies records until the end of the stream. Returns the number of
+        // records read.
+        size_t apply_records(binary_input_stream &is);
+    };
+
+    // Writes images as records holding only the pages that changed since the
+    // previous record. The first record holds every page.
+    class snapshot_page_tracker {
+    private:
+        snapshot_image previous;
+
+        size_t last_pages_written = 0;
+        size_t last_pages_total = 0;
+
+    public:
+        // Writes the image, then keeps it as the base for the next record.
+        // The image is swapped with the previous base, whose storage the
+        // caller may reuse for the next capture.
+        void write(binary_output_stream &os, snapshot_image &image);
+
+        // The next record will hold every page.
+        void reset();
+
+        inline size_t get_last_pages_written() const
+        {
+            return last_pages_written;
+        }
+
+        inline size_t get_last_pages_total() const
+        {
+            return last_pages_total;
+        }
+    };
+
+}
@@ -0,0 +1,113 @@
+#include "snapshot_writer.hpp"
+#include <utility>
+
+gorc::snapshot_writer::snapshot_writer(output_stream &stream)
+    : os(stream, binary_stream_buffer_size)
+    , thread(&snapshot_writer::run, this)
+{
+    return;
+}
+
+gorc::snapshot_writer::~snapshot_writer()
+{
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        stopping = true;
+    }
+
+    cv.notify_all();
+    thread.join();
+}
+
+void gorc::snapshot_writer::run()
+{
+    snapshot_image writing;
+
+    std::unique_lock<std::mutex> lk(lock);
+    while(true) {
+        cv.wait(lk, [&] { return has_pending || stopping; });
+        if(!has_pending) {
+            break;
+        }
+
+        // Pending keeps the storage of the last base for the next submit.
+        std::swap(writing, pending);
+        has_pending = false;
+        busy = true;
+        lk.unlock();
+
+        try {
+            tracker.write(os, writing);
+            os.flush();
+        }
+        catch(...) {
+            lk.lock();
+            exception = std::current_exception();
+            busy = false;
+            cv.notify_all();
+            return;
+        }
+
+        lk.lock();
+        ++records_written;
+        pages_written += tracker.get_last_pages_written();
+        pages_total += tracker.get_last_pages_total();
+        busy = false;
+        cv.notify_all();
+    }
+}
+
+void gorc::snapshot_writer::rethrow_exception()
+{
+    if(exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void gorc::snapshot_writer::submit(snapshot_image &image)
+{
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        rethrow_exception();
+
+        if(has_pending) {
+            ++records_dropped;
+        }
+
+        std::swap(image, pending);
+        has_pending = true;
+    }
+
+    cv.notify_all();
+}
+
+void gorc::snapshot_writer::flush()
+{
+    std::unique_lock<std::mutex> lk(lock);
+    cv.wait(lk, [&] { return (!has_pending && !busy) || exception; });
+    rethrow_exception();
+}
+
+size_t gorc::snapshot_writer::get_records_written()
+{
+    std::lock_guard<std::mutex> lk(lock);
+    return records_written;
+}
+
+size_t gorc::snapshot_writer::get_records_dropped()
+{
+    std::lock_guard<std::mutex> lk(lock);
+    return records_dropped;
+}
+
+size_t gorc::snapshot_writer::get_pages_written()
+{
+    std::lock_guard<std::mutex> lk(lock);
+    return pages_written;
+}
+
+size_t gorc::snapshot_writer::get_pages_total()
+{
+    std::lock_guard<std::mutex> lk(lock);
+    return pages_total;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "snapshot_image.hpp"
+#include "binary_output_stream.hpp"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace gorc {
+
+    // Writes snapshot images on a background thread, so the thread capturing
+    // them only pays for the copy. Each image is written as a record of the
+    // pages that changed since the last image written.
+    class snapshot_writer {
+    private:
+        binary_output_stream os;
+        snapshot_page_tracker tracker;
+
+        std::mutex lock;
+        std::condition_variable cv;
+
+        snapshot_image pending;
+        bool has_pending = false;
+        bool busy = false;
+        bool stopping = false;
+        std::exception_ptr exception;
+
+        size_t records_written = 0;
+        size_t records_dropped = 0;
+        size_t pages_written = 0;
+        size_t pages_total = 0;
+
+        std::thread thread;
+
+        void run();
+        void rethrow_exception();
+
+    public:
+        explicit snapshot_writer(output_stream &stream);
+        ~snapshot_writer();
+
+        snapshot_writer(snapshot_writer const &) = delete;
+        snapshot_writer& operator=(snapshot_writer const &) = delete;
+
+        // Queues the image for writing. The image is swapped with storage
+        // from an earlier capture, which the caller may reuse. An image still
+        // waiting from a previous call is replaced; records only depend on
+        // images that were actually written.
+        void submit(snapshot_image &image);
+
+        // Blocks until every submitted image has been written and flushed.
+        void flush();
+
+        size_t get_records_written();
+        size_t get_records_dropped();
+        size_t get_pages_written();
+        size_t get_pages_total();
+    };
+
+}
@@ -153,4 +153,94 @@ test_case(time_round_trip)
     assert_eq(orig, td);
 }
 
+test_case(buffered_round_trip)
+{
+    memory_file mf;
+
+    {
+        binary_output_stream bos(mf, 16);
+        for(int i = 0; i < 100; ++i) {
+            binary_serialize<int>(bos, i);
+        }
+
+        binary_serialize(bos, std::string("Hello, World! This string exceeds the buffer."));
+        binary_serialize<double>(bos, 2.5);
+    }
+
+    binary_input_stream bis(mf, 16);
+    for(int i = 0; i < 100; ++i) {
+        assert_eq(binary_deserialize<int>(bis), i);
+    }
+
+    assert_eq(binary_deserialize<std::string>(bis),
+              std::string("Hello, World! This string exceeds the buffer."));
+    assert_eq(binary_deserialize<double>(bis), 2.5);
+    assert_true(bis.at_end());
+}
+
+test_case(buffered_output_flush)
+{
+    memory_file mf;
+
+    binary_output_stream bos(mf, 64);
+    binary_serialize<int>(bos, 5);
+    assert_eq(mf.size(), size_t(0));
+
+    bos.flush();
+    assert_eq(mf.size(), sizeof(int));
+}
+
+test_case(span_round_trip)
+{
+    memory_file mf;
+
+    std::vector<uint16_t> values;
+    for(int i = 0; i < 1000; ++i) {
+        values.push_back(static_cast<uint16_t>(i * 7));
+    }
+
+    {
+        binary_output_stream bos(mf, 128);
+        binary_serialize<char>(bos, 'a');
+        bos.write_span(span<uint16_t const>(values.data(), values.size()));
+        bos.write_span(span<uint16_t const>(values.data(), 3));
+        bos.write_span(span<uint16_t const>(values.data(), 0));
+        binary_serialize<char>(bos, 'b');
+    }
+
+    binary_input_stream bis(mf, 128);
+    assert_eq(binary_deserialize<char>(bis), 'a');
+
+    std::vector<uint16_t> read_values(values.size());
+    bis.read_span(make_span(read_values));
+    assert_eq(values, read_values);
+
+    std::vector<uint16_t> short_values(3);
+    bis.read_span(make_span(short_values));
+    assert_eq(short_values, (std::vector<uint16_t> { 0, 7, 14 }));
+
+    assert_eq(binary_deserialize<char>(bis), 'b');
+    assert_true(bis.at_end());
+}
+
+test_case(buffered_read_some)
+{
+    memory_file mf;
+
+    std::vector<char> values { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j' };
+    mf.write(values.data(), values.size());
+
+    binary_input_stream bis(mf, 4);
+    assert_eq(binary_deserialize<char>(bis), 'a');
+
+    std::vector<char> read_values(6);
+    bis.read(read_values.data(), read_values.size());
+    assert_eq(read_values, (std::vector<char> { 'b', 'c', 'd', 'e', 'f', 'g' }));
+    assert_true(!bis.at_end());
+
+    std::vector<char> past_end(4);
+    assert_throws(bis.read_span(make_span(past_end)), std::runtime_error,
+                  "input_stream::read size exceeds bounds");
+}
+
 end_suite(binary_serialization_test);
@@ -0,0 +1,246 @@
+#include "test/test.hpp"
+#include "io/snapshot_image.hpp"
+#include "io/memory_file.hpp"
+#include <vector>
+
+using namespace gorc;
+
+namespace {
+    std::vector<char> region_bytes(snapshot_image const &image, uint32_t id)
+    {
+        auto region = image.get_region(id);
+        return std::vector<char>(region.begin(), region.end());
+    }
+
+    std::vector<char> bytes_of(std::vector<int> const &values)
+    {
+        auto bytes = make_span(values).as_const_bytes();
+        return std::vector<char>(bytes.begin(), bytes.end());
+    }
+
+    std::vector<int> make_values(size_t count, int seed)
+    {
+        std::vector<int> rv;
+        for(size_t i = 0; i < count; ++i) {
+            rv.push_back(seed + static_cast<int>(i));
+        }
+
+        return rv;
+    }
+}
+
+begin_suite(snapshot_image_test);
+
+test_case(set_region_copies_bytes)
+{
+    snapshot_image image;
+    std::vector<int> values { 1, 2, 3 };
+    image.set_region(5, make_span(values).as_const_bytes());
+
+    assert_true(image.has_region(5));
+    assert_true(!image.has_region(6));
+    assert_eq(image.get_region(5).size(), sizeof(int) * 3);
+    assert_eq(image.get_region(6).size(), size_t(0));
+
+    values[0] = 10;
+    assert_eq(*reinterpret_cast<int const *>(image.get_region(5).data()), 1);
+}
+
+test_case(clear_drops_regions)
+{
+    snapshot_image image;
+    image.reserve_region(1, 16);
+    image.reserve_region(2, 16);
+
+    image.clear();
+    assert_eq(image.size(), size_t(0));
+
+    image.reserve_region(2, 8);
+    assert_eq(image.size(), size_t(1));
+    assert_eq(image.get_region(2).size(), size_t(8));
+}
+
+test_case(first_record_writes_every_page)
+{
+    memory_file mf;
+    snapshot_page_tracker tracker;
+
+    snapshot_image image;
+    image.reserve_region(1, snapshot_page_size * 2 + 10);
+
+    {
+        binary_output_stream bos(mf);
+        tracker.write(bos, image);
+    }
+
+    assert_eq(tracker.get_last_pages_written(), size_t(3));
+    assert_eq(tracker.get_last_pages_total(), size_t(3));
+}
+
+test_case(later_records_write_changed_pages)
+{
+    memory_file mf;
+    snapshot_page_tracker tracker;
+
+    auto values = make_values(snapshot_page_size, 0);
+    auto region_size = sizeof(int) * values.size();
+
+    snapshot_image image;
+    image.set_region(1, make_span(values).as_const_bytes());
+
+    {
+        binary_output_stream bos(mf);
+        tracker.write(bos, image);
+
+        values[snapshot_page_size / sizeof(int) + 1] = -1;
+
+        image.clear();
+        image.set_region(1, make_span(values).as_const_bytes());
+        tracker.write(bos, image);
+    }
+
+    assert_eq(tracker.get_last_pages_written(), size_t(1));
+    assert_eq(tracker.get_last_pages_total(), region_size / snapshot_page_size);
+}
+
+test_case(apply_records_rebuilds_last_image)
+{
+    memory_file mf;
+    snapshot_page_tracker tracker;
+
+    auto first = make_values(3000, 0);
+    auto second = first;
+    second[2500] = -1;
+    second.push_back(7);
+
+    auto other = make_values(10, 100);
+
+    {
+        binary_output_stream bos(mf);
+
+        snapshot_image image;
+        image.set_region(1, make_span(first).as_const_bytes());
+        image.set_region(2, make_span(other).as_const_bytes());
+        tracker.write(bos, image);
+
+        image.clear();
+        image.set_region(1, make_span(second).as_const_bytes());
+        tracker.write(bos, image);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+
+    snapshot_image rebuilt;
+    rebuilt.apply_record(bis);
+    assert_true(rebuilt.has_region(2));
+    assert_eq(region_bytes(rebuilt, 1), bytes_of(first));
+
+    rebuilt.apply_record(bis);
+    assert_true(!rebuilt.has_region(2));
+    assert_eq(region_bytes(rebuilt, 1), bytes_of(second));
+    assert_true(bis.at_end());
+}
+
+test_case(apply_records_reads_whole_stream)
+{
+    memory_file mf;
+    snapshot_page_tracker tracker;
+
+    auto first = make_values(3000, 0);
+    auto second = make_values(3000, 5);
+
+    {
+        binary_output_stream bos(mf);
+
+        snapshot_image image;
+        image.set_region(1, make_span(first).as_const_bytes());
+        tracker.write(bos, image);
+
+        image.clear();
+        image.set_region(1, make_span(second).as_const_bytes());
+        tracker.write(bos, image);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+
+    snapshot_image rebuilt;
+    assert_eq(rebuilt.apply_records(bis), size_t(2));
+    assert_eq(region_bytes(rebuilt, 1), bytes_of(second));
+}
+
+test_case(shrunk_region_is_rebuilt)
+{
+    memory_file mf;
+    snapshot_page_tracker tracker;
+
+    auto first = make_values(2000, 0);
+    auto second = make_values(10, 0);
+
+    {
+        binary_output_stream bos(mf);
+
+        snapshot_image image;
+        image.set_region(1, make_span(first).as_const_bytes());
+        tracker.write(bos, image);
+
+        image.clear();
+        image.set_region(1, make_span(second).as_const_bytes());
+        tracker.write(bos, image);
+    }
+
+    assert_eq(tracker.get_last_pages_written(), size_t(0));
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+
+    snapshot_image rebuilt;
+    rebuilt.apply_record(bis);
+    rebuilt.apply_record(bis);
+    assert_eq(rebuilt.get_region(1).size(), sizeof(int) * 10);
+    assert_eq(*reinterpret_cast<int const *>(rebuilt.get_region(1).data() + sizeof(int) * 9), 9);
+}
+
+test_case(reset_writes_every_page)
+{
+    memory_file mf;
+    snapshot_page_tracker tracker;
+
+    snapshot_image image;
+    image.reserve_region(1, snapshot_page_size * 2);
+
+    binary_output_stream bos(mf);
+    tracker.write(bos, image);
+
+    image.clear();
+    image.reserve_region(1, snapshot_page_size * 2);
+    tracker.write(bos, image);
+    assert_eq(tracker.get_last_pages_written(), size_t(0));
+
+    tracker.reset();
+    image.clear();
+    image.reserve_region(1, snapshot_page_size * 2);
+    tracker.write(bos, image);
+    assert_eq(tracker.get_last_pages_written(), size_t(2));
+}
+
+test_case(apply_record_rejects_other_data)
+{
+    memory_file mf;
+
+    {
+        binary_output_stream bos(mf);
+        binary_serialize<uint32_t>(bos, 1234U);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+
+    snapshot_image image;
+    assert_throws_logged(image.apply_record(bis));
+    assert_log_message(log_level::error, "stream does not contain a snapshot record");
+    assert_log_empty();
+}
+
+end_suite(snapshot_image_test);
@@ -0,0 +1,70 @@
+#include "test/test.hpp"
+#include "io/snapshot_writer.hpp"
+#include "io/memory_file.hpp"
+#include <vector>
+
+using namespace gorc;
+
+begin_suite(snapshot_writer_test);
+
+test_case(writes_submitted_images)
+{
+    memory_file mf;
+    std::vector<int> values(2048, 5);
+
+    {
+        snapshot_writer writer(mf);
+
+        snapshot_image image;
+        image.set_region(1, make_span(values).as_const_bytes());
+        writer.submit(image);
+        writer.flush();
+
+        values[0] = 6;
+
+        image.clear();
+        image.set_region(1, make_span(values).as_const_bytes());
+        writer.submit(image);
+        writer.flush();
+
+        assert_eq(writer.get_records_written(), size_t(2));
+        assert_eq(writer.get_records_dropped(), size_t(0));
+        assert_eq(writer.get_pages_written(), size_t(3));
+        assert_eq(writer.get_pages_total(), size_t(4));
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+
+    snapshot_image rebuilt;
+    while(!bis.at_end()) {
+        rebuilt.apply_record(bis);
+    }
+
+    auto region = rebuilt.get_region(1);
+    assert_eq(region.size(), sizeof(int) * values.size());
+    assert_eq(*reinterpret_cast<int const *>(region.data()), 6);
+}
+
+test_case(destructor_writes_pending_image)
+{
+    memory_file mf;
+
+    {
+        snapshot_writer writer(mf);
+
+        snapshot_image image;
+        image.reserve_region(3, 100);
+        writer.submit(image);
+    }
+
+    memory_file::reader mr(mf);
+    binary_input_stream bis(mr);
+
+    snapshot_image rebuilt;
+    rebuilt.apply_record(bis);
+    assert_eq(rebuilt.get_region(3).size(), size_t(100));
+    assert_true(bis.at_end());
+}
+
+end_suite(snapshot_writer_test);
@@ -7,6 +7,7 @@
 #include "libold/base/utility/time.hpp"
 #include "vfs/virtual_file_system.hpp"
 #include "content/content_manager.hpp"
+#include "profile/profiler.hpp"
 #include "libold/base/place/place_controller.hpp"
 #include "libold/base/view_stack.hpp"
 #include "libold/base/content/assets/shader.hpp"
@@ -19,6 +20,12 @@
 #include "libold/base/events/resized.hpp"
 #include "libold/base/events/window_focus.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace gorc {
 
 template <typename LayerIdT, typename PresenterT, typename MapperT>
@@ -82,6 +89,13 @@ public:
         return;
     }
 
+    // Called once per pass of the game loop on the main thread, after the
+    // frame is drawn. Without a simulation thread, any pending gameplay
+    // updates have also run.
+    virtual void end_frame() {
+        return;
+    }
+
     box<2, int> get_screen_size() const {
         return make_box(make_vector(0, 0), make_vector(static_cast<int>(window.getSize().x),
                                                        static_cast<int>(window.getSize().y)));
@@ -92,12 +106,29 @@ public:
     }
 
 private:
-    void draw(const gorc::time& time, const box<2, int>& view_size) {
+    using frame_clock = std::chrono::steady_clock;
+
+    // Most gameplay ticks run back to back when the simulation thread falls
+    // behind. Any further backlog is dropped.
+    static constexpr int max_catch_up_ticks = 8;
+
+    // Held by the simulation thread while it updates, and by the main thread
+    // while it handles window events and hands input over. Views draw from
+    // published snapshots without it.
+    std::mutex simulation_lock;
+
+    void draw_views(const gorc::time& time, const box<2, int>& view_size) {
+        PROFILE_ZONE("draw");
+
         window.setActive(true);
 
         // Draw views using texture render target.
         graphics::set_render_target(*texture_target);
         views.draw(time, view_size, *texture_target);
+    }
+
+    void present() {
+        PROFILE_ZONE("present");
 
         // Draw texture
         graphics::set_render_target(*default_target);
@@ -132,7 +163,7 @@ private:
         window.display();
     }
 
-    void internal_update(const gorc::time& time, const box<2, int>& view_size) {
+    void handle_input(const gorc::time& time, const box<2, int>& view_size) {
         auto sf_mouse_pos = sf::Mouse::getPosition(window);
         auto screen_size = get_screen_size();
 
@@ -143,6 +174,10 @@ private:
                 static_cast<int>(static_cast<double>(sf_mouse_pos.y) * height_fac));
 
         views.handle_input(time, mouse_pos);
+    }
+
+    void simulate(const gorc::time& time, const box<2, int>& view_size) {
+        PROFILE_ZONE("gameplay update");
 
         maybe_if(place_controller.current_presenter(), [&](PresenterT *curr_presenter) {
             curr_presenter->update(time);
@@ -151,11 +186,118 @@ private:
         update(time, view_size);
     }
 
+    void internal_update(const gorc::time& time, const box<2, int>& view_size) {
+        handle_input(time, view_size);
+        simulate(time, view_size);
+    }
+
+    void poll_events(const gorc::time& time, box<2, int>& view_size) {
+        sf::Event event;
+        while(window.pollEvent(event)) {
+            switch(event.type) {
+            case sf::Event::Closed:
+                eventbus.fire_event(events::exit());
+                break;
+
+            case sf::Event::Resized: {
+                    auto new_view_size = get_view_size();
+                    if(new_view_size != view_size) {
+                        view_size = new_view_size;
+                        eventbus.fire_event(events::resized(view_size));
+                        *texture_target = graphics::texture_render_target(view_size);
+                        *default_target = graphics::default_render_target(get_screen_size());
+                        views.resize(view_size);
+                    }
+                }
+                break;
+
+            case sf::Event::TextEntered: {
+                    char ch = static_cast<char>(event.text.unicode);
+                    if(ch >= 0x20 && ch < 0x7F) {
+                        views.handle_text(time, ch);
+                    }
+                }
+                break;
+
+            case sf::Event::GainedFocus:
+                eventbus.fire_event(events::window_focus(true));
+                break;
+
+            case sf::Event::LostFocus:
+                eventbus.fire_event(events::window_focus(false));
+                break;
+
+            default:
+                // Silently consume unhandled events.
+                break;
+            }
+        }
+    }
+
+    // Sleeps until the next frame is due when a frame rate limit is set.
+    void pace_frame(frame_clock::time_point& next_frame) {
+        if(max_frames_per_second <= 0) {
+            return;
+        }
+
+        auto frame_duration = std::chrono::duration_cast<frame_clock::duration>(
+                std::chrono::duration<double>(1.0 / static_cast<double>(max_frames_per_second)));
+        next_frame += frame_duration;
+
+        auto now = frame_clock::now();
+        if(next_frame <= now) {
+            // Running behind. Start counting again from this frame.
+            next_frame = now;
+            return;
+        }
+
+        PROFILE_ZONE("frame wait");
+        std::this_thread::sleep_until(next_frame);
+    }
+
+    void run_simulation(std::atomic<bool>& running, const box<2, int>& view_size, int start_ms) {
+        auto timestep = std::chrono::milliseconds(gameplay_timestep_ms);
+        auto next_tick = frame_clock::now() + timestep;
+        int begin_ms = start_ms;
+
+        while(running) {
+            int ticks = 0;
+            while(running && frame_clock::now() >= next_tick && ticks < max_catch_up_ticks) {
+                std::lock_guard<std::mutex> lk(simulation_lock);
+
+                int end_ms = begin_ms + static_cast<int>(gameplay_timestep_ms);
+                simulate(time(timestamp(end_ms), timestamp(begin_ms)), view_size);
+
+                begin_ms = end_ms;
+                next_tick += timestep;
+                ++ticks;
+            }
+
+            auto now = frame_clock::now();
+            if(next_tick <= now) {
+                // Too far behind to catch up. Slow the game down instead.
+                next_tick = now + timestep;
+            }
+
+            std::this_thread::sleep_until(next_tick);
+        }
+    }
+
     maybe<scoped_delegate> exit_delegate;
 
+protected:
+    // When set, gameplay updates run on their own thread at the fixed
+    // timestep, and the main thread only handles input and draws. Input
+    // handlers must queue their input for the simulation, and views must
+    // draw from published snapshots.
+    bool threaded_simulation = false;
+
+    // Frames drawn per second are limited to this when positive.
+    int max_frames_per_second = 0;
+
 public:
     virtual int run() override {
-        bool running = true;
+        std::atomic<bool> running(true);
 
         // Register core event handlers
         exit_delegate = eventbus.add_handler<events::exit>([this, &running](events::exit const&) {
@@ -181,63 +323,87 @@ public:
         sf::Clock total_clock;
         uint32_t gameplay_accumulator = 0;
 
+        auto frame_time = [&] {
+            return time(timestamp(total_clock.getElapsedTime().asMilliseconds()),
+                        timestamp(elapsed_clock.getElapsedTime().asMilliseconds()));
+        };
+
         auto view_size = get_view_size();
         views.resize(view_size);
         *texture_target = graphics::texture_render_target(view_size);
         *default_target = graphics::default_render_target(get_screen_size());
 
-        sf::Event event;
-        while(running) {
-            while(window.pollEvent(event)) {
-                switch(event.type) {
-                case sf::Event::Closed:
-                    eventbus.fire_event(events::exit());
-                    break;
-
-                case sf::Event::Resized: {
-                        auto new_view_size = get_view_size();
-                        if(new_view_size != view_size) {
-                            view_size = new_view_size;
-                            eventbus.fire_event(events::resized(view_size));
-                            *texture_target = graphics::texture_render_target(view_size);
-                            *default_target = graphics::default_render_target(get_screen_size());
-                            views.resize(view_size);
-                        }
-                    }
-                    break;
-
-                case sf::Event::TextEntered: {
-                        char ch = static_cast<char>(event.text.unicode);
-                        if(ch >= 0x20 && ch < 0x7F) {
-                            views.handle_text(time(timestamp(total_clock.getElapsedTime().asMilliseconds()), timestamp(elapsed_clock.getElapsedTime().asMilliseconds())), ch);
-                        }
-                    }
-                    break;
+        auto next_frame = frame_clock::now();
 
-                case sf::Event::GainedFocus:
-                    eventbus.fire_event(events::window_focus(true));
-                    break;
+        if(!threaded_simulation) {
+            while(running) {
+                poll_events(frame_time(), view_size);
 
-                case sf::Event::LostFocus:
-                    eventbus.fire_event(events::window_focus(false));
-                    break;
+                draw_views(frame_time(), view_size);
+                present();
 
-                default:
-                    // Silently consume unhandled events.
-                    break;
+                gameplay_accumulator += elapsed_clock.restart().asMilliseconds();
+                while(gameplay_accumulator >= gameplay_timestep_ms) {
+                    int begin_ms = total_clock.getElapsedTime().asMilliseconds();
+                    int end_ms = begin_ms + gameplay_timestep_ms;
+                    internal_update(time(timestamp(end_ms), timestamp(begin_ms)), view_size);
+                    gameplay_accumulator -= gameplay_timestep_ms;
                 }
+
+                end_frame();
+                pace_frame(next_frame);
             }
 
-            draw(time(timestamp(total_clock.getElapsedTime().asMilliseconds()), timestamp(elapsed_clock.getElapsedTime().asMilliseconds())), view_size);
+            return EXIT_SUCCESS;
+        }
+
+        // Threaded simulation. Input is sampled once per frame, over the time
+        // since the previous frame, and applied by the simulation at its next
+        // tick. Views must draw only from state the simulation publishes.
+        std::exception_ptr simulation_error;
+        std::thread simulation_thread([&] {
+            try {
+                run_simulation(running, view_size, total_clock.getElapsedTime().asMilliseconds());
+            }
+            catch(...) {
+                simulation_error = std::current_exception();
+                running = false;
+            }
+        });
+
+        try {
+            int last_input_ms = total_clock.getElapsedTime().asMilliseconds();
+            while(running) {
+                {
+                    std::lock_guard<std::mutex> lk(simulation_lock);
 
-            gameplay_accumulator += elapsed_clock.restart().asMilliseconds();
-            while(gameplay_accumulator >= gameplay_timestep_ms) {
-                int begin_ms = total_clock.getElapsedTime().asMilliseconds();
-                int end_ms = begin_ms + gameplay_timestep_ms;
-                internal_update(time(timestamp(end_ms), timestamp(begin_ms)), view_size);
-                gameplay_accumulator -= gameplay_timestep_ms;
+                    poll_events(frame_time(), view_size);
+
+                    int input_ms = total_clock.getElapsedTime().asMilliseconds();
+                    handle_input(time(timestamp(input_ms), timestamp(last_input_ms)), view_size);
+                    last_input_ms = input_ms;
+                }
+
+                // Drawing and waiting for vsync do not hold up the simulation.
+                draw_views(frame_time(), view_size);
+                present();
+
+                elapsed_clock.restart();
+                end_frame();
+                pace_frame(next_frame);
             }
         }
+        catch(...) {
+            running = false;
+            simulation_thread.join();
+            throw;
+        }
+
+        simulation_thread.join();
+
+        if(simulation_error) {
+            std::rethrow_exception(simulation_error);
+        }
 
         return EXIT_SUCCESS;
     }
@@ -1,5 +1,6 @@
 #include "sound_loader.hpp"
 #include "io/memory_file.hpp"
+#include "io/read_only_file.hpp"
 #include "libold/base/content/assets/sound.hpp"
 #include <cstdint>
 #include <vector>
@@ -8,6 +9,55 @@ gorc::fourcc const gorc::content::loaders::sound_loader::type = "WAV"_4CC;
 
 namespace {
     const std::vector<gorc::path> asset_root_path = {"sound", "voice"};
+
+    // Lets SFML decode directly from a seekable file
+    class sfml_file_stream : public sf::InputStream {
+    private:
+        gorc::read_only_file &file;
+
+    public:
+        explicit sfml_file_stream(gorc::read_only_file &file)
+            : file(file)
+        {
+            return;
+        }
+
+        virtual sf::Int64 read(void *data, sf::Int64 size) override
+        {
+            size_t total = 0;
+            char *dest = static_cast<char*>(data);
+            while(total < static_cast<size_t>(size) && !file.at_end()) {
+                size_t amt = file.read_some(dest + total, static_cast<size_t>(size) - total);
+                if(amt == 0) {
+                    break;
+                }
+
+                total += amt;
+            }
+
+            return static_cast<sf::Int64>(total);
+        }
+
+        virtual sf::Int64 seek(sf::Int64 position) override
+        {
+            if(position < 0 || static_cast<size_t>(position) > file.size()) {
+                return -1;
+            }
+
+            file.set_position(static_cast<size_t>(position));
+            return position;
+        }
+
+        virtual sf::Int64 tell() override
+        {
+            return static_cast<sf::Int64>(file.position());
+        }
+
+        virtual sf::Int64 getSize() override
+        {
+            return static_cast<sf::Int64>(file.size());
+        }
+    };
 }
 
 std::vector<gorc::path> const &gorc::content::loaders::sound_loader::get_prefixes() const
@@ -20,14 +70,21 @@ std::unique_ptr<gorc::asset>
                                                       content_manager &,
                                                       asset_id,
                                                       service_registry const &,
-                                                      std::string const &name) const
+                                                      std::string const &) const
 {
     std::unique_ptr<content::assets::sound> wav(new content::assets::sound());
 
-    memory_file wav_buf;
-    file.copy_to(wav_buf);
+    auto *seekable_file = dynamic_cast<read_only_file*>(&file);
+    if(seekable_file) {
+        sfml_file_stream stream(*seekable_file);
+        wav->buffer.loadFromStream(stream);
+    }
+    else {
+        memory_file wav_buf;
+        file.copy_to(wav_buf);
 
-    wav->buffer.loadFromMemory(wav_buf.data(), wav_buf.size());
+        wav->buffer.loadFromMemory(wav_buf.data(), wav_buf.size());
+    }
 
     return std::unique_ptr<asset>(std::move(wav));
 }
@@ -0,0 +1,186 @@
+#include "numeric_conversion.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace {
+
+struct decimal_literal {
+    bool negative = false;
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    bool exact = true;
+};
+
+// Decomposes a decimal literal into an integer mantissa and a power of ten.
+// Returns false when the literal is malformed. Sets exact to false when the
+// mantissa does not fit in 64 bits.
+bool decompose_decimal(char const* it, char const* last, decimal_literal& out) {
+    if(it != last && *it == '-') {
+        out.negative = true;
+        ++it;
+    }
+
+    bool any_digits = false;
+    auto accumulate = [&](char c) {
+        unsigned digit = static_cast<unsigned>(c - '0');
+        if(out.mantissa > (UINT64_MAX - digit) / 10U) {
+            out.exact = false;
+            return false;
+        }
+
+        out.mantissa = out.mantissa * 10U + digit;
+        return true;
+    };
+
+    for(; it != last && *it >= '0' && *it <= '9'; ++it) {
+        any_digits = true;
+        if(!accumulate(*it)) {
+            return true;
+        }
+    }
+
+    if(it != last && *it == '.') {
+        ++it;
+        for(; it != last && *it >= '0' && *it <= '9'; ++it) {
+            any_digits = true;
+            if(!accumulate(*it)) {
+                return true;
+            }
+
+            --out.exponent;
+        }
+    }
+
+    if(!any_digits) {
+        return false;
+    }
+
+    if(it != last && (*it == 'e' || *it == 'E')) {
+        ++it;
+
+        bool negative_exponent = false;
+        if(it != last && (*it == '+' || *it == '-')) {
+            negative_exponent = (*it == '-');
+            ++it;
+        }
+
+        if(it == last || *it < '0' || *it > '9') {
+            return false;
+        }
+
+        int exponent = 0;
+        for(; it != last && *it >= '0' && *it <= '9'; ++it) {
+            if(exponent < 100000) {
+                exponent = exponent * 10 + (*it - '0');
+            }
+        }
+
+        out.exponent += negative_exponent ? -exponent : exponent;
+    }
+
+    return it == last;
+}
+
+// Clinger's fast path: when the mantissa and the power of ten are both exactly
+// representable, a single correctly-rounded operation yields the same result
+// as a full conversion.
+bool convert_fast_path(decimal_literal const& lit, double& out) {
+    if(!lit.exact || lit.mantissa > (UINT64_C(1) << 53) || lit.exponent < -22 || lit.exponent > 22) {
+        return false;
+    }
+
+    static const double powers_of_ten[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    double value = static_cast<double>(lit.mantissa);
+    if(lit.exponent < 0) {
+        value /= powers_of_ten[-lit.exponent];
+    }
+    else {
+        value *= powers_of_ten[lit.exponent];
+    }
+
+    out = lit.negative ? -value : value;
+    return true;
+}
+
+bool convert_fast_path(decimal_literal const& lit, float& out) {
+    double value;
+    if(!convert_fast_path(lit, value)) {
+        return false;
+    }
+
+    // Narrowing the correctly-rounded double is only unsafe when it lands exactly
+    // halfway between two floats, where the original digits may lie on either side.
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint64_t const float_discarded_bits = (UINT64_C(1) << 29) - 1;
+    if((bits & float_discarded_bits) == (UINT64_C(1) << 28)) {
+        return false;
+    }
+
+    out = static_cast<float>(value);
+    return true;
+}
+
+void convert_c_string(char const* str, char** end, float& out) {
+    out = std::strtof(str, end);
+}
+
+void convert_c_string(char const* str, char** end, double& out) {
+    out = std::strtod(str, end);
+}
+
+template <typename T> bool convert_slow_path(char const* first, char const* last, T& out) {
+    std::string str(first, last);
+    char* end = nullptr;
+    T value;
+    convert_c_string(str.c_str(), &end, value);
+    if(end != str.c_str() + str.size() || std::isinf(value)) {
+        return false;
+    }
+
+    out = value;
+    return true;
+}
+
+// Hexadecimal literals are rarely read into floating point values. Defer to the
+// stream extraction so their interpretation is unchanged.
+template <typename T> bool convert_stream(char const* first, char const* last, T& out) {
+    std::stringstream ss(std::string(first, last));
+    return !(ss >> std::hex >> out).fail();
+}
+
+template <typename T> bool convert(gorc::text::token_type type,
+                                   char const* first,
+                                   char const* last,
+                                   T& out) {
+    if(type == gorc::text::token_type::hex_integer) {
+        return convert_stream(first, last, out);
+    }
+    else if(type != gorc::text::token_type::integer && type != gorc::text::token_type::floating) {
+        return false;
+    }
+
+    decimal_literal lit;
+    if(!decompose_decimal(first, last, lit)) {
+        return false;
+    }
+
+    return convert_fast_path(lit, out) ||
+           convert_slow_path(first, last, out);
+}
+
+}
+
+bool gorc::text::convert_floating(token_type type, char const* first, char const* last, float& out) {
+    return convert(type, first, last, out);
+}
+
+bool gorc::text::convert_floating(token_type type, char const* first, char const* last, double& out) {
+    return convert(type, first, last, out);
+}
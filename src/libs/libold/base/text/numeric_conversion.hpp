@@ -0,0 +1,102 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+#include "token_type.hpp"
+
+namespace gorc {
+namespace text {
+
+// Converts the text of a numeric token directly from its characters, without
+// constructing an intermediate string. Semantics match formatted extraction
+// from a std::stringstream: integer targets read the leading integer part of
+// floating tokens, and hexadecimal tokens are read in base 16.
+
+bool convert_floating(token_type type, char const* first, char const* last, float& out);
+bool convert_floating(token_type type, char const* first, char const* last, double& out);
+
+inline int hex_digit_value(char c) {
+    if(c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    else if(c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    else if(c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type
+    convert_numeric(token_type type, char const* first, char const* last, T& out) {
+    using magnitude_type = typename std::make_unsigned<T>::type;
+
+    unsigned base;
+    if(type == token_type::integer || type == token_type::floating) {
+        base = 10;
+    }
+    else if(type == token_type::hex_integer) {
+        base = 16;
+    }
+    else {
+        return false;
+    }
+
+    char const* it = first;
+    bool negative = false;
+    if(it != last && *it == '-') {
+        negative = true;
+        ++it;
+    }
+
+    if(base == 16 && (last - it) >= 2 && it[0] == '0' && (it[1] == 'x' || it[1] == 'X')) {
+        it += 2;
+    }
+
+    magnitude_type const max_magnitude = std::numeric_limits<magnitude_type>::max();
+    magnitude_type magnitude = 0;
+    bool any_digits = false;
+    for(; it != last; ++it) {
+        int digit = (base == 16) ? hex_digit_value(*it) : ((*it >= '0' && *it <= '9') ? (*it - '0') : -1);
+        if(digit < 0) {
+            break;
+        }
+
+        if(magnitude > (max_magnitude - static_cast<magnitude_type>(digit)) / base) {
+            return false;
+        }
+
+        magnitude = static_cast<magnitude_type>(magnitude * base + static_cast<magnitude_type>(digit));
+        any_digits = true;
+    }
+
+    if(!any_digits) {
+        // Floating literals may omit their integer part (e.g. ".5"), which reads as zero.
+        if(type != token_type::floating || it == last || *it != '.') {
+            return false;
+        }
+    }
+
+    if(std::is_signed<T>::value) {
+        magnitude_type const limit = static_cast<magnitude_type>(std::numeric_limits<T>::max()) +
+                                     (negative ? 1U : 0U);
+        if(magnitude > limit) {
+            return false;
+        }
+    }
+
+    out = static_cast<T>(negative ? static_cast<magnitude_type>(0U - magnitude) : magnitude);
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    convert_numeric(token_type type, char const* first, char const* last, T& out) {
+    return convert_floating(type, first, last, out);
+}
+
+}
+}
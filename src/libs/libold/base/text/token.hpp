@@ -1,25 +1,28 @@
 #pragma once
 
 #include <string>
-#include <sstream>
 #include "log/diagnostic_context_location.hpp"
 #include "libold/base/text/exception.hpp"
+#include "libold/base/text/numeric_conversion.hpp"
+#include "libold/base/text/token_type.hpp"
 #include "log/log.hpp"
+#include "utility/string_view.hpp"
 
 namespace gorc {
 namespace text {
 
-enum class token_type {
-    invalid,
-    end_of_file,
-    end_of_line,
-    identifier,
-    hex_integer,
-    integer,
-    floating,
-    string,
-    punctuator,
-};
+template <typename T> T numeric_value_or_fatal(token_type type,
+                                               string_view value,
+                                               diagnostic_context_location const& location) {
+    T result = T(0);
+    if(!convert_numeric(type, value.begin(), value.end(), result)) {
+        diagnostic_context dc(location);
+        LOG_FATAL(format("invalid numeric conversion: expected number, found '%s'") %
+                  std::string(value.begin(), value.end()));
+    }
+
+    return result;
+}
 
 class token {
 public:
@@ -31,25 +34,20 @@ public:
     token(token_type type, const std::string& value, const diagnostic_context_location& location);
 
     template <typename T> T get_numeric_value() {
-        bool formatSuccess = false;
-        T result = T(0);
-
-        std::stringstream ss(value);
-
-        if(type == token_type::integer || type == token_type::floating) {
-            formatSuccess = !(ss >> result).fail();
-        }
-        else if(type == token_type::hex_integer) {
-            formatSuccess = !(ss >> std::hex >> result).fail();
-        }
+        return numeric_value_or_fatal<T>(type, string_view(value.data(), value.size()), location);
+    }
+};
 
-        if(!formatSuccess) {
-            diagnostic_context dc(location);
-            LOG_FATAL(format("invalid numeric conversion: expected number, found '%s'") %
-                      value);
-        }
+// A token whose value refers directly into the tokenizer's input buffer.
+// The value is only valid until the next token is read.
+class token_view {
+public:
+    token_type type = token_type::invalid;
+    string_view value;
+    diagnostic_context_location location;
 
-        return result;
+    template <typename T> T get_numeric_value() const {
+        return numeric_value_or_fatal<T>(type, value, location);
     }
 };
 
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace gorc {
+namespace text {
+
+enum class token_type {
+    invalid,
+    end_of_file,
+    end_of_line,
+    identifier,
+    hex_integer,
+    integer,
+    floating,
+    string,
+    punctuator,
+};
+
+}
+}
@@ -1,176 +1,258 @@
 #include "log/log.hpp"
 #include "tokenizer.hpp"
-#include <boost/algorithm/string.hpp>
+#include "utility/string_search.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 using namespace gorc::text;
 
-char tokenizer::buffer_get_next() {
-    while(!buffer.at_end()) {
-        char ch;
-        auto amt = buffer.read_some(&ch, sizeof(char));
-        if(amt == sizeof(char)) {
-            return ch;
+namespace {
+
+enum char_class : uint8_t {
+    space_class = 1 << 0,
+    identifier_lead_class = 1 << 1,
+    identifier_class = 1 << 2,
+    digit_class = 1 << 3,
+    hex_digit_class = 1 << 4,
+    punctuator_class = 1 << 5
+};
+
+// Character classification follows the C locale. Characters outside of the
+// ASCII range belong to no class.
+class char_class_table {
+private:
+    uint8_t classes[256];
+
+public:
+    char_class_table() {
+        for(int c = 0; c < 256; ++c) {
+            uint8_t cls = 0;
+            if(c < 128) {
+                cls |= isspace(c) ? space_class : 0;
+                cls |= (isalpha(c) || c == '_') ? identifier_lead_class : 0;
+                cls |= (isalnum(c) || c == '_') ? identifier_class : 0;
+                cls |= isdigit(c) ? digit_class : 0;
+                cls |= isxdigit(c) ? hex_digit_class : 0;
+                cls |= ispunct(c) ? punctuator_class : 0;
+            }
+
+            classes[c] = cls;
         }
     }
 
-    return '\0';
-}
-
-void tokenizer::scan() {
-    ++col;
-
-    if(current == '\n') {
-        ++line;
-        col = 1;
+    inline bool is(char c, char_class cls) const {
+        return (classes[static_cast<unsigned char>(c)] & cls) != 0;
     }
+};
 
-    current = next;
-    next = buffer_get_next();
+const char_class_table char_classes;
+
+inline bool isIdentifierLead(char c) {
+    return char_classes.is(c, identifier_lead_class);
 }
 
-bool tokenizer::skipWhitespaceStep() {
-    if(current == '\0') {
-        // EOF in a block of whitespace
-        return false;
-    }
-    else if(report_eol && current == '\n') {
-        return false;
-    }
-    else if(isspace(current)) {
-        scan();
-        return true;
-    }
-    else if(current == '#') {
-        // Line comment, skip to eol.
-        skip_to_next_line();
-        return true;
-    }
-    else {
-        return false;
-    }
+inline bool isDigit(char c) {
+    return char_classes.is(c, digit_class);
 }
 
-void tokenizer::skipWhitespace() {
-    while(skipWhitespaceStep()) {
-        // Repeatedly call skipWhitespaceStep() until it returns false.
-        // Returning false indicates no more whitespace to skip.
+template <char_class cls> char const* skip_class(char const* it, char const* last) {
+    while(it != last && char_classes.is(*it, cls)) {
+        ++it;
     }
 
-    return;
+    return it;
 }
 
-bool tokenizer::isIdentifierLead(char c) {
-    return isalpha(c) || (c == '_');
-}
+// Returns the first character in the range that is not a space, tab, or
+// carriage return. These are the only whitespace characters that appear in
+// long runs in column-aligned text assets.
+char const* skip_blanks(char const* it, char const* last) {
+#if defined(__SSE2__)
+    __m128i const space = _mm_set1_epi8(' ');
+    __m128i const tab = _mm_set1_epi8('\t');
+    __m128i const cr = _mm_set1_epi8('\r');
+
+    while(last - it >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(it));
+        __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space),
+                                                  _mm_cmpeq_epi8(chunk, tab)),
+                                     _mm_cmpeq_epi8(chunk, cr));
+        unsigned non_blank = ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xFFFFU;
+        if(non_blank != 0) {
+            return it + __builtin_ctz(non_blank);
+        }
 
-bool tokenizer::isIdentifierChar(char c) {
-    return isalnum(c) || (c == '_');
-}
+        it += 16;
+    }
+#endif
 
-void tokenizer::readNumericLiteralHexPart(token& out) {
-    while(isxdigit(current)) {
-        out.value.push_back(current);
-        scan();
+    while(it != last && (*it == ' ' || *it == '\t' || *it == '\r')) {
+        ++it;
     }
+
+    return it;
 }
 
-void tokenizer::readNumericLiteralIntegerPart(token& out) {
-    while(isdigit(current)) {
-        out.value.push_back(current);
-        scan();
-    }
 }
 
-void tokenizer::readNumericLiteral(token& out) {
-    // Check for sign:
-    if(current == '-') {
-        out.value.push_back(current);
-        scan();
-    }
+void tokenizer::set_input(char const* first, char const* end) {
+    // The original stream-based tokenizer treated a null character as the end of input.
+    cursor = first;
+    last = end;
 
-    if(current == '0' && (next == 'x' || next == 'X')) {
-        out.type = token_type::hex_integer;
+    if(first != end) {
+        auto null_char = static_cast<char const*>(memchr(first, '\0', static_cast<size_t>(end - first)));
+        if(null_char) {
+            last = null_char;
+        }
+    }
+}
 
-        out.value.push_back(current);
-        out.value.push_back(next);
+void tokenizer::scan() {
+    ++col;
 
-        scan();
-        scan();
+    if(cursor < last) {
+        if(*cursor == '\n') {
+            ++line;
+            col = 1;
+        }
 
-        readNumericLiteralHexPart(out);
-        return;
+        ++cursor;
     }
+}
 
-    out.type = token_type::integer;
+void tokenizer::scan_to(char const* new_cursor) {
+    // Only valid when the skipped characters do not contain a newline.
+    col += static_cast<int>(new_cursor - cursor);
+    cursor = new_cursor;
+}
 
-    readNumericLiteralIntegerPart(out);
+void tokenizer::skipWhitespace() {
+    while(cursor < last) {
+        scan_to(skip_blanks(cursor, last));
 
-    if(current == '.' && isdigit(next)) {
-        if(out.value.empty() || !isdigit(out.value.back())) {
-            // Poorly formatted floating point number. Prepend 0.
-            out.value.push_back('0');
+        if(cursor == last) {
+            // EOF in a block of whitespace
+            return;
         }
+        else if(*cursor == '\n') {
+            if(report_eol) {
+                return;
+            }
 
-        out.value.push_back(current);
-        scan();
+            scan();
+        }
+        else if(*cursor == '#') {
+            // Line comment, skip to eol.
+            skip_to_next_line();
+        }
+        else if(char_classes.is(*cursor, space_class)) {
+            scan();
+        }
+        else {
+            return;
+        }
+    }
+}
 
-        readNumericLiteralIntegerPart(out);
+void tokenizer::readNumericLiteral(token_view& out) {
+    char const* first = cursor;
+    char const* it = cursor;
 
-        out.type = token_type::floating;
+    // Check for sign:
+    if(*it == '-') {
+        ++it;
     }
 
-    if(current == 'e' || current == 'E') {
-        out.value.push_back(current);
-        scan();
+    if(it + 1 < last && it[0] == '0' && (it[1] == 'x' || it[1] == 'X')) {
+        out.type = token_type::hex_integer;
+        it = skip_class<hex_digit_class>(it + 2, last);
+    }
+    else {
+        out.type = token_type::integer;
+        it = skip_class<digit_class>(it, last);
 
-        if(current == '+' || current == '-') {
-            out.value.push_back(current);
-            scan();
+        if(it + 1 < last && *it == '.' && isDigit(it[1])) {
+            it = skip_class<digit_class>(it + 1, last);
+            out.type = token_type::floating;
         }
 
-        readNumericLiteralIntegerPart(out);
-        out.type = token_type::floating;
+        if(it < last && (*it == 'e' || *it == 'E')) {
+            ++it;
+
+            if(it < last && (*it == '+' || *it == '-')) {
+                ++it;
+            }
+
+            it = skip_class<digit_class>(it, last);
+            out.type = token_type::floating;
+        }
     }
+
+    scan_to(it);
+    out.value = string_view(first, cursor);
 }
 
-void tokenizer::readIdentifier(token& out) {
-    if(isIdentifierLead(current)) {
-        // Valid identifier
-        out.type = token_type::identifier;
+void tokenizer::readIdentifier(token_view& out) {
+    char const* first = cursor;
+    out.type = token_type::identifier;
+    scan_to(skip_class<identifier_class>(cursor + 1, last));
+    out.value = string_view(first, cursor);
+}
 
-        do {
-            out.value.push_back(current);
-            scan();
-        } while(isIdentifierChar(current));
+void tokenizer::readStringLiteral(token_view& out) {
+    // Fast path: a literal without escape sequences refers directly into the input.
+    char const* first = cursor + 1;
+    for(char const* it = first; it < last; ++it) {
+        if(*it == '\"') {
+            out.type = token_type::string;
+            out.value = string_view(first, it);
+            scan_to(it + 1);
+            return;
+        }
+        else if(*it == '\\' || *it == '\n') {
+            break;
+        }
     }
+
+    readEscapedStringLiteral(out);
 }
 
-void tokenizer::readStringLiteral(token& out) {
+void tokenizer::readEscapedStringLiteral(token_view& out) {
+    scratch.clear();
+
     while(true) {
         scan();
 
-        if(current == '\0') {
+        char c = current();
+        if(c == '\0') {
             out.location.last_line = line;
             out.location.last_col = col;
             diagnostic_context dc(nullptr, line, col);
             LOG_FATAL("unexpected end of file in string literal");
         }
-        else if(current == '\n') {
+        else if(c == '\n') {
             out.location.last_line = line;
             out.location.last_col = col;
             diagnostic_context dc(nullptr, line, col);
             LOG_FATAL("unexpected newline in string literal");
         }
-        else if(current == '\"') {
+        else if(c == '\"') {
             out.type = token_type::string;
+            out.value = string_view(scratch.data(), scratch.size());
             scan();
             return;
         }
-        else if(current == '\\') {
+        else if(c == '\\') {
             // Escape sequence.
             scan();
 
-            switch(current) {
+            switch(current()) {
             case '\n':
                 // Escaped newline
                 break;
@@ -178,75 +260,64 @@ void tokenizer::readStringLiteral(token& out) {
             case '\'':
             case '\"':
             case '\\':
-                out.value.push_back(current);
+                scratch.push_back(current());
                 break;
 
             case 'n':
-                out.value.push_back('\n');
+                scratch.push_back('\n');
                 break;
 
             case 't':
-                out.value.push_back('\t');
+                scratch.push_back('\t');
                 break;
 
             default:
                 out.type = token_type::invalid;
+                out.value = string_view(scratch.data(), scratch.size());
                 return;
             }
         }
         else {
-            out.value.push_back(current);
+            scratch.push_back(c);
         }
     }
 }
 
-tokenizer::tokenizer(input_stream& stream)
-    : buffer(stream), report_eol(false) {
-    line = 1;
-    col = 1;
-    current = buffer_get_next();
-    next = buffer_get_next();
-}
-
-void tokenizer::skip_to_next_line() {
-    while(current != '\n' && current != '\0') {
-        scan();
-    }
-}
-
-void tokenizer::get_token(token& out) {
+void tokenizer::read_token(token_view& out) {
     skipWhitespace();
 
-    out.value.clear();
+    out.value = string_view(cursor, size_t(0));
     out.location.first_line = line;
     out.location.first_col = col;
 
-    if(current == '\0') {
+    char c = current();
+    if(c == '\0') {
         // Stream has reached end of file.
         out.type = token_type::end_of_file;
     }
-    else if(current == '\n') {
+    else if(c == '\n') {
         out.type = token_type::end_of_line;
         scan();
     }
-    else if(current == '\"') {
+    else if(c == '\"') {
         readStringLiteral(out);
     }
-    else if(isIdentifierLead(current)) {
+    else if(isIdentifierLead(c)) {
         readIdentifier(out);
     }
-    else if(isdigit(current)) {
+    else if(isDigit(c)) {
         readNumericLiteral(out);
     }
-    else if(ispunct(current)) {
-        if(current == '-' && (next == '.' || isdigit(next))) {
+    else if(char_classes.is(c, punctuator_class)) {
+        char n = next();
+        if(c == '-' && (n == '.' || isDigit(n))) {
             readNumericLiteral(out);
         }
-        else if(current == '.' && isdigit(next)) {
+        else if(c == '.' && isDigit(n)) {
             readNumericLiteral(out);
         }
         else {
-            out.value.push_back(current);
+            out.value = string_view(cursor, 1);
             out.type = token_type::punctuator;
             scan();
         }
@@ -259,72 +330,141 @@ void tokenizer::get_token(token& out) {
     out.location.last_col = col;
 }
 
-void tokenizer::get_delimited_string(token& out, const std::function<bool(char)>& match_delim) {
+template <typename PredT> void tokenizer::read_delimited_string(token_view& out, PredT const& match_delim) {
     skipWhitespace();
 
-    out.value.clear();
+    char const* first = cursor;
     out.location.first_line = line;
     out.location.first_col = col;
 
-    while(!match_delim(current)) {
-        out.value.push_back(current);
+    while(cursor < last && !match_delim(*cursor)) {
         scan();
     }
 
     out.type = token_type::string;
+    out.value = string_view(first, cursor);
     out.location.last_line = line;
     out.location.last_col = col;
+}
+
+tokenizer::tokenizer(input_stream& stream)
+    : report_eol(false) {
+    static constexpr size_t block_size = 64 * 1024;
+
+    size_t used = 0;
+    while(!stream.at_end()) {
+        storage.resize(used + block_size);
+        used += stream.read_some(storage.data() + used, block_size);
+    }
+
+    storage.resize(used);
+
+    line = 1;
+    col = 1;
+    set_input(storage.data(), storage.data() + storage.size());
+}
+
+tokenizer::tokenizer(span<char const> data)
+    : report_eol(false) {
+    line = 1;
+    col = 1;
+    set_input(data.data(), data.data() + data.size());
+}
+
+void tokenizer::skip_to_next_line() {
+    if(cursor == last) {
+        return;
+    }
+
+    auto eol = static_cast<char const*>(memchr(cursor, '\n', static_cast<size_t>(last - cursor)));
+    scan_to(eol ? eol : last);
+}
+
+void tokenizer::get_token(token& out) {
+    token_view view;
+    read_token(view);
+
+    out.type = view.type;
+    out.value.assign(view.value.begin(), view.value.end());
+    out.location = view.location;
+
+    if(view.type == token_type::floating) {
+        // Floating literals without an integer part are reported with a leading zero.
+        size_t digits_begin = (out.value.front() == '-') ? 1 : 0;
+        if(out.value[digits_begin] == '.') {
+            out.value.insert(digits_begin, 1, '0');
+        }
+    }
+}
+
+void tokenizer::get_delimited_string(token& out, const std::function<bool(char)>& match_delim) {
+    token_view view;
+    read_delimited_string(view, match_delim);
+
+    out.type = view.type;
+    out.value.assign(view.value.begin(), view.value.end());
+    out.location = view.location;
+}
 
-    return;
+token_view const& tokenizer::get_token_view() {
+    read_token(internalToken);
+    return internalToken;
 }
 
 std::string& tokenizer::get_identifier() {
-    get_token(internalToken);
+    read_token(internalToken);
 
     if(internalToken.type != token_type::identifier) {
         diagnostic_context dc(nullptr, internalToken.location.first_line, internalToken.location.first_col);
         LOG_FATAL("expected identifier");
     }
 
-    return internalToken.value;
+    internalValue.assign(internalToken.value.begin(), internalToken.value.end());
+    return internalValue;
 }
 
 std::string& tokenizer::get_string_literal() {
-    get_token(internalToken);
+    read_token(internalToken);
 
     if(internalToken.type != token_type::string) {
         diagnostic_context dc(nullptr, internalToken.location.first_line, internalToken.location.first_col);
         LOG_FATAL("expected string literal");
     }
 
-    return internalToken.value;
+    internalValue.assign(internalToken.value.begin(), internalToken.value.end());
+    return internalValue;
 }
 
 std::string& tokenizer::get_space_delimited_string() {
-    get_delimited_string(internalToken, [](char c) { return isspace(c); });
+    read_delimited_string(internalToken, [](char c) { return char_classes.is(c, space_class); });
     if(internalToken.value.empty()) {
         diagnostic_context dc(nullptr, internalToken.location.first_line, internalToken.location.first_col);
         LOG_FATAL("expected string fragment");
     }
 
-    return internalToken.value;
+    internalValue.assign(internalToken.value.begin(), internalToken.value.end());
+    return internalValue;
 }
 
 void tokenizer::assert_identifier(const std::string& id) {
-    get_token(internalToken);
+    read_token(internalToken);
 
-    if(internalToken.type != token_type::identifier || !boost::iequals(internalToken.value, id)) {
+    if(internalToken.type != token_type::identifier || !iequal(internalToken.value, id)) {
         diagnostic_context dc(nullptr, internalToken.location.first_line, internalToken.location.first_col);
-        LOG_FATAL(format("expected '%s', found '%s'") % id % internalToken.value);
+        LOG_FATAL(format("expected '%s', found '%s'") % id %
+                  std::string(internalToken.value.begin(), internalToken.value.end()));
     }
 }
 
 void tokenizer::assert_punctuator(const std::string& punc) {
-    get_token(internalToken);
+    read_token(internalToken);
 
-    if(internalToken.type != token_type::punctuator || internalToken.value != punc) {
+    if(internalToken.type != token_type::punctuator ||
+       internalToken.value.size() != punc.size() ||
+       !std::equal(punc.begin(), punc.end(), internalToken.value.begin())) {
         diagnostic_context dc(nullptr, internalToken.location.first_line, internalToken.location.first_col);
-        LOG_FATAL(format("expected '%s', found '%s'") % punc % internalToken.value);
+        LOG_FATAL(format("expected '%s', found '%s'") % punc %
+                  std::string(internalToken.value.begin(), internalToken.value.end()));
     }
 }
 
@@ -334,7 +474,7 @@ void tokenizer::assert_label(const std::string& label) {
 }
 
 void tokenizer::assert_end_of_file() {
-    get_token(internalToken);
+    read_token(internalToken);
     if(internalToken.type != token_type::end_of_file) {
         LOG_FATAL("expected end of file");
     }
@@ -1,42 +1,86 @@
 #pragma once
 
 #include <string>
-#include <sstream>
+#include <vector>
 #include <functional>
 #include "io/input_stream.hpp"
 #include "token.hpp"
 #include "log/diagnostic_context_location.hpp"
+#include "utility/span.hpp"
 
 namespace gorc {
 namespace text {
 
 class tokenizer {
 private:
-    char current, next;
-    input_stream& buffer;
-    diagnostic_context_location loc;
+    // Input is held contiguously so tokens can refer directly into it.
+    // When constructed from a stream, the tokenizer owns a copy of the stream
+    // contents, read in large blocks. When constructed from a span, the caller
+    // must keep the memory alive for the lifetime of the tokenizer.
+    std::vector<char> storage;
+    char const* cursor;
+    char const* last;
+
     int line, col;
-    token internalToken;
     bool report_eol;
 
-    inline char buffer_get_next();
+    token_view internalToken;
+    std::string internalValue;
+    std::string scratch;
+
+    void set_input(char const* first, char const* end);
+
+    inline char current() const {
+        return (cursor < last) ? *cursor : '\0';
+    }
+
+    inline char next() const {
+        return (cursor + 1 < last) ? cursor[1] : '\0';
+    }
 
     inline void scan();
+    inline void scan_to(char const* new_cursor);
 
-    inline bool skipWhitespaceStep();
     inline void skipWhitespace();
 
-    inline bool isIdentifierLead(char c);
-    inline bool isIdentifierChar(char c);
+    void readNumericLiteral(token_view& out);
+    void readIdentifier(token_view& out);
+    void readStringLiteral(token_view& out);
+    void readEscapedStringLiteral(token_view& out);
 
-    void readNumericLiteralHexPart(token& out);
-    void readNumericLiteralIntegerPart(token& out);
-    void readNumericLiteral(token& out);
-    void readIdentifier(token& out);
-    void readStringLiteral(token& out);
+    void read_token(token_view& out);
+
+    template <typename PredT> void read_delimited_string(token_view& out, PredT const& match_delim);
 
 public:
     tokenizer(input_stream& stream);
+    explicit tokenizer(span<char const> data);
+
+    tokenizer(tokenizer const&) = delete;
+    tokenizer& operator=(tokenizer const&) = delete;
+
+    // Read position within the input. Restoring a saved position rewinds the
+    // tokenizer so a section can be scanned more than once.
+    class position {
+        friend class tokenizer;
+    private:
+        char const* cursor;
+        int line, col;
+    };
+
+    inline position get_position() const {
+        position rv;
+        rv.cursor = cursor;
+        rv.line = line;
+        rv.col = col;
+        return rv;
+    }
+
+    inline void set_position(position const& pos) {
+        cursor = pos.cursor;
+        line = pos.line;
+        col = pos.col;
+    }
 
     void skip_to_next_line();
 
@@ -51,8 +95,12 @@ public:
     void get_token(token& out);
     void get_delimited_string(token& out, const std::function<bool(char)>& match_delim);
 
+    // Returns the next token without copying its value out of the input buffer.
+    // The returned token is only valid until the next call to the tokenizer.
+    token_view const& get_token_view();
+
     template <typename T> T get_number() {
-        get_token(internalToken);
+        read_token(internalToken);
         return internalToken.get_numeric_value<T>();
     }
 
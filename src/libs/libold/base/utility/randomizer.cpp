@@ -4,3 +4,8 @@ gorc::utility::randomizer::randomizer() {
     std::random_device rd;
     rng.seed(rd());
 }
+
+gorc::utility::randomizer::randomizer(unsigned int seed)
+    : rng(seed) {
+    return;
+}
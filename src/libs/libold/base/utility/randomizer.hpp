@@ -11,6 +11,11 @@ private:
 
 public:
     randomizer();
+    explicit randomizer(unsigned int seed);
+
+    inline void seed(unsigned int value) {
+        rng.seed(value);
+    }
 
     inline operator double() {
         return std::generate_canonical<double, 10>(rng);
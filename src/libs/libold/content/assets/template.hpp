@@ -29,12 +29,9 @@ class content_manager;
 namespace content {
 namespace assets {
 
-class thing_template {
+// Thing fields which rarely change during simulation.
+class thing_properties {
 public:
-    // General fields
-    sector_id sector;
-    vector<3> position;
-
     flag_set<flags::actor_flag> actor_flags;
     vector<3> ang_vel;
     flag_set<flags::attach_flag> attach_flags;
@@ -45,7 +42,6 @@ public:
     flag_set<flags::damage_flag> damage_class;
     maybe<thing_template_id> explode = nothing;
     vector<3> eye_offset;
-    flag_set<flags::thing_flag> flags;
     maybe<thing_template_id> flesh_hit = nothing;
     std::vector<std::tuple<vector<3>, vector<3>>> frames;
     float head_pitch = 0.0f;
@@ -66,20 +62,28 @@ public:
     float min_damage = 0.0f;
     float min_head_pitch = -80.0f;
     maybe<asset_ref<model>> model_3d;
-    flags::move_type move = flags::move_type::none;
-    float move_size = 0.05f;
-    quaternion<float> orient;
     flag_set<flags::physics_flag> physics_flags;
     maybe<asset_ref<puppet>> pup;
     vector<3> rot_thrust;
     float size = 0.05f;
     maybe<asset_ref<soundclass>> sound_class;
     maybe<asset_ref<sprite>> spr;
-    vector<3> thrust;
     float timer = 0.0f;
     flags::thing_type type = flags::thing_type::ghost;
     int type_flags = 0x0;
+};
+
+class thing_template : public thing_properties {
+public:
+    // Simulation state, updated by most per-frame loops over things.
+    sector_id sector;
+    vector<3> position;
+    quaternion<float> orient;
     vector<3> vel;
+    vector<3> thrust;
+    float move_size = 0.05f;
+    flags::move_type move = flags::move_type::none;
+    flag_set<flags::thing_flag> flags;
 
     void parse_args(text::tokenizer& tok, content_manager& manager, service_registry const &services,
             const std::unordered_map<std::string, thing_template_id>& templates);
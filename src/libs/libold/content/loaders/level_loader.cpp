@@ -1,4 +1,5 @@
 #include "log/log.hpp"
+#include "log/log_buffer.hpp"
 #include "level_loader.hpp"
 #include "libold/content/assets/level.hpp"
 #include "content/content_manager.hpp"
@@ -350,12 +351,49 @@ void ParseSectorsSection(assets::level& lev, text::tokenizer& tok, content_manag
     }
 }
 
+void PreloadCogScripts(text::tokenizer& tok, content_manager& manager) {
+    // Scripts do not depend on other assets, so every script named in the
+    // section can be compiled concurrently before the entries are parsed.
+    // Malformed entries end the scan; the parser below reports them.
+    auto start = tok.get_position();
+    std::vector<std::string> script_names;
+
+    log_buffer scan_log;
+    try {
+        scoped_log_capture capture(scan_log);
+
+        text::token t;
+        while(true) {
+            tok.get_token(t);
+            if(t.type != text::token_type::integer) {
+                break;
+            }
+
+            tok.get_token(t);
+            if(t.type != text::token_type::punctuator || t.value != ":") {
+                break;
+            }
+
+            script_names.push_back(tok.get_space_delimited_string());
+            tok.skip_to_next_line();
+        }
+    }
+    catch(...) {
+        // Parse errors are reported by ParseCogsSection.
+    }
+
+    tok.set_position(start);
+    manager.preload<cog::script>(script_names);
+}
+
 void ParseCogsSection(assets::level& lev, text::tokenizer& tok, content_manager& manager, service_registry const &) {
     tok.assert_identifier("world");
     tok.assert_identifier("Cogs");
 
     size_t num = tok.get_number<size_t>();
 
+    PreloadCogScripts(tok, manager);
+
     text::token t;
     while(true) {
         tok.get_token(t);
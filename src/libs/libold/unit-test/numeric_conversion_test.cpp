@@ -0,0 +1,136 @@
+#include "test/test.hpp"
+#include "libold/base/text/numeric_conversion.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+using namespace gorc;
+using namespace gorc::text;
+
+namespace {
+    template <typename T>
+    bool convert(token_type type, std::string const &str, T &out)
+    {
+        return convert_numeric(type, str.data(), str.data() + str.size(), out);
+    }
+
+    template <typename T>
+    T converted(token_type type, std::string const &str)
+    {
+        T rv = T(0);
+        if(!convert(type, str, rv)) {
+            throw std::runtime_error("conversion failed: " + str);
+        }
+
+        return rv;
+    }
+
+    template <typename T>
+    bool rejects(token_type type, std::string const &str)
+    {
+        T value = T(0);
+        return !convert(type, str, value);
+    }
+}
+
+begin_suite(numeric_conversion_test);
+
+test_case(decimal_integers)
+{
+    assert_eq(converted<int>(token_type::integer, "0"), 0);
+    assert_eq(converted<int>(token_type::integer, "42"), 42);
+    assert_eq(converted<int>(token_type::integer, "-17"), -17);
+    assert_eq(converted<int>(token_type::integer, "007"), 7);
+}
+
+test_case(hex_integers)
+{
+    assert_eq(converted<int>(token_type::hex_integer, "0x1F"), 31);
+    assert_eq(converted<int>(token_type::hex_integer, "0XfF"), 255);
+    assert_eq(converted<int>(token_type::hex_integer, "-0x10"), -16);
+    assert_eq(converted<unsigned>(token_type::hex_integer, "0xFFFFFFFF"), 0xFFFFFFFFU);
+}
+
+test_case(integer_part_of_floating_token)
+{
+    assert_eq(converted<int>(token_type::floating, "3.75"), 3);
+    assert_eq(converted<int>(token_type::floating, "-2.5"), -2);
+    assert_eq(converted<int>(token_type::floating, ".5"), 0);
+}
+
+test_case(integer_limits)
+{
+    assert_eq(converted<int32_t>(token_type::integer, "2147483647"), INT32_MAX);
+    assert_eq(converted<int32_t>(token_type::integer, "-2147483648"), INT32_MIN);
+    assert_eq(converted<uint8_t>(token_type::integer, "255"), uint8_t(255));
+    assert_eq(converted<int32_t>(token_type::hex_integer, "-0x80000000"), INT32_MIN);
+}
+
+test_case(integer_overflow)
+{
+    assert_true(rejects<int32_t>(token_type::integer, "2147483648"));
+    assert_true(rejects<int32_t>(token_type::integer, "-2147483649"));
+    assert_true(rejects<uint8_t>(token_type::integer, "256"));
+    assert_true(rejects<int32_t>(token_type::hex_integer, "0x80000000"));
+    assert_true(rejects<uint64_t>(token_type::integer, "18446744073709551616"));
+}
+
+test_case(malformed_integers)
+{
+    assert_true(rejects<int>(token_type::integer, ""));
+    assert_true(rejects<int>(token_type::integer, "-"));
+    assert_true(rejects<int>(token_type::hex_integer, "0x"));
+    assert_true(rejects<int>(token_type::floating, "-e5"));
+    assert_true(rejects<int>(token_type::identifier, "abc"));
+    assert_true(rejects<int>(token_type::string, "12"));
+}
+
+test_case(floating)
+{
+    assert_eq(converted<float>(token_type::floating, "1.5"), 1.5f);
+    assert_eq(converted<float>(token_type::floating, "-0.25"), -0.25f);
+    assert_eq(converted<float>(token_type::floating, ".5"), 0.5f);
+    assert_eq(converted<float>(token_type::integer, "12"), 12.0f);
+    assert_eq(converted<double>(token_type::floating, "1e3"), 1000.0);
+    assert_eq(converted<double>(token_type::floating, "2.5E-2"), 0.025);
+    assert_eq(converted<double>(token_type::floating, "1e+2"), 100.0);
+}
+
+test_case(floating_matches_strtod)
+{
+    // Too many digits for the fast path
+    std::string long_pi = "3.14159265358979323846264338327950288";
+    assert_eq(converted<double>(token_type::floating, long_pi),
+              std::strtod(long_pi.c_str(), nullptr));
+    assert_eq(converted<float>(token_type::floating, long_pi),
+              std::strtof(long_pi.c_str(), nullptr));
+
+    // Exactly halfway between two floats, where narrowing a double is unsafe
+    std::string halfway = "1.000000059604644775390625";
+    assert_eq(converted<float>(token_type::floating, halfway),
+              std::strtof(halfway.c_str(), nullptr));
+
+    std::string tiny = "1e-30";
+    assert_eq(converted<double>(token_type::floating, tiny),
+              std::strtod(tiny.c_str(), nullptr));
+}
+
+test_case(floating_overflow)
+{
+    assert_true(rejects<float>(token_type::floating, "1e39"));
+    assert_true(rejects<double>(token_type::floating, "1e400"));
+    assert_true(rejects<double>(token_type::floating, "-1e400"));
+}
+
+test_case(malformed_floating)
+{
+    assert_true(rejects<float>(token_type::floating, ""));
+    assert_true(rejects<float>(token_type::floating, "-"));
+    assert_true(rejects<float>(token_type::floating, "1e"));
+    assert_true(rejects<float>(token_type::floating, "1e+"));
+    assert_true(rejects<float>(token_type::floating, "1.5x"));
+    assert_true(rejects<float>(token_type::identifier, "inf"));
+}
+
+end_suite(numeric_conversion_test);
@@ -0,0 +1,205 @@
+#include "test/test.hpp"
+#include "libold/base/text/tokenizer.hpp"
+#include "io/memory_file.hpp"
+#include <string>
+
+using namespace gorc;
+using namespace gorc::text;
+
+class tokenizer_test_fixture : public test::fixture {
+public:
+    std::string text;
+
+    span<char const> input() const
+    {
+        return make_span(text.data(), text.size());
+    }
+};
+
+#define tok_assert(tp, v) \
+    do { \
+        token t; \
+        tok.get_token(t); \
+        expect_eq(t.type, token_type::tp); \
+        expect_eq(t.value, std::string(v)); \
+    } while(false)
+
+#define tok_location(fl, fc, ll, lc) \
+    do { \
+        token t; \
+        tok.get_token(t); \
+        expect_eq(t.location.first_line, fl); \
+        expect_eq(t.location.first_col, fc); \
+        expect_eq(t.location.last_line, ll); \
+        expect_eq(t.location.last_col, lc); \
+    } while(false)
+
+begin_suite_fixture(tokenizer_test, tokenizer_test_fixture);
+
+test_case(empty_input)
+{
+    tokenizer tok(input());
+    tok_assert(end_of_file, "");
+}
+
+test_case(token_types)
+{
+    text = "SECTOR 12 -3.5 0x1F 2e3 \"str\" : # comment\nnext_1";
+    tokenizer tok(input());
+
+    tok_assert(identifier, "SECTOR");
+    tok_assert(integer, "12");
+    tok_assert(floating, "-3.5");
+    tok_assert(hex_integer, "0x1F");
+    tok_assert(floating, "2e3");
+    tok_assert(string, "str");
+    tok_assert(punctuator, ":");
+    tok_assert(identifier, "next_1");
+    tok_assert(end_of_file, "");
+}
+
+test_case(end_of_file_repeats)
+{
+    text = "a   \n\t# trailing comment";
+    tokenizer tok(input());
+
+    tok_assert(identifier, "a");
+    tok_assert(end_of_file, "");
+    tok_assert(end_of_file, "");
+    tok.assert_end_of_file();
+}
+
+test_case(null_character_ends_input)
+{
+    text = std::string("a\0b", 3);
+    tokenizer tok(input());
+
+    tok_assert(identifier, "a");
+    tok_assert(end_of_file, "");
+}
+
+test_case(report_end_of_line)
+{
+    text = "a # comment\r\n\nb";
+    tokenizer tok(input());
+    tok.set_report_eol(true);
+
+    tok_assert(identifier, "a");
+    tok_assert(end_of_line, "");
+    tok_assert(end_of_line, "");
+    tok_assert(identifier, "b");
+    tok_assert(end_of_file, "");
+}
+
+test_case(line_and_column)
+{
+    text = "a\n  bcd 12\n\t\"s\"\n\n  -.5";
+    tokenizer tok(input());
+
+    tok_location(1, 1, 1, 2);
+    tok_location(2, 3, 2, 6);
+    tok_location(2, 7, 2, 9);
+    tok_location(3, 2, 3, 5);
+    tok_location(5, 3, 5, 6);
+    tok_location(5, 6, 5, 6);
+}
+
+test_case(leading_point_floating)
+{
+    text = ".5 -.25 1.";
+    tokenizer tok(input());
+
+    tok_assert(floating, "0.5");
+    tok_assert(floating, "-0.25");
+    tok_assert(integer, "1");
+    tok_assert(punctuator, ".");
+}
+
+test_case(escaped_string)
+{
+    text = "\"a\\tb\\\"c\\\\\" next";
+    tokenizer tok(input());
+
+    tok_assert(string, "a\tb\"c\\");
+    tok_assert(identifier, "next");
+}
+
+test_case(unterminated_string)
+{
+    text = "\"abc";
+    tokenizer tok(input());
+
+    token t;
+    assert_throws_logged(tok.get_token(t));
+    assert_log_message(log_level::error, "<BUFFER>:1:5: unexpected end of file in string literal");
+    assert_log_empty();
+}
+
+test_case(get_number)
+{
+    text = "12 0x10 -2.5 .25 3.75";
+    tokenizer tok(input());
+
+    assert_eq(tok.get_number<int>(), 12);
+    assert_eq(tok.get_number<int>(), 16);
+    assert_eq(tok.get_number<float>(), -2.5f);
+    assert_eq(tok.get_number<double>(), 0.25);
+    assert_eq(tok.get_number<int>(), 3);
+}
+
+test_case(get_number_rejects_identifier)
+{
+    text = "\n  abc";
+    tokenizer tok(input());
+
+    assert_throws_logged(tok.get_number<int>());
+    assert_log_message(log_level::error,
+                       "<BUFFER>:2:3-2:6: invalid numeric conversion: expected number, found 'abc'");
+    assert_log_empty();
+}
+
+test_case(assertions)
+{
+    text = "World vertices: 4 wrong";
+    tokenizer tok(input());
+
+    tok.assert_identifier("world");
+    tok.assert_label("VERTICES");
+    assert_eq(tok.get_number<int>(), 4);
+
+    assert_throws_logged(tok.assert_identifier("right"));
+    assert_log_message(log_level::error, "<BUFFER>:1:19: expected 'right', found 'wrong'");
+    assert_log_empty();
+}
+
+test_case(position_rewinds)
+{
+    text = "a\nb c";
+    tokenizer tok(input());
+
+    tok_assert(identifier, "a");
+    auto pos = tok.get_position();
+    tok_assert(identifier, "b");
+    tok_assert(identifier, "c");
+
+    tok.set_position(pos);
+    tok_location(2, 1, 2, 2);
+    tok_assert(identifier, "c");
+}
+
+test_case(stream_input)
+{
+    text = "alpha 1.5\n\"beta\"";
+
+    memory_file mf;
+    mf.write(text.data(), text.size());
+    memory_file::reader rd(mf);
+    tokenizer tok(rd);
+
+    tok_assert(identifier, "alpha");
+    tok_assert(floating, "1.5");
+    tok_location(2, 1, 2, 7);
+    tok_assert(end_of_file, "");
+}
+
+end_suite(tokenizer_test);
@@ -0,0 +1,45 @@
+#include "log_buffer.hpp"
+#include "log_frontend.hpp"
+#include "log_midend.hpp"
+
+gorc::log_buffer::entry::entry(std::string const &filename,
+                               int line_number,
+                               log_level level,
+                               std::string const &message)
+    : filename(filename)
+    , line_number(line_number)
+    , level(level)
+    , message(message)
+{
+    return;
+}
+
+bool gorc::log_buffer::empty() const
+{
+    return entries.empty();
+}
+
+void gorc::log_buffer::clear()
+{
+    entries.clear();
+}
+
+void gorc::log_buffer::replay() const
+{
+    auto midend = get_global<log_midend>();
+    for(auto const &em : entries) {
+        midend->write_log_message(em.filename, em.line_number, em.level, em.message);
+    }
+}
+
+gorc::scoped_log_capture::scoped_log_capture(log_buffer &buffer)
+{
+    auto frontend = get_local<log_frontend>();
+    previous_capture = frontend->capture;
+    frontend->capture = &buffer;
+}
+
+gorc::scoped_log_capture::~scoped_log_capture()
+{
+    get_local<log_frontend>()->capture = previous_capture;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "log_level.hpp"
+#include <string>
+#include <vector>
+
+namespace gorc {
+
+    // Holds log messages written on one thread so that they can be forwarded
+    // later, in a deterministic order. Messages are stored with their diagnostic
+    // preamble already applied.
+    class log_buffer {
+        friend class log_frontend;
+    private:
+        class entry {
+        public:
+            std::string filename;
+            int line_number;
+            log_level level;
+            std::string message;
+
+            entry(std::string const &filename,
+                  int line_number,
+                  log_level level,
+                  std::string const &message);
+        };
+
+        std::vector<entry> entries;
+
+    public:
+        bool empty() const;
+        void clear();
+
+        // Forwards all held messages to the log backends.
+        void replay() const;
+    };
+
+    // Redirects messages logged on the current thread into a log_buffer for
+    // the lifetime of the object.
+    class scoped_log_capture {
+    private:
+        log_buffer *previous_capture;
+
+    public:
+        explicit scoped_log_capture(log_buffer &buffer);
+        ~scoped_log_capture();
+
+        scoped_log_capture(scoped_log_capture const &) = delete;
+        scoped_log_capture& operator=(scoped_log_capture const &) = delete;
+    };
+
+}
@@ -1,4 +1,5 @@
 #include "log_frontend.hpp"
+#include "log_buffer.hpp"
 #include <sstream>
 
 gorc::log_frontend::diagnostic_context_frame::diagnostic_context_frame(maybe<char const*> filename,
@@ -70,6 +71,14 @@ void gorc::log_frontend::write_log_message(std::string const &filename,
         update_diagnostic_preamble();
     }
 
+    if(capture) {
+        capture->entries.emplace_back(filename,
+                                      line_number,
+                                      level,
+                                      computed_diagnostic_preamble + message);
+        return;
+    }
+
     midend->write_log_message(filename, line_number, level, computed_diagnostic_preamble + message);
 }
 
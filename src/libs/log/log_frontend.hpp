@@ -10,9 +10,12 @@
 
 namespace gorc {
 
+    class log_buffer;
+
     class log_frontend : public local {
         template <typename LocalT> friend class local_factory;
         friend class diagnostic_context;
+        friend class scoped_log_capture;
     private:
         class diagnostic_context_frame {
         public:
@@ -37,6 +40,7 @@ namespace gorc {
         std::vector<diagnostic_context_frame> diagnostic_context;
         bool diagnostic_preamble_dirty = false;
         std::string computed_diagnostic_preamble;
+        log_buffer *capture = nullptr;
 
         log_frontend();
 
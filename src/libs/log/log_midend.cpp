@@ -18,6 +18,12 @@ void gorc::log_midend::erase_log_backends()
     log_backends.clear();
 }
 
+void gorc::log_midend::swap_log_backends(log_backend_list &other)
+{
+    std::lock_guard<std::mutex> lock(log_backend_lock);
+    log_backends.swap(other);
+}
+
 void gorc::log_midend::write_log_message(std::string const &filename,
                                          int line_number,
                                          log_level level,
@@ -10,10 +10,13 @@
 
 namespace gorc {
 
+    using log_backend_list = std::vector<std::tuple<flag_set<log_level>,
+                                                    std::unique_ptr<log_backend>>>;
+
     class log_midend : public global {
         template <typename GlobalT> friend class global_factory;
     private:
-        std::vector<std::tuple<flag_set<log_level>, std::unique_ptr<log_backend>>> log_backends;
+        log_backend_list log_backends;
         std::mutex log_backend_lock;
 
         log_midend();
@@ -22,6 +25,10 @@ namespace gorc {
         void insert_log_backend(flag_set<log_level>, std::unique_ptr<log_backend>&&);
         void erase_log_backends();
 
+        // Exchanges the installed backends with another set. Used to give a
+        // program run inside another program its own log configuration.
+        void swap_log_backends(log_backend_list &other);
+
         void write_log_message(std::string const &filename,
                                int line_number,
                                log_level level,
@@ -0,0 +1,90 @@
+#include "test/test.hpp"
+#include "log/log.hpp"
+#include "log/log_buffer.hpp"
+#include <thread>
+
+using namespace gorc;
+
+begin_suite(log_buffer_test);
+
+test_case(capture_holds_messages_until_replay)
+{
+    log_buffer buffer;
+
+    do {
+        scoped_log_capture capture(buffer);
+        diagnostic_context dc("foo.cog", 5);
+
+        LOG_WARNING("first");
+        LOG_ERROR("second");
+    } while(false);
+
+    assert_true(!buffer.empty());
+    assert_log_empty();
+
+    LOG_INFO("before replay");
+    buffer.replay();
+
+    assert_log_message(log_level::info, "before replay");
+    assert_log_message(log_level::warning, "foo.cog:5: first");
+    assert_log_message(log_level::error, "foo.cog:5: second");
+    assert_log_empty();
+}
+
+test_case(capture_counts_errors)
+{
+    log_buffer buffer;
+    scoped_log_capture capture(buffer);
+    diagnostic_context dc("foo.cog");
+
+    LOG_ERROR("error");
+
+    assert_eq(diagnostic_file_error_count(), 1);
+}
+
+test_case(nested_capture_restores_outer)
+{
+    log_buffer outer;
+    log_buffer inner;
+
+    do {
+        scoped_log_capture outer_capture(outer);
+        LOG_ERROR("outer");
+
+        do {
+            scoped_log_capture inner_capture(inner);
+            LOG_ERROR("inner");
+        } while(false);
+
+        LOG_ERROR("outer again");
+    } while(false);
+
+    LOG_ERROR("uncaptured");
+    assert_log_message(log_level::error, "uncaptured");
+    assert_log_empty();
+
+    inner.replay();
+    assert_log_message(log_level::error, "inner");
+    assert_log_empty();
+
+    outer.replay();
+    assert_log_message(log_level::error, "outer");
+    assert_log_message(log_level::error, "outer again");
+    assert_log_empty();
+}
+
+test_case(capture_is_per_thread)
+{
+    log_buffer buffer;
+    scoped_log_capture capture(buffer);
+
+    std::thread th([]() {
+        LOG_ERROR("other thread");
+    });
+    th.join();
+
+    assert_log_message(log_level::error, "other thread");
+    assert_log_empty();
+}
+
+end_suite(log_buffer_test);
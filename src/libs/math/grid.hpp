@@ -46,6 +46,11 @@ namespace gorc {
         {
             return elements.data();
         }
+
+        T* data()
+        {
+            return elements.data();
+        }
     };
 
 }
@@ -0,0 +1,74 @@
+#include "frame_summary.hpp"
+#include <algorithm>
+
+gorc::profile::frame_summary::frame_summary(size_t window_frames)
+    : window_frames(std::max(size_t(1), window_frames))
+{
+    return;
+}
+
+void gorc::profile::frame_summary::add_frame(std::vector<zone_record> const &zones)
+{
+    if(frames.size() == window_frames) {
+        frames.pop_front();
+    }
+
+    frames.emplace_back();
+    auto &frame = frames.back();
+
+    std::string key;
+    for(auto const &zone : zones) {
+        key = zone.name;
+        if(zone.tag[0] != '\0') {
+            key += " [";
+            key += zone.tag.data();
+            key += "]";
+        }
+
+        double ms = std::chrono::duration<double, std::milli>(zone.end - zone.begin).count();
+
+        auto &stats = frame[key];
+        stats.total_ms += ms;
+        stats.max_ms = std::max(stats.max_ms, ms);
+        ++stats.calls;
+    }
+}
+
+size_t gorc::profile::frame_summary::frame_count() const
+{
+    return frames.size();
+}
+
+std::vector<gorc::profile::frame_summary_entry> gorc::profile::frame_summary::get_entries() const
+{
+    std::unordered_map<std::string, zone_stats> totals;
+    for(auto const &frame : frames) {
+        for(auto const &zone : frame) {
+            auto &stats = totals[zone.first];
+            stats.total_ms += zone.second.total_ms;
+            stats.max_ms = std::max(stats.max_ms, zone.second.max_ms);
+            stats.calls += zone.second.calls;
+        }
+    }
+
+    std::vector<frame_summary_entry> rv;
+    double frame_count = static_cast<double>(std::max(size_t(1), frames.size()));
+    for(auto const &zone : totals) {
+        rv.emplace_back();
+        auto &entry = rv.back();
+        entry.zone = zone.first;
+        entry.ms_per_frame = zone.second.total_ms / frame_count;
+        entry.max_ms = zone.second.max_ms;
+        entry.calls_per_frame = static_cast<double>(zone.second.calls) / frame_count;
+    }
+
+    std::sort(rv.begin(), rv.end(), [](frame_summary_entry const &a, frame_summary_entry const &b) {
+            if(a.ms_per_frame != b.ms_per_frame) {
+                return a.ms_per_frame > b.ms_per_frame;
+            }
+
+            return a.zone < b.zone;
+        });
+
+    return rv;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "profiler.hpp"
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gorc {
+    namespace profile {
+
+        class frame_summary_entry {
+        public:
+            std::string zone;
+            double ms_per_frame = 0.0;
+            double max_ms = 0.0;
+            double calls_per_frame = 0.0;
+        };
+
+        // Zone times over a window of recent frames. Zones are grouped by
+        // name and tag.
+        class frame_summary {
+        private:
+            class zone_stats {
+            public:
+                double total_ms = 0.0;
+                double max_ms = 0.0;
+                size_t calls = 0;
+            };
+
+            using frame_stats = std::unordered_map<std::string, zone_stats>;
+
+            size_t window_frames;
+            std::deque<frame_stats> frames;
+
+        public:
+            explicit frame_summary(size_t window_frames = 120);
+
+            void add_frame(std::vector<zone_record> const &zones);
+
+            size_t frame_count() const;
+
+            // Returns entries sorted by time per frame, most expensive first
+            std::vector<frame_summary_entry> get_entries() const;
+        };
+
+    }
+}
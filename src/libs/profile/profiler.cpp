@@ -0,0 +1,163 @@
+#include "profiler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+std::atomic<bool> gorc::profile::detail::enabled(false);
+
+namespace {
+
+    using namespace gorc::profile;
+
+    constexpr size_t ring_capacity = 16384;
+
+    class zone_ring {
+    public:
+        uint32_t const thread;
+        std::mutex lock;
+        std::vector<zone_record> records;
+        size_t next = 0;
+        size_t count = 0;
+
+        explicit zone_ring(uint32_t thread)
+            : thread(thread)
+            , records(ring_capacity)
+        {
+            return;
+        }
+    };
+
+    // Rings outlive their threads, so zones from finished workers can still
+    // be collected. A ring is reused by the next thread that needs one.
+    class zone_ring_registry {
+    public:
+        std::mutex lock;
+        std::vector<std::unique_ptr<zone_ring>> rings;
+        std::vector<zone_ring*> free_rings;
+
+        zone_ring* acquire()
+        {
+            std::lock_guard<std::mutex> lk(lock);
+            if(!free_rings.empty()) {
+                auto *rv = free_rings.back();
+                free_rings.pop_back();
+                return rv;
+            }
+
+            rings.push_back(std::make_unique<zone_ring>(static_cast<uint32_t>(rings.size())));
+            return rings.back().get();
+        }
+
+        void release(zone_ring *ring)
+        {
+            std::lock_guard<std::mutex> lk(lock);
+            free_rings.push_back(ring);
+        }
+    };
+
+    zone_ring_registry& get_registry()
+    {
+        // Never destroyed, so threads exiting during shutdown can still
+        // return their rings.
+        static auto *registry = new zone_ring_registry();
+        return *registry;
+    }
+
+    class thread_ring {
+    public:
+        zone_ring *ring = nullptr;
+
+        ~thread_ring()
+        {
+            if(ring) {
+                get_registry().release(ring);
+            }
+        }
+
+        zone_ring& get()
+        {
+            if(!ring) {
+                ring = get_registry().acquire();
+            }
+
+            return *ring;
+        }
+    };
+
+    thread_local thread_ring current_thread_ring;
+
+    void copy_tag(std::array<char, 56> &dest, size_t &offset, char const *src)
+    {
+        if(!src) {
+            return;
+        }
+
+        size_t len = std::min(std::strlen(src), dest.size() - 1 - offset);
+        std::memcpy(dest.data() + offset, src, len);
+        offset += len;
+    }
+}
+
+void gorc::profile::detail::record_zone(char const *name,
+                                        std::array<char, 56> const &tag,
+                                        clock::time_point begin,
+                                        clock::time_point end)
+{
+    auto &ring = current_thread_ring.get();
+
+    std::lock_guard<std::mutex> lk(ring.lock);
+    auto &rec = ring.records[ring.next];
+    rec.name = name;
+    rec.tag = tag;
+    rec.thread = ring.thread;
+    rec.begin = begin;
+    rec.end = end;
+
+    ring.next = (ring.next + 1) % ring.records.size();
+    ring.count = std::min(ring.count + 1, ring.records.size());
+}
+
+void gorc::profile::set_enabled(bool value)
+{
+    detail::enabled.store(value, std::memory_order_relaxed);
+}
+
+std::vector<gorc::profile::zone_record> gorc::profile::collect()
+{
+    std::vector<zone_record> rv;
+
+    auto &registry = get_registry();
+    std::lock_guard<std::mutex> registry_lk(registry.lock);
+    for(auto &ring : registry.rings) {
+        std::lock_guard<std::mutex> lk(ring->lock);
+
+        size_t first = (ring->next + ring->records.size() - ring->count) % ring->records.size();
+        for(size_t i = 0; i < ring->count; ++i) {
+            rv.push_back(ring->records[(first + i) % ring->records.size()]);
+        }
+
+        ring->count = 0;
+    }
+
+    return rv;
+}
+
+void gorc::profile::scoped_zone::start(char const *tag, char const *tag_suffix)
+{
+    size_t offset = 0;
+    copy_tag(this->tag, offset, tag);
+    if(tag && tag_suffix) {
+        copy_tag(this->tag, offset, ":");
+    }
+
+    copy_tag(this->tag, offset, tag_suffix);
+    this->tag[offset] = '\0';
+
+    begin = clock::now();
+}
+
+void gorc::profile::scoped_zone::finish()
+{
+    detail::record_zone(name, tag, begin, clock::now());
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace gorc {
+    namespace profile {
+
+        using clock = std::chrono::steady_clock;
+
+        // Completed zone. Names must be string literals. Tags are copied and
+        // truncated to fit.
+        class zone_record {
+        public:
+            char const *name;
+            std::array<char, 56> tag;
+            uint32_t thread;
+            clock::time_point begin;
+            clock::time_point end;
+        };
+
+        namespace detail {
+            extern std::atomic<bool> enabled;
+
+            void record_zone(char const *name,
+                             std::array<char, 56> const &tag,
+                             clock::time_point begin,
+                             clock::time_point end);
+        }
+
+        // Recording is off until enabled. Zones entered while recording is
+        // off cost one relaxed load.
+        void set_enabled(bool value);
+
+        inline bool is_enabled()
+        {
+            return detail::enabled.load(std::memory_order_relaxed);
+        }
+
+        // Removes and returns the zones recorded by every thread. Each thread
+        // keeps its most recent zones in a fixed-size ring buffer; older zones
+        // are overwritten if they are not collected in time.
+        std::vector<zone_record> collect();
+
+        class scoped_zone {
+        private:
+            char const *name;
+            std::array<char, 56> tag;
+            clock::time_point begin;
+            bool active;
+
+            void start(char const *tag, char const *tag_suffix);
+            void finish();
+
+        public:
+            // Inline, so a zone entered while recording is off costs only
+            // the enabled check.
+            explicit scoped_zone(char const *name,
+                                 char const *tag = nullptr,
+                                 char const *tag_suffix = nullptr)
+                : name(name)
+                , active(is_enabled())
+            {
+                if(active) {
+                    start(tag, tag_suffix);
+                }
+            }
+
+            ~scoped_zone()
+            {
+                if(active) {
+                    finish();
+                }
+            }
+
+            scoped_zone(scoped_zone const &) = delete;
+            scoped_zone& operator=(scoped_zone const &) = delete;
+        };
+
+    }
+}
+
+// Instrumentation macros. Builds without GORC_PROFILE compile them out, and
+// their arguments are not evaluated.
+#if defined(GORC_PROFILE)
+#define PROFILE_ZONE_CONCAT_INNER(x, y) x##y
+#define PROFILE_ZONE_CONCAT(x, y) PROFILE_ZONE_CONCAT_INNER(x, y)
+#define PROFILE_ZONE(name) \
+    ::gorc::profile::scoped_zone PROFILE_ZONE_CONCAT(profile_zone_, __LINE__)(name)
+#define PROFILE_ZONE_TAGGED(name, ...) \
+    ::gorc::profile::scoped_zone PROFILE_ZONE_CONCAT(profile_zone_, __LINE__)(name, __VA_ARGS__)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_ZONE_TAGGED(name, ...)
+#endif
@@ -0,0 +1,52 @@
+#include "trace_export.hpp"
+#include <algorithm>
+#include <string>
+
+void gorc::profile::write_chrome_trace(json_output_stream &jos,
+                                       std::vector<zone_record> const &zones)
+{
+    clock::time_point origin;
+    if(!zones.empty()) {
+        origin = std::min_element(zones.begin(),
+                                  zones.end(),
+                                  [](zone_record const &a, zone_record const &b) {
+                                      return a.begin < b.begin;
+                                  })->begin;
+    }
+
+    auto to_us = [](clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count();
+    };
+
+    json_serialize_members(jos, [&] {
+        json_serialize_member(jos, "displayTimeUnit", [&] {
+            json_serialize(jos, std::string("ms"));
+        });
+
+        json_serialize_member(jos, "traceEvents", [&] {
+            json_serialize_array(jos, zones, [&](zone_record const &zone) {
+                json_serialize_members(jos, [&] {
+                    json_serialize_member(jos, "name", [&] {
+                        json_serialize(jos, std::string(zone.name));
+                    });
+
+                    json_serialize_member(jos, "ph", [&] { json_serialize(jos, std::string("X")); });
+                    json_serialize_member(jos, "ts", [&] { json_serialize(jos, to_us(zone.begin - origin)); });
+                    json_serialize_member(jos, "dur", [&] { json_serialize(jos, to_us(zone.end - zone.begin)); });
+                    json_serialize_member(jos, "pid", [&] { json_serialize(jos, 1); });
+                    json_serialize_member(jos, "tid", [&] { json_serialize(jos, zone.thread); });
+
+                    if(zone.tag[0] != '\0') {
+                        json_serialize_member(jos, "args", [&] {
+                            json_serialize_members(jos, [&] {
+                                json_serialize_member(jos, "tag", [&] {
+                                    json_serialize(jos, std::string(zone.tag.data()));
+                                });
+                            });
+                        });
+                    }
+                });
+            });
+        });
+    });
+}
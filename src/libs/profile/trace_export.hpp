@@ -0,0 +1,16 @@
+#pragma once
+
+#include "profiler.hpp"
+#include "text/json_output_stream.hpp"
+#include <vector>
+
+namespace gorc {
+    namespace profile {
+
+        // Writes zones in the Chrome trace event format, as complete events
+        // timed in microseconds from the earliest zone. The output can be
+        // opened in chrome://tracing or Perfetto.
+        void write_chrome_trace(json_output_stream &jos, std::vector<zone_record> const &zones);
+
+    }
+}
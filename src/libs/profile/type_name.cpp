@@ -0,0 +1,19 @@
+#include "type_name.hpp"
+#include <boost/core/demangle.hpp>
+
+std::string gorc::profile::get_short_type_name(std::type_info const &type)
+{
+    std::string name = boost::core::demangle(type.name());
+
+    auto template_begin = name.find('<');
+    if(template_begin != std::string::npos) {
+        name.erase(template_begin);
+    }
+
+    auto scope_end = name.rfind("::");
+    if(scope_end != std::string::npos) {
+        name.erase(0, scope_end + 2);
+    }
+
+    return name;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+#include <typeinfo>
+
+namespace gorc {
+    namespace profile {
+
+        // Readable class name for zone tags, without namespaces or
+        // template arguments.
+        std::string get_short_type_name(std::type_info const &type);
+
+    }
+}
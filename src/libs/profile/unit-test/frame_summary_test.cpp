@@ -0,0 +1,69 @@
+#include "test/test.hpp"
+#include "profile/frame_summary.hpp"
+#include <cstring>
+
+using namespace gorc;
+
+namespace {
+    profile::zone_record make_zone(char const *name, char const *tag, int begin_ms, int end_ms)
+    {
+        profile::zone_record rv;
+        rv.name = name;
+        rv.tag.fill('\0');
+        std::strncpy(rv.tag.data(), tag, rv.tag.size() - 1);
+        rv.thread = 0;
+        rv.begin = profile::clock::time_point(std::chrono::milliseconds(begin_ms));
+        rv.end = profile::clock::time_point(std::chrono::milliseconds(end_ms));
+        return rv;
+    }
+}
+
+begin_suite(frame_summary_test);
+
+test_case(averages_over_frames)
+{
+    profile::frame_summary summary(4);
+    summary.add_frame({ make_zone("physics", "", 0, 4), make_zone("sounds", "", 4, 5) });
+    summary.add_frame({ make_zone("physics", "", 10, 12), make_zone("physics", "", 12, 14) });
+
+    assert_eq(summary.frame_count(), size_t(2));
+
+    auto entries = summary.get_entries();
+    assert_eq(entries.size(), size_t(2));
+
+    assert_eq(entries[0].zone, std::string("physics"));
+    assert_eq(entries[0].ms_per_frame, 4.0);
+    assert_eq(entries[0].max_ms, 4.0);
+    assert_eq(entries[0].calls_per_frame, 1.5);
+
+    assert_eq(entries[1].zone, std::string("sounds"));
+    assert_eq(entries[1].ms_per_frame, 0.5);
+}
+
+test_case(groups_by_tag)
+{
+    profile::frame_summary summary;
+    summary.add_frame({ make_zone("cog message", "a.cog:pulse", 0, 2),
+                        make_zone("cog message", "b.cog:pulse", 2, 3) });
+
+    auto entries = summary.get_entries();
+    assert_eq(entries.size(), size_t(2));
+    assert_eq(entries[0].zone, std::string("cog message [a.cog:pulse]"));
+    assert_eq(entries[1].zone, std::string("cog message [b.cog:pulse]"));
+}
+
+test_case(window_discards_old_frames)
+{
+    profile::frame_summary summary(2);
+    summary.add_frame({ make_zone("old", "", 0, 100) });
+    summary.add_frame({ make_zone("new", "", 0, 1) });
+    summary.add_frame({ make_zone("new", "", 0, 1) });
+
+    assert_eq(summary.frame_count(), size_t(2));
+
+    auto entries = summary.get_entries();
+    assert_eq(entries.size(), size_t(1));
+    assert_eq(entries[0].zone, std::string("new"));
+}
+
+end_suite(frame_summary_test);
@@ -0,0 +1,87 @@
+#include "test/test.hpp"
+#include "profile/profiler.hpp"
+#include <string>
+#include <thread>
+
+using namespace gorc;
+
+begin_suite(profiler_test);
+
+test_case(disabled_records_nothing)
+{
+    profile::collect();
+    profile::set_enabled(false);
+
+    {
+        profile::scoped_zone zone("disabled");
+    }
+
+    assert_true(profile::collect().empty());
+}
+
+test_case(records_zone)
+{
+    profile::collect();
+    profile::set_enabled(true);
+
+    {
+        profile::scoped_zone zone("outer", "script.cog", "startup");
+        profile::scoped_zone inner("inner");
+    }
+
+    profile::set_enabled(false);
+
+    auto zones = profile::collect();
+    assert_eq(zones.size(), size_t(2));
+
+    // Zones are recorded as they end
+    assert_eq(std::string(zones[0].name), std::string("inner"));
+    assert_eq(std::string(zones[0].tag.data()), std::string(""));
+    assert_eq(std::string(zones[1].name), std::string("outer"));
+    assert_eq(std::string(zones[1].tag.data()), std::string("script.cog:startup"));
+
+    assert_true(zones[1].begin <= zones[0].begin);
+    assert_true(zones[0].end <= zones[1].end);
+
+    assert_true(profile::collect().empty());
+}
+
+test_case(long_tag_truncated)
+{
+    profile::collect();
+    profile::set_enabled(true);
+
+    std::string long_tag(200, 'x');
+    {
+        profile::scoped_zone zone("zone", long_tag.c_str());
+    }
+
+    profile::set_enabled(false);
+
+    auto zones = profile::collect();
+    assert_eq(zones.size(), size_t(1));
+    assert_eq(std::string(zones[0].tag.data()), std::string(zones[0].tag.size() - 1, 'x'));
+}
+
+test_case(worker_threads)
+{
+    profile::collect();
+    profile::set_enabled(true);
+
+    {
+        profile::scoped_zone zone("main");
+    }
+
+    std::thread worker([] {
+            profile::scoped_zone zone("worker");
+        });
+    worker.join();
+
+    profile::set_enabled(false);
+
+    auto zones = profile::collect();
+    assert_eq(zones.size(), size_t(2));
+    assert_true(zones[0].thread != zones[1].thread);
+}
+
+end_suite(profiler_test);
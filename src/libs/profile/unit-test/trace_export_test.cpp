@@ -0,0 +1,46 @@
+#include "test/test.hpp"
+#include "profile/trace_export.hpp"
+#include "io/memory_file.hpp"
+#include <cstring>
+#include <string>
+
+using namespace gorc;
+
+begin_suite(trace_export_test);
+
+test_case(complete_events)
+{
+    std::vector<profile::zone_record> zones(2);
+
+    zones[0].name = "physics";
+    zones[0].tag.fill('\0');
+    zones[0].thread = 0;
+    zones[0].begin = profile::clock::time_point(std::chrono::microseconds(1000));
+    zones[0].end = profile::clock::time_point(std::chrono::microseconds(1500));
+
+    zones[1].name = "cog message";
+    zones[1].tag.fill('\0');
+    std::strcpy(zones[1].tag.data(), "door.cog:activated");
+    zones[1].thread = 2;
+    zones[1].begin = profile::clock::time_point(std::chrono::microseconds(1200));
+    zones[1].end = profile::clock::time_point(std::chrono::microseconds(1250));
+
+    memory_file mf;
+    {
+        json_output_stream jos(mf);
+        profile::write_chrome_trace(jos, zones);
+    }
+
+    std::string output(mf.data(), mf.size());
+
+    assert_true(output.find("\"traceEvents\"") != std::string::npos);
+    assert_true(output.find("\"name\" : \"physics\"") != std::string::npos);
+    assert_true(output.find("\"ph\" : \"X\"") != std::string::npos);
+    assert_true(output.find("\"ts\" : 0.0") != std::string::npos);
+    assert_true(output.find("\"dur\" : 500.0") != std::string::npos);
+    assert_true(output.find("\"ts\" : 200.0") != std::string::npos);
+    assert_true(output.find("\"tid\" : 2") != std::string::npos);
+    assert_true(output.find("\"tag\" : \"door.cog:activated\"") != std::string::npos);
+}
+
+end_suite(trace_export_test);
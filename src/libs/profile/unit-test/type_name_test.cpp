@@ -0,0 +1,30 @@
+#include "test/test.hpp"
+#include "profile/type_name.hpp"
+#include <vector>
+
+namespace gorc {
+    namespace profile_type_name_test {
+        class nested_aspect { };
+    }
+}
+
+class global_aspect { };
+
+begin_suite(type_name_test);
+
+test_case(strips_namespaces)
+{
+    assert_eq(gorc::profile::get_short_type_name(
+                  typeid(gorc::profile_type_name_test::nested_aspect)),
+              std::string("nested_aspect"));
+    assert_eq(gorc::profile::get_short_type_name(typeid(global_aspect)),
+              std::string("global_aspect"));
+}
+
+test_case(strips_template_arguments)
+{
+    assert_eq(gorc::profile::get_short_type_name(typeid(std::vector<global_aspect>)),
+              std::string("vector"));
+}
+
+end_suite(type_name_test);
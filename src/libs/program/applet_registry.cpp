@@ -0,0 +1,18 @@
+#include "applet_registry.hpp"
+
+void gorc::applet_registry::add_applet(std::string const &name,
+                                       applet_factory const &factory)
+{
+    applets.emplace(name, factory);
+}
+
+gorc::maybe<gorc::applet_factory const*> gorc::applet_registry::get_applet(
+        std::string const &name) const
+{
+    auto it = applets.find(name);
+    if(it == applets.end()) {
+        return nothing;
+    }
+
+    return &it->second;
+}
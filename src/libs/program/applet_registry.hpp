@@ -0,0 +1,24 @@
+#pragma once
+
+#include "program.hpp"
+#include "utility/maybe.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace gorc {
+
+    using applet_factory = std::function<std::unique_ptr<program>()>;
+
+    // Programs which can be started inside the current process, by name.
+    class applet_registry {
+    private:
+        std::unordered_map<std::string, applet_factory> applets;
+
+    public:
+        void add_applet(std::string const &name, applet_factory const &factory);
+        maybe<applet_factory const*> get_applet(std::string const &name) const;
+    };
+
+}
@@ -0,0 +1,206 @@
+#include "applet_thread.hpp"
+#include "log/log.hpp"
+#include <unistd.h>
+#include <fcntl.h>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <system_error>
+
+namespace {
+
+    // Held while an applet owns the standard streams
+    std::mutex applet_lock;
+
+    void flush_standard_streams()
+    {
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+    }
+
+    void safe_dup2(int old_fd, int new_fd)
+    {
+        int result = 0;
+        do {
+            result = ::dup2(old_fd, new_fd);
+        } while(result < 0 && errno == EINTR);
+
+        // LCOV_EXCL_START
+        if(result < 0) {
+            throw std::system_error(errno, std::generic_category());
+        }
+        // LCOV_EXCL_STOP
+    }
+
+    class standard_stream_redirection {
+    private:
+        int target_fd;
+        int saved_fd;
+
+    public:
+        standard_stream_redirection(int target_fd, int source_fd)
+            : target_fd(target_fd)
+        {
+            saved_fd = ::fcntl(target_fd, F_DUPFD_CLOEXEC, 0);
+
+            // LCOV_EXCL_START
+            if(saved_fd < 0) {
+                throw std::system_error(errno, std::generic_category());
+            }
+            // LCOV_EXCL_STOP
+
+            safe_dup2(source_fd, target_fd);
+        }
+
+        ~standard_stream_redirection()
+        {
+            ::dup2(saved_fd, target_fd);
+            ::close(saved_fd);
+        }
+    };
+
+    class scoped_log_backends {
+    private:
+        gorc::log_backend_list saved_backends;
+
+    public:
+        scoped_log_backends()
+        {
+            gorc::get_global<gorc::log_midend>()->swap_log_backends(saved_backends);
+        }
+
+        ~scoped_log_backends()
+        {
+            gorc::get_global<gorc::log_midend>()->swap_log_backends(saved_backends);
+        }
+    };
+
+}
+
+gorc::applet_thread::applet_thread(applet_factory const &factory,
+                                   argument_list const &args,
+                                   maybe<gorc::pipe*> std_input,
+                                   maybe<gorc::pipe*> std_output,
+                                   maybe<gorc::pipe*> std_error)
+    : std_input(std_input)
+    , std_output(std_output)
+    , std_error(std_error)
+{
+    thread = std::thread([this, factory, args] {
+            try {
+                internal_run(factory, args);
+            }
+            catch(...) {
+                exception = std::current_exception();
+            }
+
+            // Close child ends of pipe, so that readers see end of file
+            internal_close_child_ends();
+        });
+}
+
+// LCOV_EXCL_START
+gorc::applet_thread::~applet_thread()
+{
+    if(thread.joinable()) {
+        LOG_ERROR("applet thread not joined");
+        try {
+            join();
+        }
+        catch(std::exception const &e) {
+            LOG_ERROR(format("error while joining applet: %s") % e.what());
+        }
+    }
+}
+// LCOV_EXCL_STOP
+
+void gorc::applet_thread::internal_run(applet_factory const &factory,
+                                       argument_list const &args)
+{
+    std::lock_guard<std::mutex> lock(applet_lock);
+
+    std::ios cout_state(nullptr);
+    cout_state.copyfmt(std::cout);
+
+    std::ios cerr_state(nullptr);
+    cerr_state.copyfmt(std::cerr);
+
+    flush_standard_streams();
+
+    {
+        std::unique_ptr<standard_stream_redirection> redirected_stdin;
+        if(std_input.has_value()) {
+            redirected_stdin = std::make_unique<standard_stream_redirection>(
+                    STDIN_FILENO,
+                    std_input.get_value()->get_input().fd);
+        }
+
+        std::unique_ptr<standard_stream_redirection> redirected_stdout;
+        if(std_output.has_value()) {
+            redirected_stdout = std::make_unique<standard_stream_redirection>(
+                    STDOUT_FILENO,
+                    std_output.get_value()->get_output().fd);
+        }
+
+        std::unique_ptr<standard_stream_redirection> redirected_stderr;
+        if(std_error.has_value()) {
+            redirected_stderr = std::make_unique<standard_stream_redirection>(
+                    STDERR_FILENO,
+                    std_error.get_value()->get_output().fd);
+        }
+
+        // The applet configures its own logging when it is constructed.
+        scoped_log_backends log_backends;
+
+        argument_list arg_storage = args;
+        std::vector<char *> argv;
+        for(auto &arg : arg_storage) {
+            argv.push_back(&arg[0]);
+        }
+
+        auto prog = factory();
+        exit_code = prog->start(make_range(argv.data(), argv.data() + argv.size()));
+        prog.reset();
+
+        flush_standard_streams();
+    }
+
+    std::cout.copyfmt(cout_state);
+    std::cerr.copyfmt(cerr_state);
+
+    std::cin.clear();
+    std::clearerr(stdin);
+}
+
+void gorc::applet_thread::internal_close_child_ends()
+{
+    if(std_input.has_value()) {
+        std_input.get_value()->close_input();
+    }
+
+    if(std_output.has_value()) {
+        std_output.get_value()->close_output();
+    }
+
+    if(std_error.has_value()) {
+        std_error.get_value()->close_output();
+    }
+}
+
+int gorc::applet_thread::join()
+{
+    if(!thread.joinable()) {
+        throw std::logic_error("no applet");
+    }
+
+    thread.join();
+
+    if(exception) {
+        auto e = exception;
+        exception = nullptr;
+        std::rethrow_exception(e);
+    }
+
+    return exit_code;
+}
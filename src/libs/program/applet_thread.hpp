@@ -0,0 +1,43 @@
+#pragma once
+
+#include "applet_registry.hpp"
+#include "system/argument_list.hpp"
+#include "system/pipe.hpp"
+#include "utility/maybe.hpp"
+#include <exception>
+#include <thread>
+
+namespace gorc {
+
+    // Runs an applet on a separate thread, with its standard streams redirected
+    // to pipes. The interface mirrors gorc::process.
+    //
+    // Standard streams and log backends are shared by the whole process, so
+    // applets are run one at a time. The applet is given a fresh log
+    // configuration, and the caller's configuration is restored afterward.
+    class applet_thread {
+    private:
+        maybe<gorc::pipe*> std_input;
+        maybe<gorc::pipe*> std_output;
+        maybe<gorc::pipe*> std_error;
+
+        std::thread thread;
+        int exit_code = 0;
+        std::exception_ptr exception;
+
+        void internal_run(applet_factory const &factory,
+                          argument_list const &args);
+        void internal_close_child_ends();
+
+    public:
+        applet_thread(applet_factory const &factory,
+                      argument_list const &args,
+                      maybe<gorc::pipe*> std_input,
+                      maybe<gorc::pipe*> std_output,
+                      maybe<gorc::pipe*> std_error);
+
+        ~applet_thread();
+        int join();
+    };
+
+}
@@ -40,6 +40,11 @@ gorc::program::program()
         });
 }
 
+gorc::program::~program()
+{
+    return;
+}
+
 int gorc::program::start(range<char**> const &args)
 {
     try {
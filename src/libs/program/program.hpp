@@ -15,6 +15,8 @@ namespace gorc {
 
     public:
         program();
+        virtual ~program();
+
         int start(range<char**> const &);
     };
 
@@ -25,3 +27,9 @@ int main(int argc, char **argv) {
     ProgramT program;                                                                   \
     return program.start(gorc::make_range(argv + 1, argv + argc));                      \
 }
+
+#define MAKE_FACTORY_MAIN(FactoryFn)                                                    \
+int main(int argc, char **argv) {                                                       \
+    auto program = FactoryFn();                                                         \
+    return program->start(gorc::make_range(argv + 1, argv + argc));                     \
+}
@@ -4,20 +4,133 @@
 #include <unistd.h>
 #include <sys/wait.h>
 #include <sys/types.h>
+#include <signal.h>
+#include <spawn.h>
 #include <system_error>
 #include <iostream>
+#include <thread>
+#include <algorithm>
 #include <boost/filesystem.hpp>
 
+extern char **environ;
+
+// posix_spawn can only change the working directory of the child through a
+// glibc extension. Other platforms fall back to fork and exec for that case.
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+#define GORC_HAS_SPAWN_CHDIR
+#endif
+
 gorc::process::process(path const &executable,
                        argument_list const &args,
                        maybe<gorc::pipe*> std_input,
                        maybe<gorc::pipe*> std_output,
                        maybe<gorc::pipe*> std_error,
-                       maybe<path> working_directory)
+                       maybe<path> working_directory,
+                       bool new_process_group)
     : std_input(std_input)
     , std_output(std_output)
     , std_error(std_error)
     , working_directory(working_directory)
+    , new_process_group(new_process_group)
+{
+    std::string prog_finalname = executable.filename().string();
+
+    std::vector<std::string> arg_storage(args.begin(), args.end());
+    std::vector<char *> finalargs;
+    finalargs.push_back(&prog_finalname[0]);
+    for(auto &arg : arg_storage) {
+        finalargs.push_back(&arg[0]);
+    }
+
+    finalargs.push_back(nullptr);
+
+#ifndef GORC_HAS_SPAWN_CHDIR
+    if(working_directory.has_value()) {
+        internal_fork_exec(executable, finalargs);
+        return;
+    }
+#endif
+
+    internal_spawn(executable, finalargs);
+}
+
+void gorc::process::internal_spawn(path const &executable,
+                                   std::vector<char *> const &args)
+{
+    // Pipe descriptors are opened close-on-exec. Duplicating them onto the
+    // standard streams clears the flag for the child's copy only.
+    ::posix_spawn_file_actions_t file_actions;
+    ::posix_spawn_file_actions_init(&file_actions);
+
+    if(std_input.has_value()) {
+        ::posix_spawn_file_actions_adddup2(&file_actions,
+                                           std_input.get_value()->get_input().fd,
+                                           STDIN_FILENO);
+    }
+
+    if(std_output.has_value()) {
+        ::posix_spawn_file_actions_adddup2(&file_actions,
+                                           std_output.get_value()->get_output().fd,
+                                           STDOUT_FILENO);
+    }
+
+    if(std_error.has_value()) {
+        ::posix_spawn_file_actions_adddup2(&file_actions,
+                                           std_error.get_value()->get_output().fd,
+                                           STDERR_FILENO);
+    }
+
+    std::string working_directory_name;
+    if(working_directory.has_value()) {
+        working_directory_name = working_directory.get_value().native();
+#ifdef GORC_HAS_SPAWN_CHDIR
+        ::posix_spawn_file_actions_addchdir_np(&file_actions, working_directory_name.c_str());
+#endif
+    }
+
+    ::posix_spawnattr_t attributes;
+    ::posix_spawnattr_init(&attributes);
+
+    if(new_process_group) {
+        ::posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+        ::posix_spawnattr_setpgroup(&attributes, 0);
+    }
+
+    std::string prog_name = executable.string();
+
+    ::pid_t child_pid = 0;
+    int result = ::posix_spawnp(&child_pid,
+                                prog_name.c_str(),
+                                &file_actions,
+                                &attributes,
+                                args.data(),
+                                environ);
+
+    ::posix_spawnattr_destroy(&attributes);
+    ::posix_spawn_file_actions_destroy(&file_actions);
+
+    if(result == 0) {
+        internal_inside_parent(child_pid);
+        return;
+    }
+
+    // The executable could not be started. Report the error where the child's
+    // own error output would have gone, and behave as if it exited with 126.
+    std::string message = str(format("[ERROR] Cannot execute: %s\n") %
+                              std::generic_category().message(result));
+    if(std_error.has_value()) {
+        std_error.get_value()->get_output().write(message.data(), message.size());
+    }
+    else {
+        std::cerr << message << std::flush;
+    }
+
+    spawn_failure_exit_code = 126;
+    internal_close_child_ends();
+}
+
+void gorc::process::internal_fork_exec(path const &executable,
+                                       std::vector<char *> const &args)
 {
     // LCOV_EXCL_START
     // Not much hope capturing coverage between fork-exec
@@ -28,18 +141,7 @@ gorc::process::process(path const &executable,
 
     if(result == 0) {
         // Inside child process
-        std::string prog_finalname = executable.filename().string();
-
-        // Child address space will be wiped out by exec()
-        // Don't need to free arguments.
-        std::vector<char *> finalargs;
-        finalargs.push_back(&prog_finalname[0]);
-        for(auto const &arg : args) {
-            finalargs.push_back(::strdup(arg.c_str()));
-        }
-
-        finalargs.push_back(nullptr);
-        internal_inside_child(executable, finalargs);
+        internal_inside_child(executable, args);
     }
     else {
         // Inside parent process
@@ -84,6 +186,10 @@ void gorc::process::internal_inside_child(path const &executable,
                                           std::vector<char *> const &args)
 {
     // Inside child.
+    if(new_process_group) {
+        ::setpgid(0, 0);
+    }
+
     // Close parent ends of pipes.
     // Redirect and close original pipes.
 
@@ -125,6 +231,17 @@ void gorc::process::internal_inside_parent(::pid_t child_pid)
 {
     pid = child_pid;
 
+    // Also set the process group from the parent, so that it is in place before
+    // the parent can try to signal it.
+    if(new_process_group) {
+        ::setpgid(child_pid, child_pid);
+    }
+
+    internal_close_child_ends();
+}
+
+void gorc::process::internal_close_child_ends()
+{
     // Close child ends of pipe
     if(std_input.has_value()) {
         std_input.get_value()->close_input();
@@ -139,8 +256,34 @@ void gorc::process::internal_inside_parent(::pid_t child_pid)
     }
 }
 
+int gorc::process::internal_retire(int status)
+{
+    pid = nothing;
+
+    if(WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    }
+    // LCOV_EXCL_START
+    else if(WIFSIGNALED(status)) {
+        LOG_ERROR(format("process terminated with signal: %s") %
+                  strsignal(WTERMSIG(status)));
+        return 128 + WTERMSIG(status);
+    }
+    else {
+        LOG_ERROR("process terminated abnormally");
+        return 1;
+    }
+    // LCOV_EXCL_STOP
+}
+
 int gorc::process::join()
 {
+    if(spawn_failure_exit_code.has_value()) {
+        int rv = spawn_failure_exit_code.get_value();
+        spawn_failure_exit_code = nothing;
+        return rv;
+    }
+
     if(pid.has_value()) {
         int status = 0;
         pid_t result = -1;
@@ -156,24 +299,66 @@ int gorc::process::join()
         }
         // LCOV_EXCL_STOP
 
-        pid = nothing;
+        return internal_retire(status);
+    }
+    else {
+        throw std::logic_error("no process");
+    }
+}
+
+gorc::maybe<int> gorc::process::join_for(std::chrono::milliseconds timeout)
+{
+    if(spawn_failure_exit_code.has_value()) {
+        return join();
+    }
+
+    if(!pid.has_value()) {
+        throw std::logic_error("no process");
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto poll_interval = std::chrono::milliseconds(1);
+
+    while(true) {
+        int status = 0;
+        pid_t result = -1;
+
+        do {
+            result = ::waitpid(pid.get_value(), &status, WNOHANG);
+        } while(result < 0 && errno == EINTR);
 
-        if(WIFEXITED(status)) {
-            return WEXITSTATUS(status);
-        }
         // LCOV_EXCL_START
-        else if(WIFSIGNALED(status)) {
-            LOG_ERROR(format("process terminated with signal: %s") %
-                      strsignal(WTERMSIG(status)));
-            return 128 + WTERMSIG(status);
-        }
-        else {
-            LOG_ERROR("process terminated abnormally");
-            return 1;
+        if(result < 0) {
+            throw std::system_error(errno, std::generic_category());
         }
         // LCOV_EXCL_STOP
+
+        if(result != 0) {
+            return internal_retire(status);
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if(now >= deadline) {
+            return nothing;
+        }
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+        std::this_thread::sleep_for(std::min(poll_interval, remaining));
+        poll_interval = std::min(poll_interval * 2, std::chrono::milliseconds(100));
     }
-    else {
+}
+
+void gorc::process::kill()
+{
+    if(spawn_failure_exit_code.has_value()) {
+        // Never started
+        return;
+    }
+
+    if(!pid.has_value()) {
         throw std::logic_error("no process");
     }
+
+    ::pid_t target = new_process_group ? -pid.get_value() : pid.get_value();
+    ::kill(target, SIGKILL);
 }
@@ -6,6 +6,7 @@
 #include <unistd.h>
 #include <system_error>
 #include <iostream>
+#include <chrono>
 #include "utility/maybe.hpp"
 #include "pipe.hpp"
 #include "io/path.hpp"
@@ -16,14 +17,24 @@ namespace gorc {
     class process {
     private:
         maybe<::pid_t> pid;
+        maybe<int> spawn_failure_exit_code;
         maybe<gorc::pipe*> std_input;
         maybe<gorc::pipe*> std_output;
         maybe<gorc::pipe*> std_error;
         maybe<path> working_directory;
+        bool new_process_group;
+
+        void internal_spawn(path const &executable,
+                            std::vector<char *> const &arguments);
+        void internal_fork_exec(path const &executable,
+                                std::vector<char *> const &arguments);
 
         void internal_inside_parent(::pid_t child_pid);
         void internal_inside_child(path const &executable,
                                    std::vector<char *> const &arguments);
+        void internal_close_child_ends();
+
+        int internal_retire(int status);
 
     public:
         process(path const &executable,
@@ -31,10 +42,19 @@ namespace gorc {
                 maybe<gorc::pipe*> std_input,
                 maybe<gorc::pipe*> std_output,
                 maybe<gorc::pipe*> std_error,
-                maybe<path> working_directory = nothing);
+                maybe<path> working_directory = nothing,
+                bool new_process_group = false);
 
         ~process();
         int join();
+
+        // Waits at most timeout for the process to exit.
+        // Returns nothing if the process is still running.
+        maybe<int> join_for(std::chrono::milliseconds timeout);
+
+        // Forcibly terminates the process. When the process was started in a new
+        // process group, all of its descendants in the group are terminated too.
+        void kill();
     };
 
 }
@@ -11,12 +11,14 @@ public:
     std::vector<std::string> extra_args;
     bool no_join = false;
     bool double_join = false;
+    int timeout_ms = 0;
 
     virtual void create_options(gorc::options &opts) override
     {
         opts.insert(gorc::make_value_option("run", prog_to_run));
         opts.insert(gorc::make_switch_option("no-join", no_join));
         opts.insert(gorc::make_switch_option("double-join", double_join));
+        opts.insert(gorc::make_value_option("timeout-ms", timeout_ms));
         opts.insert(gorc::make_multi_value_option("extra", std::back_inserter(extra_args)));
         opts.emplace_constraint<gorc::required_option>("run");
     }
@@ -40,13 +42,27 @@ public:
                             extra_args,
                             &std_input,
                             &std_output,
-                            &std_error);
+                            &std_error,
+                            gorc::nothing,
+                            /* new process group */ timeout_ms > 0);
 
         std_input_stream.copy_to(std_input.get_output());
         std_input.set_reusable(false);
         std_input.close_output();
         std_input.close_input();
 
+        if(timeout_ms > 0) {
+            auto child_result = child.join_for(std::chrono::milliseconds(timeout_ms));
+            if(!child_result.has_value()) {
+                std::cout << "= timed out" << std::endl;
+                child.kill();
+                child_result = child.join();
+            }
+
+            std::cout << "= exit code " << child_result.get_value() << std::endl;
+            return EXIT_SUCCESS;
+        }
+
         std::cout << "==== stdout ====" << std::endl;
         std_output.get_input().copy_to(std_output_stream);
         std::cout << std::endl;
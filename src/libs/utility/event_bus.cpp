@@ -1,4 +1,5 @@
 #include "event_bus.hpp"
+#include <atomic>
 
 gorc::abstract_delegate_container::~abstract_delegate_container()
 {
@@ -7,11 +8,11 @@ gorc::abstract_delegate_container::~abstract_delegate_container()
 
 gorc::scoped_delegate::scoped_delegate(abstract_delegate_container *observer,
                                        size_t id,
-                                       bool is_const)
+                                       delegate_kind kind)
     : should_unregister(true)
     , observer(observer)
     , id(id)
-    , is_const(is_const)
+    , kind(kind)
 {
     return;
 }
@@ -20,7 +21,7 @@ void gorc::scoped_delegate::unregister()
 {
     if(should_unregister) {
         should_unregister = false;
-        observer->unregister(id, is_const);
+        observer->unregister(id, kind);
     }
 }
 
@@ -28,7 +29,7 @@ gorc::scoped_delegate::scoped_delegate(scoped_delegate &&other)
     : should_unregister(true)
     , observer(other.observer)
     , id(other.id)
-    , is_const(other.is_const)
+    , kind(other.kind)
 {
     other.should_unregister = false;
     return;
@@ -46,7 +47,31 @@ gorc::scoped_delegate& gorc::scoped_delegate::operator=(scoped_delegate &&other)
     should_unregister = other.should_unregister;
     observer = other.observer;
     id = other.id;
-    is_const = other.is_const;
+    kind = other.kind;
     other.should_unregister = false;
     return *this;
 }
+
+size_t gorc::detail::next_event_type_slot()
+{
+    static std::atomic<size_t> next_slot(0);
+    return next_slot++;
+}
+
+void gorc::event_bus::dispatch_queued_events()
+{
+    if(dispatching_queue) {
+        // Events queued by a handler are picked up by the outer dispatch loop.
+        return;
+    }
+
+    auto dispatching_queue_guard = make_scoped_assignment(dispatching_queue, true);
+
+    while(!pending_containers.empty()) {
+        dispatching_containers.clear();
+        std::swap(pending_containers, dispatching_containers);
+        for(auto *container : dispatching_containers) {
+            container->dispatch_queued_events();
+        }
+    }
+}
@@ -1,22 +1,30 @@
 #pragma once
 
-#include <typeindex>
-#include <unordered_map>
-#include <functional>
+#include <deque>
+#include <typeinfo>
 #include <vector>
 #include <memory>
 #include <type_traits>
 #include <stdexcept>
 #include "maybe.hpp"
 #include "scoped_assignment.hpp"
+#include "small_function.hpp"
+#include "span.hpp"
 #include "strcat.hpp"
 
 namespace gorc {
 
+    enum class delegate_kind {
+        normal,
+        constant,
+        batch
+    };
+
     class abstract_delegate_container {
     public:
         virtual ~abstract_delegate_container();
-        virtual void unregister(size_t id, bool is_const) = 0;
+        virtual void unregister(size_t id, delegate_kind kind) = 0;
+        virtual void dispatch_queued_events() = 0;
     };
 
     class scoped_delegate {
@@ -24,12 +32,12 @@ namespace gorc {
         bool should_unregister;
         abstract_delegate_container *observer;
         size_t id;
-        bool is_const;
+        delegate_kind kind;
 
         void unregister();
 
     public:
-        scoped_delegate(abstract_delegate_container *, size_t, bool);
+        scoped_delegate(abstract_delegate_container *, size_t, delegate_kind);
         scoped_delegate(scoped_delegate const &) = delete;
         scoped_delegate(scoped_delegate &&);
         ~scoped_delegate();
@@ -38,58 +46,113 @@ namespace gorc {
         scoped_delegate& operator=(scoped_delegate&&);
     };
 
+    namespace detail {
+        size_t next_event_type_slot();
+
+        // Dense per-type index into the event bus handler table. Assigned once,
+        // on first use of the event type.
+        template <typename T>
+        size_t event_type_slot()
+        {
+            static size_t const slot = next_event_type_slot();
+            return slot;
+        }
+
+        template <typename FnT, typename ArgT, typename = void>
+        class is_callable_with : public std::false_type { };
+
+        template <typename FnT, typename ArgT>
+        class is_callable_with<FnT,
+                               ArgT,
+                               decltype(std::declval<FnT&>()(std::declval<ArgT>()), void())>
+            : public std::true_type { };
+    }
+
     class event_bus {
     private:
         template <typename T>
         class delegate_container : public abstract_delegate_container {
         private:
             bool caller_inside = false;
-            std::vector<maybe<std::function<void(T&)>>> handlers;
-            std::vector<maybe<std::function<void(T const &)>>> const_handlers;
+
+            // Deques keep existing handlers in place when a handler registers
+            // another handler while being invoked.
+            std::deque<small_function<void(T&)>> handlers;
+            std::deque<small_function<void(T const &)>> const_handlers;
+            std::deque<small_function<void(span<T const>)>> batch_handlers;
+
+            std::vector<T> queued_events;
+            std::vector<T> dispatching_events;
 
             template <typename FnT, typename FnVecT>
-            scoped_delegate insert_internal(FnT fn, FnVecT &vec, bool is_const)
+            scoped_delegate insert_internal(FnT &&fn, FnVecT &vec, delegate_kind kind)
             {
                 if(!caller_inside) {
                     // Use space-efficient, non-reentrant registration
                     for(size_t i = 0; i < vec.size(); ++i) {
                         auto &em = vec[i];
-                        if(!em.has_value()) {
-                            em = fn;
-                            return scoped_delegate(this, i, is_const);
+                        if(!em) {
+                            em = std::forward<FnT>(fn);
+                            return scoped_delegate(this, i, kind);
                         }
                     }
                 }
 
                 // Fall back to space-inefficient but reentrant registration
                 size_t next_id = vec.size();
-                vec.push_back(fn);
-                return scoped_delegate(this, next_id, is_const);
+                vec.emplace_back(std::forward<FnT>(fn));
+                return scoped_delegate(this, next_id, kind);
+            }
+
+            template <typename FnT>
+            scoped_delegate insert(FnT &&fn, std::true_type /* accepts const */)
+            {
+                return insert_internal(std::forward<FnT>(fn), const_handlers, delegate_kind::constant);
+            }
+
+            template <typename FnT>
+            scoped_delegate insert(FnT &&fn, std::false_type /* accepts const */)
+            {
+                return insert_internal(std::forward<FnT>(fn), handlers, delegate_kind::normal);
             }
 
         public:
-            virtual void unregister(size_t id, bool is_const) override
+            bool is_pending = false;
+
+            virtual void unregister(size_t id, delegate_kind kind) override
             {
-                if(is_const) {
+                switch(kind) {
+                case delegate_kind::normal:
+                    if(id < handlers.size()) {
+                        handlers[id] = {};
+                    }
+                    break;
+
+                case delegate_kind::constant:
                     if(id < const_handlers.size()) {
-                        const_handlers[id] = nothing;
+                        const_handlers[id] = {};
                     }
-                }
-                else {
-                    if(id < handlers.size()) {
-                        handlers[id] = nothing;
+                    break;
+
+                case delegate_kind::batch:
+                    if(id < batch_handlers.size()) {
+                        batch_handlers[id] = {};
                     }
+                    break;
                 }
             }
 
-            scoped_delegate insert(std::function<void(T&)> fn)
+            template <typename FnT>
+            scoped_delegate insert(FnT &&fn)
             {
-                return insert_internal(fn, handlers, false);
+                return insert(std::forward<FnT>(fn),
+                              detail::is_callable_with<std::decay_t<FnT>, T const &>());
             }
 
-            scoped_delegate insert(std::function<void(T const &)> fn)
+            template <typename FnT>
+            scoped_delegate insert_batch(FnT &&fn)
             {
-                return insert_internal(fn, const_handlers, true);
+                return insert_internal(std::forward<FnT>(fn), batch_handlers, delegate_kind::batch);
             }
 
             void dispatch_event(T &event)
@@ -99,16 +162,16 @@ namespace gorc {
                 // Dispatch to normal handlers
                 for(size_t i = 0; i < handlers.size(); ++i) {
                     auto &handler = handlers[i];
-                    if(handler.has_value()) {
-                        handler.get_value()(event);
+                    if(handler) {
+                        handler(event);
                     }
                 }
 
                 // Dispatch to const handlers
                 for(size_t i = 0; i < const_handlers.size(); ++i) {
                     auto &handler = const_handlers[i];
-                    if(handler.has_value()) {
-                        handler.get_value()(event);
+                    if(handler) {
+                        handler(event);
                     }
                 }
             }
@@ -125,25 +188,63 @@ namespace gorc {
 
                 for(size_t i = 0; i < const_handlers.size(); ++i) {
                     auto &handler = const_handlers[i];
-                    if(handler.has_value()) {
-                        handler.get_value()(event);
+                    if(handler) {
+                        handler(event);
                     }
                 }
             }
+
+            void queue_event(T const &event)
+            {
+                queued_events.push_back(event);
+            }
+
+            virtual void dispatch_queued_events() override
+            {
+                is_pending = false;
+
+                // Events queued by handlers during dispatch are delivered by the
+                // next pass of event_bus::dispatch_queued_events.
+                dispatching_events.clear();
+                std::swap(queued_events, dispatching_events);
+
+                {
+                    auto caller_inside_guard = make_scoped_assignment(caller_inside, true);
+                    span<T const> batch(dispatching_events.data(), dispatching_events.size());
+                    for(size_t i = 0; i < batch_handlers.size(); ++i) {
+                        auto &handler = batch_handlers[i];
+                        if(handler) {
+                            handler(batch);
+                        }
+                    }
+                }
+
+                for(auto &event : dispatching_events) {
+                    dispatch_event(event);
+                }
+            }
         };
 
-        std::unordered_map<std::type_index, std::unique_ptr<abstract_delegate_container>> handlers;
+        std::vector<std::unique_ptr<abstract_delegate_container>> handlers;
+
+        bool dispatching_queue = false;
+        std::vector<abstract_delegate_container*> pending_containers;
+        std::vector<abstract_delegate_container*> dispatching_containers;
 
         template <typename T, typename RealT = typename std::decay<T>::type>
         delegate_container<RealT>& get_handler()
         {
-            auto it = handlers.find(typeid(RealT));
-            if(it == handlers.end()) {
-                it = handlers.emplace(typeid(RealT),
-                                      std::make_unique<delegate_container<RealT>>()).first;
+            size_t slot = detail::event_type_slot<RealT>();
+            if(slot >= handlers.size()) {
+                handlers.resize(slot + 1);
             }
 
-            return *reinterpret_cast<delegate_container<RealT>*>(it->second.get());
+            auto &container = handlers[slot];
+            if(!container) {
+                container = std::make_unique<delegate_container<RealT>>();
+            }
+
+            return *static_cast<delegate_container<RealT>*>(container.get());
         }
 
     public:
@@ -159,16 +260,36 @@ namespace gorc {
             get_handler<T>().dispatch_event(event);
         }
 
+        // Defers delivery of the event until the next call to
+        // dispatch_queued_events. Queued events are delivered in batches, grouped
+        // by type in the order each type was first queued.
         template <typename T>
-        scoped_delegate add_handler(std::function<void(T&)> handler)
+        void queue_event(T const &event)
         {
-            return get_handler<T>().insert(handler);
+            auto &container = get_handler<T>();
+            container.queue_event(event);
+            if(!container.is_pending) {
+                container.is_pending = true;
+                pending_containers.push_back(&container);
+            }
         }
 
-        template <typename T>
-        scoped_delegate add_handler(std::function<void(T const &)> handler)
+        void dispatch_queued_events();
+
+        // Registers a handler for events of type T. Handlers accepting T const &
+        // are invoked for both constant and non-constant events.
+        template <typename T, typename FnT>
+        scoped_delegate add_handler(FnT &&handler)
+        {
+            return get_handler<T>().insert(std::forward<FnT>(handler));
+        }
+
+        // Registers a handler which receives all queued events of type T in a
+        // single call, before they are delivered to individual handlers.
+        template <typename T, typename FnT>
+        scoped_delegate add_batch_handler(FnT &&handler)
         {
-            return get_handler<T>().insert(handler);
+            return get_handler<T>().insert_batch(std::forward<FnT>(handler));
         }
     };
 
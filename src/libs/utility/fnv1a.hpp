@@ -0,0 +1,27 @@
+#pragma once
+
+#include "span.hpp"
+#include <cstdint>
+
+namespace gorc {
+
+    // 64-bit FNV-1a. Suitable for content fingerprints, not for security.
+    constexpr uint64_t fnv1a_offset_basis = 0xCBF29CE484222325ULL;
+
+    inline uint64_t fnv1a_hash(void const *data, size_t size, uint64_t hash = fnv1a_offset_basis)
+    {
+        auto const *bytes = static_cast<unsigned char const*>(data);
+        for(size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ULL;
+        }
+
+        return hash;
+    }
+
+    template <typename T>
+    uint64_t fnv1a_hash(span<T const> data, uint64_t hash = fnv1a_offset_basis)
+    {
+        return fnv1a_hash(data.data(), data.size() * sizeof(T), hash);
+    }
+}
@@ -1,7 +1,23 @@
 #include "service_registry.hpp"
+#include <atomic>
+
+size_t gorc::detail::next_service_slot()
+{
+    static std::atomic<size_t> next_slot(0);
+    return next_slot++;
+}
 
 gorc::service_registry::service_registry(maybe<service_registry const*> parent)
     : parent(parent)
 {
     return;
 }
+
+void *&gorc::service_registry::emplace_slot(size_t slot)
+{
+    if(slot >= services.size()) {
+        services.resize(slot + 1, nullptr);
+    }
+
+    return services[slot];
+}
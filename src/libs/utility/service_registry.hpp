@@ -5,14 +5,34 @@
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
-#include <typeindex>
-#include <unordered_map>
+#include <typeinfo>
+#include <vector>
 
 namespace gorc {
+    namespace detail {
+        size_t next_service_slot();
+
+        // Each service type is assigned a slot index the first time it is
+        // used, so registry lookups index a vector instead of hashing.
+        template <typename ServiceT>
+        size_t get_service_slot()
+        {
+            static size_t const slot = next_service_slot();
+            return slot;
+        }
+    }
+
     class service_registry {
     private:
         maybe<service_registry const *> parent;
-        std::unordered_map<std::type_index, void *> services;
+        std::vector<void *> services;
+
+        void *&emplace_slot(size_t slot);
+
+        void *find_slot(size_t slot) const
+        {
+            return (slot < services.size()) ? services[slot] : nullptr;
+        }
 
     public:
         explicit service_registry(maybe<service_registry const *> parent = nothing);
@@ -21,30 +41,29 @@ namespace gorc {
         void add(ServiceT &svc)
         {
             using BaseServiceT = typename std::decay<ServiceT>::type;
-            std::type_index tid = typeid(BaseServiceT);
-            bool rv = services.emplace(tid, reinterpret_cast<void *>(&svc)).second;
-            if(!rv) {
+            void *&em = emplace_slot(detail::get_service_slot<BaseServiceT>());
+            if(em) {
                 throw std::runtime_error(strcat(
                     "service_registry::add service ", typeid(ServiceT).name(), " multiple times"));
             }
+
+            em = reinterpret_cast<void *>(&svc);
         }
 
         template <typename ServiceT>
         void add_or_replace(ServiceT &svc)
         {
             using BaseServiceT = typename std::decay<ServiceT>::type;
-            std::type_index tid = typeid(BaseServiceT);
-            services[tid] = reinterpret_cast<void *>(&svc);
+            emplace_slot(detail::get_service_slot<BaseServiceT>()) = reinterpret_cast<void *>(&svc);
         }
 
         template <typename ServiceT>
         ServiceT &get() const
         {
             using BaseServiceT = typename std::decay<ServiceT>::type;
-            std::type_index tid = typeid(BaseServiceT);
-            auto it = services.find(tid);
-            if(it != services.end()) {
-                return *reinterpret_cast<ServiceT *>(it->second);
+            void *svc = find_slot(detail::get_service_slot<BaseServiceT>());
+            if(svc) {
+                return *reinterpret_cast<ServiceT *>(svc);
             }
             else if(parent.has_value()) {
                 return parent.get_value()->get<ServiceT>();
@@ -59,9 +78,7 @@ namespace gorc {
         bool has() const
         {
             using BaseServiceT = typename std::decay<ServiceT>::type;
-            std::type_index tid = typeid(BaseServiceT);
-            auto it = services.find(tid);
-            if(it != services.end()) {
+            if(find_slot(detail::get_service_slot<BaseServiceT>())) {
                 return true;
             }
             else if(parent.has_value()) {
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace gorc {
+
+    // Move-only type-erased callable. Callables no larger than BufferSize are
+    // stored inline, so constructing a small_function from a typical lambda does
+    // not allocate. Larger callables are moved to the heap.
+    template <typename SigT, size_t BufferSize = 4 * sizeof(void*)>
+    class small_function;
+
+    template <typename RetT, typename ...ArgT, size_t BufferSize>
+    class small_function<RetT(ArgT...), BufferSize> {
+    private:
+        using storage_type = std::aligned_storage_t<BufferSize, alignof(std::max_align_t)>;
+
+        class operations {
+        public:
+            RetT (*invoke)(void *, ArgT...);
+            void (*move)(void *, void *);
+            void (*destroy)(void *);
+        };
+
+        template <typename FnT>
+        static constexpr bool is_stored_inline()
+        {
+            return sizeof(FnT) <= BufferSize &&
+                   alignof(FnT) <= alignof(storage_type) &&
+                   std::is_nothrow_move_constructible<FnT>::value;
+        }
+
+        template <typename FnT>
+        class inline_operations {
+        public:
+            static RetT invoke(void *data, ArgT... args)
+            {
+                return (*reinterpret_cast<FnT*>(data))(std::forward<ArgT>(args)...);
+            }
+
+            static void move(void *dest, void *src)
+            {
+                new(dest) FnT(std::move(*reinterpret_cast<FnT*>(src)));
+                reinterpret_cast<FnT*>(src)->~FnT();
+            }
+
+            static void destroy(void *data)
+            {
+                reinterpret_cast<FnT*>(data)->~FnT();
+            }
+
+            static operations const* get()
+            {
+                static constexpr operations ops { &invoke, &move, &destroy };
+                return &ops;
+            }
+        };
+
+        template <typename FnT>
+        class heap_operations {
+        public:
+            static RetT invoke(void *data, ArgT... args)
+            {
+                return (**reinterpret_cast<FnT**>(data))(std::forward<ArgT>(args)...);
+            }
+
+            static void move(void *dest, void *src)
+            {
+                new(dest) FnT*(*reinterpret_cast<FnT**>(src));
+            }
+
+            static void destroy(void *data)
+            {
+                delete *reinterpret_cast<FnT**>(data);
+            }
+
+            static operations const* get()
+            {
+                static constexpr operations ops { &invoke, &move, &destroy };
+                return &ops;
+            }
+        };
+
+        storage_type storage;
+        operations const *ops = nullptr;
+
+        void reset()
+        {
+            if(ops) {
+                ops->destroy(&storage);
+                ops = nullptr;
+            }
+        }
+
+    public:
+        small_function()
+        {
+            return;
+        }
+
+        template <typename FnT,
+                  typename DecayFnT = std::decay_t<FnT>,
+                  typename = std::enable_if_t<!std::is_same<DecayFnT, small_function>::value>>
+        small_function(FnT &&fn)
+        {
+            emplace<DecayFnT>(std::integral_constant<bool, is_stored_inline<DecayFnT>()>(),
+                              std::forward<FnT>(fn));
+        }
+
+        small_function(small_function &&other)
+            : ops(other.ops)
+        {
+            if(ops) {
+                ops->move(&storage, &other.storage);
+                other.ops = nullptr;
+            }
+        }
+
+        small_function(small_function const &) = delete;
+
+        ~small_function()
+        {
+            reset();
+        }
+
+        small_function& operator=(small_function &&other)
+        {
+            if(this != &other) {
+                reset();
+                if(other.ops) {
+                    other.ops->move(&storage, &other.storage);
+                    ops = other.ops;
+                    other.ops = nullptr;
+                }
+            }
+
+            return *this;
+        }
+
+        small_function& operator=(small_function const &) = delete;
+
+        explicit operator bool() const
+        {
+            return ops != nullptr;
+        }
+
+        RetT operator()(ArgT... args) const
+        {
+            return ops->invoke(const_cast<storage_type*>(&storage), std::forward<ArgT>(args)...);
+        }
+
+    private:
+        template <typename FnT, typename ValueT>
+        void emplace(std::true_type, ValueT &&fn)
+        {
+            new(&storage) FnT(std::forward<ValueT>(fn));
+            ops = inline_operations<FnT>::get();
+        }
+
+        template <typename FnT, typename ValueT>
+        void emplace(std::false_type, ValueT &&fn)
+        {
+            new(&storage) FnT*(new FnT(std::forward<ValueT>(fn)));
+            ops = heap_operations<FnT>::get();
+        }
+    };
+
+}
@@ -9,3 +9,18 @@ char const* gorc::string_view::end() const
 {
     return last;
 }
+
+char const* gorc::string_view::data() const
+{
+    return first;
+}
+
+size_t gorc::string_view::size() const
+{
+    return static_cast<size_t>(last - first);
+}
+
+bool gorc::string_view::empty() const
+{
+    return first == last;
+}
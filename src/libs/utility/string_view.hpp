@@ -10,14 +10,30 @@ namespace gorc {
         char const *last;
 
     public:
+        inline constexpr string_view()
+            : first(nullptr)
+            , last(nullptr)
+        {
+        }
+
         inline constexpr string_view(char const *str, size_t len)
             : first(str)
             , last(str + len)
         {
         }
 
+        inline constexpr string_view(char const *first, char const *last)
+            : first(first)
+            , last(last)
+        {
+        }
+
         char const* begin() const;
         char const* end() const;
+
+        char const* data() const;
+        size_t size() const;
+        bool empty() const;
     };
 
     inline constexpr string_view operator"" _sv(char const *str, size_t len)
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace gorc {
+
+    // Lock-free handoff of whole values from one producer thread to one
+    // consumer thread. The producer fills back() and calls publish(). The
+    // consumer calls update() and then reads front(). Neither side ever waits,
+    // and the consumer always sees the most recently published value.
+    template <typename T>
+    class triple_buffer {
+    private:
+        // The middle slot index, plus a flag set when it holds a value the
+        // consumer has not yet taken.
+        static constexpr unsigned int fresh_bit = 4U;
+        static constexpr unsigned int index_mask = 3U;
+
+        std::array<T, 3> buffers;
+        unsigned int back_index = 0;
+        std::atomic<unsigned int> middle_state;
+        unsigned int front_index = 2;
+
+    public:
+        triple_buffer()
+            : middle_state(1)
+        {
+        }
+
+        triple_buffer(triple_buffer const &) = delete;
+        triple_buffer &operator=(triple_buffer const &) = delete;
+
+        // Producer side
+        T &back()
+        {
+            return buffers[back_index];
+        }
+
+        void publish()
+        {
+            unsigned int prev = middle_state.exchange(back_index | fresh_bit,
+                                                      std::memory_order_acq_rel);
+            back_index = prev & index_mask;
+        }
+
+        // Consumer side. Returns true when a new value has been published
+        // since the last call.
+        bool update()
+        {
+            if(!(middle_state.load(std::memory_order_relaxed) & fresh_bit)) {
+                return false;
+            }
+
+            unsigned int prev = middle_state.exchange(front_index, std::memory_order_acq_rel);
+            front_index = prev & index_mask;
+            return true;
+        }
+
+        T &front()
+        {
+            return buffers[front_index];
+        }
+
+        T const &front() const
+        {
+            return buffers[front_index];
+        }
+    };
+
+}
@@ -232,4 +232,82 @@ test_case(scoped_delegate_overwrite)
     assert_log_empty();
 }
 
+test_case(queued_events_deferred)
+{
+    event_bus bus;
+
+    auto handler = bus.add_handler<mock_event>([](auto const &e) {
+            LOG_INFO(format("handler: %d") % e.value);
+        });
+
+    bus.queue_event(mock_event(1));
+    bus.queue_event(mock_event(2));
+
+    assert_log_empty();
+
+    bus.dispatch_queued_events();
+
+    assert_log_message(log_level::info, "handler: 1");
+    assert_log_message(log_level::info, "handler: 2");
+    assert_log_empty();
+
+    bus.dispatch_queued_events();
+
+    assert_log_empty();
+}
+
+test_case(batch_handler_receives_all_queued)
+{
+    event_bus bus;
+
+    auto batch = bus.add_batch_handler<mock_event>([](span<mock_event const> events) {
+            int sum = 0;
+            for(auto const &e : events) {
+                sum += e.value;
+            }
+
+            LOG_INFO(format("batch: %d events, sum %d") % events.size() % sum);
+        });
+
+    auto handler = bus.add_handler<mock_event>([](auto const &e) {
+            LOG_INFO(format("handler: %d") % e.value);
+        });
+
+    bus.queue_event(mock_event(3));
+    bus.queue_event(mock_event(4));
+    bus.queue_event(mock_event(5));
+    bus.dispatch_queued_events();
+
+    assert_log_message(log_level::info, "batch: 3 events, sum 12");
+    assert_log_message(log_level::info, "handler: 3");
+    assert_log_message(log_level::info, "handler: 4");
+    assert_log_message(log_level::info, "handler: 5");
+    assert_log_empty();
+
+    bus.fire_event(mock_event(6));
+
+    assert_log_message(log_level::info, "handler: 6");
+    assert_log_empty();
+}
+
+test_case(queued_from_handler_dispatched_same_pass)
+{
+    event_bus bus;
+
+    auto handler = bus.add_handler<mock_event>([&](auto const &e) {
+            LOG_INFO(format("handler: %d") % e.value);
+            if(e.value > 0) {
+                bus.queue_event(mock_event(e.value - 1));
+            }
+        });
+
+    bus.queue_event(mock_event(2));
+    bus.dispatch_queued_events();
+
+    assert_log_message(log_level::info, "handler: 2");
+    assert_log_message(log_level::info, "handler: 1");
+    assert_log_message(log_level::info, "handler: 0");
+    assert_log_empty();
+}
+
 end_suite(event_bus_test);
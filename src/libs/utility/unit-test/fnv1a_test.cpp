@@ -0,0 +1,39 @@
+#include "test/test.hpp"
+#include "utility/fnv1a.hpp"
+#include <string>
+
+begin_suite(fnv1a_test);
+
+test_case(empty)
+{
+    assert_eq(gorc::fnv1a_hash(nullptr, 0), 0xCBF29CE484222325ULL);
+}
+
+test_case(reference_values)
+{
+    std::string a = "a";
+    assert_eq(gorc::fnv1a_hash(a.data(), a.size()), 0xAF63DC4C8601EC8CULL);
+
+    std::string foobar = "foobar";
+    assert_eq(gorc::fnv1a_hash(foobar.data(), foobar.size()), 0x85944171F73967E8ULL);
+}
+
+test_case(chained)
+{
+    std::string foo = "foo";
+    std::string bar = "bar";
+    std::string foobar = "foobar";
+
+    auto partial = gorc::fnv1a_hash(foo.data(), foo.size());
+    assert_eq(gorc::fnv1a_hash(bar.data(), bar.size(), partial),
+              gorc::fnv1a_hash(foobar.data(), foobar.size()));
+}
+
+test_case(span)
+{
+    std::string foobar = "foobar";
+    assert_eq(gorc::fnv1a_hash(gorc::make_span(foobar.data(), foobar.size())),
+              0x85944171F73967E8ULL);
+}
+
+end_suite(fnv1a_test);
@@ -91,4 +91,25 @@ test_case(has)
     assert_true(child.has<int>());
 }
 
+test_case(distinct_types)
+{
+    gorc::service_registry sr;
+
+    std::string msg = "Hello, World!";
+    int value = 5;
+    float other_value = 2.5f;
+
+    sr.add(value);
+    sr.add(msg);
+
+    assert_true(!sr.has<float>());
+
+    sr.add(other_value);
+
+    assert_eq(sr.get<std::string>(), std::string("Hello, World!"));
+    assert_eq(sr.get<int>(), 5);
+    assert_eq(sr.get<float>(), 2.5f);
+    assert_eq(&sr.get<int const>(), &value);
+}
+
 end_suite(service_registry_test);
@@ -0,0 +1,75 @@
+#include "test/test.hpp"
+#include "utility/small_function.hpp"
+#include <array>
+#include <memory>
+
+using namespace gorc;
+
+begin_suite(small_function_test);
+
+test_case(default_is_empty)
+{
+    small_function<int(int)> fn;
+    assert_true(!fn);
+}
+
+test_case(inline_callable)
+{
+    int offset = 5;
+    small_function<int(int)> fn([&](int x) { return x + offset; });
+
+    assert_true(static_cast<bool>(fn));
+    assert_eq(fn(10), 15);
+
+    offset = 7;
+    assert_eq(fn(10), 17);
+}
+
+test_case(large_callable)
+{
+    std::array<int, 32> values;
+    values.fill(3);
+
+    small_function<int(size_t)> fn([values](size_t i) { return values[i]; });
+    assert_eq(fn(31), 3);
+}
+
+test_case(move_transfers_callable)
+{
+    auto counter = std::make_shared<int>(0);
+
+    small_function<void()> fn([counter] { ++*counter; });
+    small_function<void()> other(std::move(fn));
+
+    assert_true(!fn);
+    other();
+    assert_eq(*counter, 1);
+
+    fn = std::move(other);
+    assert_true(!other);
+    fn();
+    assert_eq(*counter, 2);
+}
+
+test_case(destroys_callable)
+{
+    auto counter = std::make_shared<int>(0);
+
+    {
+        small_function<void()> fn([counter] { ++*counter; });
+        assert_eq(counter.use_count(), 2L);
+    }
+
+    assert_eq(counter.use_count(), 1L);
+
+    {
+        std::array<std::shared_ptr<int>, 8> many;
+        many.fill(counter);
+        small_function<void()> fn([many] { ++*many[0]; });
+        assert_eq(counter.use_count(), 17L);
+    }
+
+    assert_eq(counter.use_count(), 1L);
+}
+
+end_suite(small_function_test);
@@ -22,4 +22,22 @@ test_case(user_defined_operator_string_view)
     assert_true(iequal(sv, str));
 }
 
+test_case(range_string_view)
+{
+    char const *str = "Hello, World!";
+    string_view sv(str + 7, str + 12);
+    assert_eq(sv.size(), size_t(5));
+    assert_eq(sv.data(), str + 7);
+    assert_true(!sv.empty());
+    assert_true(iequal(sv, std::string("world")));
+}
+
+test_case(empty_string_view)
+{
+    string_view sv;
+    assert_true(sv.empty());
+    assert_eq(sv.size(), size_t(0));
+    assert_true(string_view("abc", size_t(0)).empty());
+}
+
 end_suite(string_view_test);
@@ -0,0 +1,90 @@
+#include "test/test.hpp"
+#include "utility/triple_buffer.hpp"
+#include <thread>
+
+begin_suite(triple_buffer_test);
+
+test_case(nothing_published)
+{
+    gorc::triple_buffer<int> buf;
+    assert_true(!buf.update());
+}
+
+test_case(publish_then_update)
+{
+    gorc::triple_buffer<int> buf;
+
+    buf.back() = 5;
+    buf.publish();
+
+    assert_true(buf.update());
+    assert_eq(buf.front(), 5);
+
+    assert_true(!buf.update());
+    assert_eq(buf.front(), 5);
+}
+
+test_case(consumer_sees_latest)
+{
+    gorc::triple_buffer<int> buf;
+
+    for(int i = 1; i <= 4; ++i) {
+        buf.back() = i;
+        buf.publish();
+    }
+
+    assert_true(buf.update());
+    assert_eq(buf.front(), 4);
+}
+
+test_case(producer_does_not_overwrite_front)
+{
+    gorc::triple_buffer<int> buf;
+
+    buf.back() = 1;
+    buf.publish();
+    assert_true(buf.update());
+
+    for(int i = 2; i <= 5; ++i) {
+        buf.back() = i;
+        buf.publish();
+        assert_eq(buf.front(), 1);
+    }
+
+    assert_true(buf.update());
+    assert_eq(buf.front(), 5);
+}
+
+test_case(threaded_handoff)
+{
+    // Each published value is internally consistent and values never go
+    // backwards.
+    gorc::triple_buffer<std::pair<int, int>> buf;
+    int const count = 100000;
+
+    std::thread producer([&] {
+            for(int i = 1; i <= count; ++i) {
+                buf.back() = std::make_pair(i, -i);
+                buf.publish();
+            }
+        });
+
+    int last = 0;
+    bool consistent = true;
+    bool monotonic = true;
+    while(last < count) {
+        if(buf.update()) {
+            auto const &value = buf.front();
+            consistent = consistent && (value.first == -value.second);
+            monotonic = monotonic && (value.first > last);
+            last = value.first;
+        }
+    }
+
+    producer.join();
+
+    assert_true(consistent);
+    assert_true(monotonic);
+}
+
+end_suite(triple_buffer_test);
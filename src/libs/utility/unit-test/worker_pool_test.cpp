@@ -0,0 +1,53 @@
+#include "test/test.hpp"
+#include "utility/worker_pool.hpp"
+#include <atomic>
+#include <set>
+
+begin_suite(worker_pool_test);
+
+test_case(runs_job_on_every_thread)
+{
+    gorc::worker_pool pool(3);
+    assert_eq(pool.size(), size_t(3));
+
+    std::mutex lock;
+    std::set<std::thread::id> threads;
+    pool.run([&] {
+            std::lock_guard<std::mutex> lk(lock);
+            threads.insert(std::this_thread::get_id());
+        });
+
+    assert_eq(threads.size(), size_t(4));
+    assert_true(threads.find(std::this_thread::get_id()) != threads.end());
+}
+
+test_case(workers_are_reused)
+{
+    gorc::worker_pool pool(2);
+
+    std::atomic<size_t> next_item(0);
+    std::atomic<int> total(0);
+
+    for(int batch = 0; batch < 100; ++batch) {
+        next_item = 0;
+        pool.run([&] {
+                for(size_t i = next_item++; i < 10; i = next_item++) {
+                    total += static_cast<int>(i);
+                }
+            });
+    }
+
+    assert_eq(total.load(), 4500);
+}
+
+test_case(no_workers_runs_on_caller)
+{
+    gorc::worker_pool pool(0);
+
+    int calls = 0;
+    pool.run([&] { ++calls; });
+
+    assert_eq(calls, 1);
+}
+
+end_suite(worker_pool_test);
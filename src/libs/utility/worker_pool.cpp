@@ -0,0 +1,69 @@
+#include "worker_pool.hpp"
+
+gorc::worker_pool::worker_pool(size_t worker_count)
+{
+    for(size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back([this] { worker_main(); });
+    }
+}
+
+gorc::worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        stopping = true;
+    }
+
+    work_ready.notify_all();
+
+    for(auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void gorc::worker_pool::worker_main()
+{
+    size_t last_generation = 0;
+
+    std::unique_lock<std::mutex> lk(lock);
+    while(true) {
+        work_ready.wait(lk, [&] { return stopping || generation != last_generation; });
+        if(stopping) {
+            return;
+        }
+
+        last_generation = generation;
+        auto const *current_job = job;
+
+        lk.unlock();
+        (*current_job)();
+        lk.lock();
+
+        if(--busy_workers == 0) {
+            work_done.notify_one();
+        }
+    }
+}
+
+void gorc::worker_pool::run(std::function<void()> const &new_job)
+{
+    if(workers.empty()) {
+        new_job();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        job = &new_job;
+        busy_workers = workers.size();
+        ++generation;
+    }
+
+    work_ready.notify_all();
+
+    new_job();
+
+    std::unique_lock<std::mutex> lk(lock);
+    work_done.wait(lk, [&] { return busy_workers == 0; });
+    job = nullptr;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gorc {
+
+    // Threads kept alive between batches of work, so that short batches do
+    // not pay for starting threads. run() calls the job on every worker and
+    // on the calling thread, and returns once all calls have finished. The
+    // job divides the work between its callers. Jobs must not throw.
+    class worker_pool {
+    private:
+        std::vector<std::thread> workers;
+
+        std::mutex lock;
+        std::condition_variable work_ready;
+        std::condition_variable work_done;
+
+        std::function<void()> const *job = nullptr;
+        size_t generation = 0;
+        size_t busy_workers = 0;
+        bool stopping = false;
+
+        void worker_main();
+
+    public:
+        explicit worker_pool(size_t worker_count);
+        ~worker_pool();
+
+        worker_pool(worker_pool const &) = delete;
+        worker_pool &operator=(worker_pool const &) = delete;
+
+        inline size_t size() const
+        {
+            return workers.size();
+        }
+
+        void run(std::function<void()> const &job);
+    };
+
+}
@@ -0,0 +1,114 @@
+#include "bench/benchmark.hpp"
+#include "io/binary_input_stream.hpp"
+#include "io/binary_output_stream.hpp"
+#include "io/memory_file.hpp"
+#include "utility/strcat.hpp"
+#include <vector>
+
+namespace gorc {
+    namespace {
+
+        // Shaped like the per-entity records in a saved game
+        class bench_record {
+        public:
+            int id = 0;
+            uint32_t flags = 0;
+            double position[3] = { 0.0, 0.0, 0.0 };
+            std::string name;
+
+            bench_record() = default;
+
+            bench_record(deserialization_constructor_tag, binary_input_stream &is)
+                : id(binary_deserialize<int>(is))
+                , flags(binary_deserialize<uint32_t>(is))
+            {
+                for(auto &em : position) {
+                    em = binary_deserialize<double>(is);
+                }
+
+                name = binary_deserialize<std::string>(is);
+            }
+
+            void binary_serialize_object(binary_output_stream &os) const
+            {
+                binary_serialize(os, id);
+                binary_serialize(os, flags);
+                for(auto em : position) {
+                    binary_serialize(os, em);
+                }
+
+                binary_serialize(os, name);
+            }
+        };
+
+        class binary_stream_benchmark : public bench::benchmark {
+        protected:
+            static constexpr size_t record_count = 1024;
+
+            std::vector<bench_record> records;
+            memory_file mf;
+
+            void write_records()
+            {
+                memory_file::writer wr(mf);
+                binary_output_stream bos(wr, binary_stream_buffer_size);
+                binary_serialize_range(bos, records);
+            }
+
+        public:
+            binary_stream_benchmark()
+            {
+                for(size_t i = 0; i < record_count; ++i) {
+                    records.emplace_back();
+                    auto &rec = records.back();
+                    rec.id = static_cast<int>(i);
+                    rec.flags = static_cast<uint32_t>(i * 7);
+                    rec.position[0] = static_cast<double>(i);
+                    rec.position[1] = 0.5;
+                    rec.position[2] = -1.0;
+                    rec.name = strcat("thing", i);
+                }
+
+                write_records();
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return record_count;
+            }
+
+            virtual size_t get_byte_count() const override
+            {
+                return mf.size();
+            }
+        };
+
+        class binary_serialize_benchmark : public binary_stream_benchmark {
+        public:
+            virtual void run() override
+            {
+                write_records();
+            }
+        };
+
+        class binary_deserialize_benchmark : public binary_stream_benchmark {
+        private:
+            std::vector<bench_record> loaded;
+
+        public:
+            virtual void run() override
+            {
+                memory_file::reader rd(mf);
+                binary_input_stream bis(rd, binary_stream_buffer_size);
+
+                loaded.clear();
+                binary_deserialize_range<bench_record>(bis, std::back_inserter(loaded));
+                bench::consume(loaded.size());
+            }
+        };
+
+        bench::benchmark_registration<binary_serialize_benchmark> serialize_reg("io/binary_serialize");
+        bench::benchmark_registration<binary_deserialize_benchmark> deserialize_reg("io/binary_deserialize");
+
+    }
+}
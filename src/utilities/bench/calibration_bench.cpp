@@ -0,0 +1,36 @@
+#include "bench/benchmark.hpp"
+
+namespace gorc {
+    namespace {
+
+        // Fixed integer workload. Its time tracks the speed of the machine,
+        // and is used to scale baselines recorded elsewhere.
+        class calibration_benchmark : public bench::benchmark {
+        private:
+            static constexpr size_t iterations = 1024;
+            uint64_t state = 88172645463325252ULL;
+
+        public:
+            virtual void run() override
+            {
+                uint64_t x = state;
+                for(size_t i = 0; i < iterations; ++i) {
+                    x ^= x << 13;
+                    x ^= x >> 7;
+                    x ^= x << 17;
+                }
+
+                state = x;
+                bench::consume(x);
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return iterations;
+            }
+        };
+
+        bench::benchmark_registration<calibration_benchmark> calibration_reg("calibration");
+
+    }
+}
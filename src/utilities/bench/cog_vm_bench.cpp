@@ -0,0 +1,156 @@
+#include "bench/benchmark.hpp"
+#include "jk/cog/compiler/compiler.hpp"
+#include "jk/cog/ir/ir_printer.hpp"
+#include "jk/cog/vm/default_verbs.hpp"
+#include "jk/cog/vm/executor.hpp"
+#include "io/memory_file.hpp"
+#include "log/log.hpp"
+#include <cstring>
+
+namespace gorc {
+    namespace {
+
+        // Counts to a limit using a single heap variable, exercising the
+        // dispatch loop without any verb calls.
+        std::unique_ptr<cog::script> make_synthetic_script(int iterations)
+        {
+            auto rv = std::make_unique<cog::script>();
+            rv->filename = "synthetic";
+            rv->symbols.add_symbol("counter");
+
+            memory_file::writer text_writer(rv->program);
+            cog::ir_printer ir(text_writer, rv->exports);
+
+            auto loop = ir.generate_label();
+
+            ir.label(ir.get_export_label(cog::message_type::startup, "startup"));
+            ir.push(cog::value(0));
+            ir.stor(0);
+
+            ir.label(loop);
+            ir.load(0);
+            ir.push(cog::value(1));
+            ir.add();
+            ir.dup();
+            ir.stor(0);
+            ir.push(cog::value(iterations));
+            ir.lt();
+            ir.bt(loop);
+
+            ir.ret();
+            ir.finalize();
+
+            return rv;
+        }
+
+        // Representative of level scripts: locals, arrays, branches, calls
+        // to subroutines and verbs.
+        char const *const script_source =
+            "symbols\n"
+            "message startup\n"
+            "int i\n"
+            "int total\n"
+            "int flags\n"
+            "int values0\n"
+            "int values1\n"
+            "int values2\n"
+            "int values3\n"
+            "int values4\n"
+            "int values5\n"
+            "int values6\n"
+            "int values7\n"
+            "end\n"
+            "code\n"
+            "accumulate:\n"
+            "    total = total + values0[i];\n"
+            "    if(total > 1000) total = total - 1000;\n"
+            "    return;\n"
+            "startup:\n"
+            "    total = 0;\n"
+            "    flags = 0;\n"
+            "    for(i = 0; i < 8; i = i + 1) {\n"
+            "        values0[i] = i * 3 + 1;\n"
+            "    }\n"
+            "    for(i = 0; i < 8; i = i + 1) {\n"
+            "        call accumulate;\n"
+            "        flags = bitset(flags, i * 2);\n"
+            "        if(bittest(flags, 4) && total % 2 == 0) {\n"
+            "            flags = bitclear(flags, 4);\n"
+            "        }\n"
+            "    }\n"
+            "    returnex(total + flags);\n"
+            "end\n";
+
+        class cog_vm_benchmark : public bench::benchmark {
+        protected:
+            cog::verb_table verbs;
+            cog::constant_table constants;
+            service_registry services;
+
+            std::unique_ptr<cog::script> script;
+            std::unique_ptr<cog::executor> exec;
+            cog_id instance_id;
+
+            void create_instance()
+            {
+                exec = std::make_unique<cog::executor>(services);
+                instance_id = exec->create_instance(asset_ref<cog::script>(*script, asset_id(0)));
+            }
+
+        public:
+            cog_vm_benchmark()
+            {
+                cog::default_populate_verb_table(verbs);
+                cog::default_populate_constant_table(constants);
+                services.add(verbs);
+            }
+
+            virtual void run() override
+            {
+                auto rv = exec->send(instance_id,
+                                     cog::message_type::startup,
+                                     /* sender */ cog::value(),
+                                     /* sender id */ cog::value(),
+                                     /* source */ cog::value());
+                bench::consume(static_cast<uint64_t>(static_cast<int>(rv)));
+            }
+        };
+
+        class cog_vm_synthetic_benchmark : public cog_vm_benchmark {
+        private:
+            static constexpr int iterations = 1024;
+
+        public:
+            cog_vm_synthetic_benchmark()
+            {
+                script = make_synthetic_script(iterations);
+                create_instance();
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return iterations;
+            }
+        };
+
+        class cog_vm_script_benchmark : public cog_vm_benchmark {
+        public:
+            cog_vm_script_benchmark()
+            {
+                diagnostic_context dc("bench.cog");
+
+                memory_file source;
+                source.write(script_source, std::strlen(script_source));
+
+                memory_file::reader source_reader(source);
+                cog::compiler compiler(verbs, constants);
+                script = compiler.compile(source_reader);
+                create_instance();
+            }
+        };
+
+        bench::benchmark_registration<cog_vm_synthetic_benchmark> synthetic_reg("cog_vm/loop");
+        bench::benchmark_registration<cog_vm_script_benchmark> script_reg("cog_vm/message");
+
+    }
+}
@@ -0,0 +1,141 @@
+#include "bench/benchmark.hpp"
+#include "content/content_manager.hpp"
+#include "content/loader.hpp"
+#include "content/loader_registry.hpp"
+#include "io/memory_file.hpp"
+#include "utility/strcat.hpp"
+#include "vfs/virtual_file_system.hpp"
+#include <vector>
+
+namespace gorc {
+    namespace {
+
+        // Serves the same small file for every name
+        class bench_vfs : public virtual_file_system {
+        private:
+            memory_file mf;
+
+        public:
+            bench_vfs()
+            {
+                int value = 5;
+                mf.write(&value, sizeof(int));
+            }
+
+            virtual std::unique_ptr<input_stream> open(path const &) const override
+            {
+                return std::make_unique<memory_file::reader>(mf);
+            }
+
+            virtual std::tuple<path, std::unique_ptr<input_stream>>
+                find(path const &p, std::vector<path> const &) const override
+            {
+                return std::make_tuple(p, open(p));
+            }
+        };
+
+        class bench_asset : public asset {
+        public:
+            static fourcc const type;
+
+            int value;
+
+            explicit bench_asset(int value)
+                : value(value)
+            {
+                return;
+            }
+        };
+
+        fourcc const bench_asset::type = "BNCH"_4CC;
+
+        class bench_loader : public loader {
+        public:
+            static fourcc const type;
+
+            virtual std::vector<path> const &get_prefixes() const override
+            {
+                static std::vector<path> rv = { "" };
+                return rv;
+            }
+
+            virtual std::unique_ptr<asset> deserialize(input_stream &is,
+                                                       content_manager &,
+                                                       asset_id,
+                                                       service_registry const &,
+                                                       std::string const &) const override
+            {
+                int value;
+                is.read(&value, sizeof(int));
+                return std::make_unique<bench_asset>(value);
+            }
+        };
+
+        fourcc const bench_loader::type = "BNCH"_4CC;
+
+        // Repeated lookups of assets which are already loaded, as made by
+        // presenters and verbs during play
+        class content_benchmark : public bench::benchmark {
+        protected:
+            static constexpr size_t asset_count = 512;
+
+            bench_vfs vfs;
+            loader_registry loaders;
+            service_registry services;
+            std::unique_ptr<content_manager> content;
+
+            std::vector<std::string> names;
+            std::vector<asset_id> ids;
+
+        public:
+            content_benchmark()
+            {
+                loaders.emplace_loader<bench_loader>();
+                services.add(loaders);
+                services.add<virtual_file_system>(vfs);
+
+                content = std::make_unique<content_manager>(services);
+                for(size_t i = 0; i < asset_count; ++i) {
+                    names.push_back(strcat("mat/texture", i, ".mat"));
+                    ids.push_back(content->load_id<bench_asset>(names.back()));
+                }
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return asset_count;
+            }
+        };
+
+        class content_load_by_name_benchmark : public content_benchmark {
+        public:
+            virtual void run() override
+            {
+                uint64_t total = 0;
+                for(auto const &name : names) {
+                    total += static_cast<uint64_t>(content->load<bench_asset>(name)->value);
+                }
+
+                bench::consume(total);
+            }
+        };
+
+        class content_load_by_id_benchmark : public content_benchmark {
+        public:
+            virtual void run() override
+            {
+                uint64_t total = 0;
+                for(auto id : ids) {
+                    auto const &a = dynamic_cast<bench_asset const &>(content->load_from_id(id));
+                    total += static_cast<uint64_t>(a.value);
+                }
+
+                bench::consume(total);
+            }
+        };
+
+        bench::benchmark_registration<content_load_by_name_benchmark> name_reg("content/load_by_name");
+        bench::benchmark_registration<content_load_by_id_benchmark> id_reg("content/load_by_id");
+
+    }
+}
@@ -0,0 +1,159 @@
+#include "bench/benchmark.hpp"
+#include "ecs/component_registry.hpp"
+#include "ecs/entity_component_system.hpp"
+#include "ecs/inner_join_aspect.hpp"
+#include "utility/service_registry.hpp"
+#include "utility/uid.hpp"
+#include <vector>
+
+namespace gorc {
+    namespace {
+
+        class bench_position_component {
+        public:
+            uid(9001);
+            int value;
+
+            explicit bench_position_component(int value)
+                : value(value)
+            {
+                return;
+            }
+        };
+
+        class bench_velocity_component {
+        public:
+            uid(9002);
+            int value;
+
+            explicit bench_velocity_component(int value)
+                : value(value)
+            {
+                return;
+            }
+        };
+
+        class ecs_benchmark : public bench::benchmark {
+        protected:
+            static constexpr size_t entity_count = 1024;
+
+            event_bus bus;
+            component_registry<thing_id> registry;
+            service_registry services;
+            std::unique_ptr<entity_component_system<thing_id>> ecs;
+
+            // Every entity has a position. Every other entity has a velocity.
+            void populate()
+            {
+                for(size_t i = 0; i < entity_count; ++i) {
+                    auto entity = ecs->emplace_entity();
+                    ecs->emplace_component<bench_position_component>(entity, static_cast<int>(i));
+                    if(i % 2 == 0) {
+                        ecs->emplace_component<bench_velocity_component>(entity, 1);
+                    }
+                }
+            }
+
+        public:
+            ecs_benchmark()
+            {
+                registry.register_component_type<bench_position_component>();
+                registry.register_component_type<bench_velocity_component>();
+                services.add(registry);
+                services.add(bus);
+
+                ecs = std::make_unique<entity_component_system<thing_id>>(services);
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return entity_count;
+            }
+        };
+
+        class ecs_emplace_benchmark : public ecs_benchmark {
+        public:
+            virtual void run() override
+            {
+                ecs = std::make_unique<entity_component_system<thing_id>>(services);
+                populate();
+            }
+        };
+
+        class ecs_iterate_benchmark : public ecs_benchmark {
+        public:
+            ecs_iterate_benchmark()
+            {
+                populate();
+            }
+
+            virtual void run() override
+            {
+                uint64_t total = 0;
+                for(auto const &comp : ecs->all_components<bench_position_component>()) {
+                    total += static_cast<uint64_t>(comp.second->value);
+                }
+
+                bench::consume(total);
+            }
+        };
+
+        class bench_join_aspect : public inner_join_aspect<thing_id,
+                                                           bench_position_component,
+                                                           bench_velocity_component> {
+        public:
+            using inner_join_aspect::inner_join_aspect;
+
+            virtual void update(time_delta,
+                                thing_id,
+                                bench_position_component &pos,
+                                bench_velocity_component &vel) override
+            {
+                pos.value += vel.value;
+            }
+        };
+
+        class ecs_join_benchmark : public ecs_benchmark {
+        public:
+            ecs_join_benchmark()
+            {
+                populate();
+                ecs->emplace_aspect<bench_join_aspect>();
+            }
+
+            virtual void run() override
+            {
+                ecs->update(time_delta(0.0));
+            }
+        };
+
+        class ecs_erase_benchmark : public ecs_benchmark {
+        private:
+            std::vector<thing_id> entities;
+
+        public:
+            virtual void run() override
+            {
+                // Erasure is deferred to the next update, which flushes it
+                entities.clear();
+                for(size_t i = 0; i < entity_count; ++i) {
+                    auto entity = ecs->emplace_entity();
+                    ecs->emplace_component<bench_position_component>(entity, static_cast<int>(i));
+                    entities.push_back(entity);
+                }
+
+                for(auto entity : entities) {
+                    ecs->erase_entity(entity);
+                }
+
+                ecs->update(time_delta(0.0));
+            }
+        };
+
+        bench::benchmark_registration<ecs_emplace_benchmark> emplace_reg("ecs/emplace");
+        bench::benchmark_registration<ecs_iterate_benchmark> iterate_reg("ecs/iterate");
+        bench::benchmark_registration<ecs_join_benchmark> join_reg("ecs/join");
+        bench::benchmark_registration<ecs_erase_benchmark> erase_reg("ecs/emplace_erase");
+
+    }
+}
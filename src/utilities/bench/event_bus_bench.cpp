@@ -0,0 +1,73 @@
+#include "bench/benchmark.hpp"
+#include "utility/event_bus.hpp"
+#include <vector>
+
+namespace gorc {
+    namespace {
+
+        class bench_event {
+        public:
+            int value;
+
+            explicit bench_event(int value)
+                : value(value)
+            {
+                return;
+            }
+        };
+
+        class event_bus_benchmark : public bench::benchmark {
+        protected:
+            static constexpr size_t handler_count = 8;
+            static constexpr size_t event_count = 256;
+
+            event_bus bus;
+            std::vector<scoped_delegate> delegates;
+            uint64_t total = 0;
+
+        public:
+            event_bus_benchmark()
+            {
+                for(size_t i = 0; i < handler_count; ++i) {
+                    delegates.push_back(bus.add_handler<bench_event>([this](bench_event const &e) {
+                            total += static_cast<uint64_t>(e.value);
+                        }));
+                }
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return event_count;
+            }
+        };
+
+        class event_bus_fire_benchmark : public event_bus_benchmark {
+        public:
+            virtual void run() override
+            {
+                for(size_t i = 0; i < event_count; ++i) {
+                    bus.fire_event(bench_event(static_cast<int>(i)));
+                }
+
+                bench::consume(total);
+            }
+        };
+
+        class event_bus_queue_benchmark : public event_bus_benchmark {
+        public:
+            virtual void run() override
+            {
+                for(size_t i = 0; i < event_count; ++i) {
+                    bus.queue_event(bench_event(static_cast<int>(i)));
+                }
+
+                bus.dispatch_queued_events();
+                bench::consume(total);
+            }
+        };
+
+        bench::benchmark_registration<event_bus_fire_benchmark> fire_reg("event_bus/fire");
+        bench::benchmark_registration<event_bus_queue_benchmark> queue_reg("event_bus/queue");
+
+    }
+}
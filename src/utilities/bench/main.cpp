@@ -0,0 +1,178 @@
+#include "program/program.hpp"
+#include "bench/baseline.hpp"
+#include "bench/benchmark.hpp"
+#include "bench/runner.hpp"
+#include "io/native_file.hpp"
+#include "log/log.hpp"
+#include <iomanip>
+#include <iostream>
+
+namespace gorc {
+
+    // Timings depend on the machine and its load, so baseline comparison only
+    // runs in the test suite when GORC_BENCH is set. Check for regressions
+    // more closely by hand with:
+    //   gorc-bench --baseline src/utilities/bench/baseline.json
+    class bench_program : public program {
+    private:
+        std::string filter;
+        std::string json_file;
+        std::string baseline_file;
+
+        bool list = false;
+        bool quick = false;
+
+        int samples = 0;
+        int warmup = 0;
+        int min_sample_ms = 0;
+        double max_regression = 0.0;
+
+        // Baselines are scaled by this benchmark, which measures machine speed
+        std::string const calibration_name = "calibration";
+
+        std::string format_throughput(bench::benchmark_result const &result)
+        {
+            if(result.median_ns <= 0.0) {
+                return "-";
+            }
+
+            if(result.bytes > 0) {
+                double bytes_per_op = static_cast<double>(result.bytes) /
+                                      static_cast<double>(result.operations);
+                return str(format("%.1f MB/s") % (bytes_per_op * 1000.0 / result.median_ns));
+            }
+
+            double ops_per_second = 1.0e9 / result.median_ns;
+            if(ops_per_second >= 1.0e6) {
+                return str(format("%.2f Mop/s") % (ops_per_second / 1.0e6));
+            }
+            else if(ops_per_second >= 1.0e3) {
+                return str(format("%.2f kop/s") % (ops_per_second / 1.0e3));
+            }
+
+            return str(format("%.2f op/s") % ops_per_second);
+        }
+
+        void print_result(bench::benchmark_result const &result)
+        {
+            double rel_stddev = (result.median_ns > 0.0) ?
+                                (100.0 * result.stddev_ns / result.median_ns) : 0.0;
+
+            std::cout << std::left << std::setw(32) << result.name
+                      << std::right << std::fixed
+                      << std::setw(14) << std::setprecision(2) << result.median_ns << " ns/op"
+                      << std::setw(8) << std::setprecision(1) << rel_stddev << " %"
+                      << std::setw(16) << format_throughput(result)
+                      << std::endl;
+        }
+
+        bool print_comparison(bench::benchmark_report const &report)
+        {
+            diagnostic_context dc(baseline_file.c_str());
+            auto f = make_native_read_only_file(baseline_file);
+            json_input_stream jis(*f);
+            bench::benchmark_report baseline(deserialization_constructor, jis);
+
+            std::cout << std::endl
+                      << "baseline: " << baseline_file << std::endl;
+
+            bool regressed = false;
+            for(auto const &cmp : bench::compare_to_baseline(report, baseline, calibration_name)) {
+                double change_pct = 100.0 * cmp.change;
+                bool is_regression = (change_pct > max_regression);
+                regressed = regressed || is_regression;
+
+                std::cout << std::left << std::setw(32) << cmp.name
+                          << std::right << std::fixed << std::setprecision(2)
+                          << std::setw(14) << cmp.baseline_ns << " ->"
+                          << std::setw(12) << cmp.current_ns << " ns/op"
+                          << std::setw(9) << std::setprecision(1) << std::showpos << change_pct
+                          << std::noshowpos << " %"
+                          << (is_regression ? "  REGRESSED" : "")
+                          << std::endl;
+            }
+
+            return !regressed;
+        }
+
+    public:
+        virtual void create_options(options &opts) override
+        {
+            opts.insert(make_value_option("filter", filter));
+            opts.insert(make_value_option("json", json_file));
+            opts.insert(make_value_option("baseline", baseline_file));
+            opts.insert(make_switch_option("list", list));
+            opts.insert(make_switch_option("quick", quick));
+            opts.insert(make_value_option("samples", samples, 20));
+            opts.insert(make_value_option("warmup", warmup, 3));
+            opts.insert(make_value_option("min-sample-ms", min_sample_ms, 10));
+            opts.insert(make_value_option("max-regression", max_regression, 10.0));
+        }
+
+        virtual int run() override
+        {
+            auto const &factories = get_global<bench::benchmark_registry>()->factories;
+
+            if(list) {
+                for(auto const &factory : factories) {
+                    std::cout << factory.first << std::endl;
+                }
+
+                return EXIT_SUCCESS;
+            }
+
+            if(samples <= 0) {
+                LOG_FATAL("samples must be positive");
+            }
+
+            if(warmup < 0) {
+                LOG_FATAL("warmup must not be negative");
+            }
+
+            if(min_sample_ms <= 0) {
+                LOG_FATAL("min-sample-ms must be positive");
+            }
+
+            bench::run_options run_opts;
+            run_opts.samples = static_cast<size_t>(samples);
+            run_opts.warmup_samples = static_cast<size_t>(warmup);
+            run_opts.min_sample_time = std::chrono::milliseconds(min_sample_ms);
+
+            if(quick) {
+                // Enough to catch gross regressions. Too noisy for small ones
+                run_opts.samples = 5;
+                run_opts.warmup_samples = 1;
+                run_opts.min_sample_time = std::chrono::milliseconds(2);
+            }
+
+            bench::benchmark_report report;
+            for(auto const &factory : factories) {
+                if(!filter.empty() &&
+                   factory.first != calibration_name &&
+                   factory.first.find(filter) == std::string::npos) {
+                    continue;
+                }
+
+                auto b = factory.second();
+                report.benchmarks.push_back(bench::run_benchmark(factory.first, *b, run_opts));
+                print_result(report.benchmarks.back());
+            }
+
+            if(!json_file.empty()) {
+                auto f = make_native_file(json_file);
+                json_output_stream jos(*f);
+                json_serialize(jos, report);
+            }
+
+            if(!baseline_file.empty() && !print_comparison(report)) {
+                LOG_ERROR(format("benchmarks regressed by more than %.1f%%") % max_regression);
+                return EXIT_FAILURE;
+            }
+
+            return EXIT_SUCCESS;
+        }
+    };
+
+}
+
+MAKE_MAIN(gorc::bench_program)
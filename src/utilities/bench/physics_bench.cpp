@@ -0,0 +1,218 @@
+#include "bench/benchmark.hpp"
+#include "content/content_manager.hpp"
+#include "game/level_state.hpp"
+#include "game/world/level_model.hpp"
+#include "game/world/level_presenter.hpp"
+#include "game/world/physics/query.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace gorc {
+    namespace {
+
+        using content::assets::level;
+        using content::assets::level_adjoin;
+        using content::assets::level_sector;
+        using content::assets::level_surface;
+
+        constexpr int grid_size = 16;
+
+        int grid_sector(int x, int y)
+        {
+            return y * grid_size + x;
+        }
+
+        // Appends a quad with the given inward normal. Vertices are wound
+        // counterclockwise when viewed from the side the normal points to.
+        void add_face(level &lev,
+                      std::vector<vector<3>> corners,
+                      vector<3> normal,
+                      maybe<int> adjoined_sector)
+        {
+            auto centroid = make_zero_vector<3, float>();
+            for(auto const &corner : corners) {
+                centroid += corner;
+            }
+
+            centroid = centroid / static_cast<float>(corners.size());
+
+            auto u = normalize(corners.front() - centroid);
+            auto v = cross(normal, u);
+            std::sort(corners.begin(), corners.end(), [&](vector<3> const &a, vector<3> const &b) {
+                    return std::atan2(dot(a - centroid, v), dot(a - centroid, u)) <
+                           std::atan2(dot(b - centroid, v), dot(b - centroid, u));
+                });
+
+            level_surface surf;
+            surf.material = -1;
+            surf.geometry_mode = flags::geometry_mode::not_drawn;
+            surf.light_mode = flags::light_mode::fully_lit;
+            surf.texture_mode = flags::texture_mode::AffineMapping;
+            surf.extra_light = 0.0f;
+            surf.normal = normal;
+            surf.texture_offset = make_zero_vector<2, float>();
+            surf.thrust = make_zero_vector<3, float>();
+            surf.adjoin = -1;
+            surf.adjoined_sector = sector_id(-1);
+
+            if(adjoined_sector.has_value()) {
+                surf.adjoin = static_cast<int>(lev.adjoins.size());
+                surf.adjoined_sector = sector_id(adjoined_sector.get_value());
+
+                level_adjoin adj;
+                adj.mirror = -1;
+                adj.distance = 0.0f;
+                lev.adjoins.push_back(adj);
+            }
+
+            for(auto const &corner : corners) {
+                surf.vertices.emplace_back(static_cast<int>(lev.vertices.size()), -1, 1.0f);
+                lev.vertices.push_back(corner);
+            }
+
+            lev.surfaces.push_back(surf);
+        }
+
+        // A flat grid of unit cube sectors, each adjoined to its neighbours
+        std::unique_ptr<level> make_grid_level()
+        {
+            auto lev = std::make_unique<level>();
+
+            for(int y = 0; y < grid_size; ++y) {
+                for(int x = 0; x < grid_size; ++x) {
+                    float x0 = static_cast<float>(x);
+                    float y0 = static_cast<float>(y);
+                    float x1 = x0 + 1.0f;
+                    float y1 = y0 + 1.0f;
+
+                    level_sector sec;
+                    sec.number = sector_id(grid_sector(x, y));
+                    sec.ambient_light = 0.0f;
+                    sec.extra_light = 0.0f;
+                    sec.colormap_id = 0;
+                    sec.tint = make_color(0.0f, 0.0f, 0.0f);
+                    sec.bounding_box = make_box(make_vector(x0, y0, 0.0f), make_vector(x1, y1, 1.0f));
+                    sec.collide_box = sec.bounding_box;
+                    sec.center = make_vector(x0 + 0.5f, y0 + 0.5f, 0.5f);
+                    sec.radius = std::sqrt(0.75f);
+                    sec.thrust = make_zero_vector<3, float>();
+                    sec.first_surface = static_cast<int>(lev->surfaces.size());
+                    sec.surface_count = 6;
+
+                    auto neighbour = [&](int nx, int ny) -> maybe<int> {
+                        if(nx < 0 || ny < 0 || nx >= grid_size || ny >= grid_size) {
+                            return nothing;
+                        }
+
+                        return grid_sector(nx, ny);
+                    };
+
+                    add_face(*lev,
+                             { make_vector(x0, y0, 0.0f), make_vector(x0, y1, 0.0f),
+                               make_vector(x0, y1, 1.0f), make_vector(x0, y0, 1.0f) },
+                             make_vector(1.0f, 0.0f, 0.0f),
+                             neighbour(x - 1, y));
+                    add_face(*lev,
+                             { make_vector(x1, y0, 0.0f), make_vector(x1, y1, 0.0f),
+                               make_vector(x1, y1, 1.0f), make_vector(x1, y0, 1.0f) },
+                             make_vector(-1.0f, 0.0f, 0.0f),
+                             neighbour(x + 1, y));
+                    add_face(*lev,
+                             { make_vector(x0, y0, 0.0f), make_vector(x1, y0, 0.0f),
+                               make_vector(x1, y0, 1.0f), make_vector(x0, y0, 1.0f) },
+                             make_vector(0.0f, 1.0f, 0.0f),
+                             neighbour(x, y - 1));
+                    add_face(*lev,
+                             { make_vector(x0, y1, 0.0f), make_vector(x1, y1, 0.0f),
+                               make_vector(x1, y1, 1.0f), make_vector(x0, y1, 1.0f) },
+                             make_vector(0.0f, -1.0f, 0.0f),
+                             neighbour(x, y + 1));
+                    add_face(*lev,
+                             { make_vector(x0, y0, 0.0f), make_vector(x1, y0, 0.0f),
+                               make_vector(x1, y1, 0.0f), make_vector(x0, y1, 0.0f) },
+                             make_vector(0.0f, 0.0f, 1.0f),
+                             nothing);
+                    add_face(*lev,
+                             { make_vector(x0, y0, 1.0f), make_vector(x1, y0, 1.0f),
+                               make_vector(x1, y1, 1.0f), make_vector(x0, y1, 1.0f) },
+                             make_vector(0.0f, 0.0f, -1.0f),
+                             nothing);
+
+                    lev->sectors.push_back(sec);
+                }
+            }
+
+            return lev;
+        }
+
+        // Sector traversal used for thing movement and line of sight. The
+        // broadphase belongs to the physics presenter, and is covered by
+        // simbench.
+        class segment_adjoin_path_benchmark : public bench::benchmark {
+        private:
+            static constexpr size_t segment_count = 64;
+
+            std::unique_ptr<level> lev;
+
+            service_registry services;
+            event_bus bus;
+            std::unique_ptr<game::level_state> components;
+            std::unique_ptr<content_manager> content;
+            std::unique_ptr<game::world::level_model> model;
+
+            std::vector<std::tuple<sector_id, game::world::physics::segment>> segments;
+            std::vector<std::tuple<sector_id, surface_id>> path;
+
+        public:
+            segment_adjoin_path_benchmark()
+                : lev(make_grid_level())
+            {
+                components = std::make_unique<game::level_state>(services);
+                components->services.add_or_replace(bus);
+
+                content = std::make_unique<content_manager>(components->services);
+                model = std::make_unique<game::world::level_model>(
+                        *content,
+                        components->services,
+                        asset_ref<level>(*lev, asset_id(0)));
+
+                std::mt19937 gen(1234);
+                std::uniform_real_distribution<float> coord(0.05f, grid_size - 0.05f);
+                std::uniform_real_distribution<float> height(0.05f, 0.95f);
+
+                for(size_t i = 0; i < segment_count; ++i) {
+                    auto start = make_vector(coord(gen), coord(gen), height(gen));
+                    auto end = make_vector(coord(gen), coord(gen), height(gen));
+
+                    int start_x = static_cast<int>(get<0>(start));
+                    int start_y = static_cast<int>(get<1>(start));
+                    segments.emplace_back(sector_id(grid_sector(start_x, start_y)),
+                                          game::world::physics::segment(start, end));
+                }
+            }
+
+            virtual void run() override
+            {
+                uint64_t total = 0;
+                for(auto const &seg : segments) {
+                    auto const &sec = at_id(model->sectors, std::get<0>(seg));
+                    game::world::physics::segment_adjoin_path(std::get<1>(seg), *model, sec, path);
+                    total += path.size();
+                }
+
+                bench::consume(total);
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return segment_count;
+            }
+        };
+
+        bench::benchmark_registration<segment_adjoin_path_benchmark>
+            adjoin_path_reg("physics/segment_adjoin_path");
+
+    }
+}
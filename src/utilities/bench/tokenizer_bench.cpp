@@ -0,0 +1,117 @@
+#include "bench/benchmark.hpp"
+#include "io/memory_file.hpp"
+#include "libold/base/text/tokenizer.hpp"
+#include "utility/strcat.hpp"
+
+namespace gorc {
+    namespace {
+
+        constexpr size_t record_count = 256;
+
+        // Line-oriented text resembling level sections
+        std::string make_level_text()
+        {
+            std::string rv;
+            for(size_t i = 0; i < record_count; ++i) {
+                rv += strcat("SECTOR ", i, "\n",
+                             "FLAGS 0x", i * 16, "\n",
+                             "AMBIENT LIGHT ", i, ".25\n",
+                             "EXTRA LIGHT 0.000000\n",
+                             "COLORMAP 0\n",
+                             "SOUND forcefield", i, ".wav 0.5 # ambient\n");
+            }
+
+            return rv;
+        }
+
+        // Numeric table rows resembling level vertices and surfaces
+        std::string make_table_text()
+        {
+            std::string rv;
+            for(size_t i = 0; i < record_count; ++i) {
+                rv += strcat(i, ": ", i, ".5 -", i, ".25 1.0e-3 0x", i * 4, " -", i, "\n");
+            }
+
+            return rv;
+        }
+
+        class tokenizer_benchmark : public bench::benchmark {
+        protected:
+            memory_file text;
+            size_t text_size;
+
+        public:
+            explicit tokenizer_benchmark(std::string const &source)
+                : text_size(source.size())
+            {
+                text.write(source.data(), source.size());
+            }
+
+            virtual size_t get_byte_count() const override
+            {
+                return text_size;
+            }
+        };
+
+        // Scans every token, as the section parsers skip through level files
+        class tokenizer_scan_benchmark : public tokenizer_benchmark {
+        public:
+            tokenizer_scan_benchmark()
+                : tokenizer_benchmark(make_level_text())
+            {
+                return;
+            }
+
+            virtual void run() override
+            {
+                memory_file::reader rd(text);
+                text::tokenizer tok(rd);
+
+                uint64_t token_count = 0;
+                while(true) {
+                    auto const &t = tok.get_token_view();
+                    if(t.type == text::token_type::end_of_file) {
+                        break;
+                    }
+
+                    ++token_count;
+                }
+
+                bench::consume(token_count);
+            }
+        };
+
+        // Converts numbers directly from the input buffer
+        class tokenizer_numbers_benchmark : public tokenizer_benchmark {
+        public:
+            tokenizer_numbers_benchmark()
+                : tokenizer_benchmark(make_table_text())
+            {
+                return;
+            }
+
+            virtual void run() override
+            {
+                memory_file::reader rd(text);
+                text::tokenizer tok(rd);
+
+                float total = 0.0f;
+                for(size_t i = 0; i < record_count; ++i) {
+                    total += static_cast<float>(tok.get_number<int>());
+                    tok.assert_punctuator(":");
+                    total += tok.get_number<float>();
+                    total += tok.get_number<float>();
+                    total += tok.get_number<float>();
+                    total += static_cast<float>(tok.get_number<int>());
+                    total += static_cast<float>(tok.get_number<int>());
+                }
+
+                bench::consume(static_cast<uint64_t>(total));
+            }
+        };
+
+        bench::benchmark_registration<tokenizer_scan_benchmark> scan_reg("text/tokenizer_scan");
+        bench::benchmark_registration<tokenizer_numbers_benchmark> numbers_reg("text/tokenizer_numbers");
+
+    }
+}
@@ -0,0 +1,99 @@
+#include "bench/benchmark.hpp"
+#include "io/native_file.hpp"
+#include "jk/vfs/jk_virtual_file_system.hpp"
+#include "utility/strcat.hpp"
+#include <boost/filesystem.hpp>
+#include <vector>
+
+namespace gorc {
+    namespace {
+
+        // Resource directory of loose files, laid out like an extracted GOB
+        class vfs_benchmark : public bench::benchmark {
+        protected:
+            static constexpr size_t files_per_directory = 128;
+
+            path resource_path;
+            std::unique_ptr<jk_virtual_file_system> vfs;
+
+            // Half of the lookups are satisfied by the second prefix
+            std::vector<path> names;
+            std::vector<path> const prefixes = { "3do/mat", "mat" };
+
+        public:
+            vfs_benchmark()
+            {
+                resource_path = boost::filesystem::temp_directory_path() /
+                                boost::filesystem::unique_path("gorc-bench-%%%%-%%%%");
+
+                for(char const *dir : { "3do/mat", "mat", "cog", "sound" }) {
+                    path dir_path = resource_path / dir;
+                    boost::filesystem::create_directories(dir_path);
+
+                    for(size_t i = 0; i < files_per_directory; ++i) {
+                        if(std::string(dir) == "3do/mat" && i % 2 != 0) {
+                            continue;
+                        }
+
+                        std::string filename = strcat("file", i, ".dat");
+                        make_native_file(dir_path / filename)->write(filename.data(), filename.size());
+
+                        if(std::string(dir) == "mat") {
+                            names.push_back(filename);
+                        }
+                    }
+                }
+
+                vfs = std::make_unique<jk_virtual_file_system>(resource_path);
+            }
+
+            ~vfs_benchmark()
+            {
+                vfs.reset();
+
+                boost::system::error_code ec;
+                boost::filesystem::remove_all(resource_path, ec);
+            }
+
+            virtual size_t get_operation_count() const override
+            {
+                return names.size();
+            }
+        };
+
+        class vfs_find_entry_benchmark : public vfs_benchmark {
+        public:
+            virtual void run() override
+            {
+                uint64_t found = 0;
+                for(auto const &name : names) {
+                    if(vfs->find_entry(path("mat") / name).has_value()) {
+                        ++found;
+                    }
+                }
+
+                bench::consume(found);
+            }
+        };
+
+        // Includes opening the file
+        class vfs_find_benchmark : public vfs_benchmark {
+        public:
+            virtual void run() override
+            {
+                uint64_t total = 0;
+                char buffer[16];
+                for(auto const &name : names) {
+                    auto file = vfs->find(name, prefixes);
+                    total += std::get<1>(file)->read_some(buffer, sizeof(buffer));
+                }
+
+                bench::consume(total);
+            }
+        };
+
+        bench::benchmark_registration<vfs_find_entry_benchmark> find_entry_reg("vfs/find_entry");
+        bench::benchmark_registration<vfs_find_benchmark> find_reg("vfs/find");
+
+    }
+}
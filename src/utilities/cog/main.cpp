@@ -11,6 +11,7 @@
 #include "content/content_manager.hpp"
 #include "content/loader_registry.hpp"
 #include "value_mapping.hpp"
+#include "profile_report.hpp"
 #include "io/native_file.hpp"
 #include <vector>
 #include <unordered_map>
@@ -50,7 +51,7 @@ namespace gorc {
                            service_registry const &parent_services)
             : services(&parent_services)
         {
-            binary_input_stream bis(is, services);
+            binary_input_stream bis(is, services, binary_stream_buffer_size);
 
             content = std::make_unique<content_manager>(deserialization_constructor, bis);
             services.add(*content);
@@ -62,7 +63,7 @@ namespace gorc {
 
         void binary_serialize_object(output_stream &os) const
         {
-            binary_output_stream bos(os, services);
+            binary_output_stream bos(os, services, binary_stream_buffer_size);
 
             binary_serialize(bos, *content);
             binary_serialize(bos, *executor);
@@ -75,7 +76,10 @@ namespace gorc {
         service_registry services;
 
         std::string scenario_file;
+        bool profile = false;
+        std::string profile_json_file;
         cog::verb_table verbs;
+        cog::execution_profiler profiler;
 
         std::unique_ptr<cog_scenario_state> state;
 
@@ -85,6 +89,8 @@ namespace gorc {
         virtual void create_options(options &opts) override
         {
             opts.insert(make_value_option("scenario", scenario_file));
+            opts.insert(make_switch_option("profile", profile));
+            opts.insert(make_value_option("profile-json", profile_json_file));
             opts.emplace_constraint<required_option>("scenario");
         }
 
@@ -107,6 +113,10 @@ namespace gorc {
             native_file_system vfs;
             services.add<virtual_file_system>(vfs);
 
+            if(profile || !profile_json_file.empty()) {
+                services.add(profiler);
+            }
+
             // Load scenario file
             diagnostic_context dc(scenario_file.c_str());
             auto f = make_native_read_only_file(scenario_file);
@@ -133,6 +143,17 @@ namespace gorc {
                 event->accept(*this);
             }
 
+            if(profile) {
+                std::cout << std::endl;
+                print_profile_report(std::cout, profiler);
+            }
+
+            if(!profile_json_file.empty()) {
+                auto pf = make_native_file(profile_json_file);
+                json_output_stream jos(*pf);
+                write_profile_json(jos, profiler);
+            }
+
             return EXIT_SUCCESS;
         }
 
@@ -0,0 +1,261 @@
+#include "profile_report.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace gorc;
+
+namespace {
+
+    using message_entry = std::pair<cog::execution_profiler::message_key,
+                                    cog::execution_message_stats>;
+    using verb_entry = std::pair<std::string, cog::execution_verb_stats>;
+
+    std::vector<cog::opcode> get_all_opcodes()
+    {
+        std::vector<cog::opcode> rv;
+        for(int op = static_cast<int>(cog::opcode::push);
+            op <= static_cast<int>(cog::opcode::le);
+            ++op) {
+            rv.push_back(static_cast<cog::opcode>(op));
+        }
+
+        return rv;
+    }
+
+    uint64_t get_total_instructions(cog::execution_profiler const &prof)
+    {
+        uint64_t total = 0;
+        for(auto op : get_all_opcodes()) {
+            total += prof.get_opcode_count(op);
+        }
+
+        return total;
+    }
+
+    std::vector<cog::opcode> get_sorted_opcodes(cog::execution_profiler const &prof)
+    {
+        auto rv = get_all_opcodes();
+        rv.erase(std::remove_if(rv.begin(), rv.end(), [&](cog::opcode op) {
+                return prof.get_opcode_count(op) == 0;
+            }), rv.end());
+
+        std::stable_sort(rv.begin(), rv.end(), [&](cog::opcode a, cog::opcode b) {
+                return prof.get_opcode_count(a) > prof.get_opcode_count(b);
+            });
+
+        return rv;
+    }
+
+    std::vector<std::pair<std::string, uint64_t>> get_sorted_scripts(
+            cog::execution_profiler const &prof)
+    {
+        std::map<std::string, uint64_t> scripts;
+        for(auto const &msg : prof.get_messages()) {
+            scripts[std::get<0>(msg.first)] += msg.second.instructions;
+        }
+
+        std::vector<std::pair<std::string, uint64_t>> rv(scripts.begin(), scripts.end());
+        std::stable_sort(rv.begin(), rv.end(), [](auto const &a, auto const &b) {
+                return a.second > b.second;
+            });
+
+        return rv;
+    }
+
+    std::vector<message_entry> get_sorted_messages(cog::execution_profiler const &prof)
+    {
+        std::vector<message_entry> rv(prof.get_messages().begin(), prof.get_messages().end());
+        std::stable_sort(rv.begin(), rv.end(), [](auto const &a, auto const &b) {
+                return a.second.instructions > b.second.instructions;
+            });
+
+        return rv;
+    }
+
+    std::vector<verb_entry> get_sorted_verbs(cog::execution_profiler const &prof)
+    {
+        std::vector<verb_entry> rv(prof.get_verbs().begin(), prof.get_verbs().end());
+        std::stable_sort(rv.begin(), rv.end(), [](auto const &a, auto const &b) {
+                return a.second.time > b.second.time;
+            });
+
+        return rv;
+    }
+
+    double to_ms(cog::execution_profiler::clock::duration d)
+    {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+    template <typename FieldFn>
+    void print_queue_stats(std::ostream &os,
+                           char const *name,
+                           std::vector<cog::execution_queue_sample> const &samples,
+                           FieldFn field)
+    {
+        size_t max_size = 0;
+        double total_size = 0.0;
+        for(auto const &sample : samples) {
+            max_size = std::max(max_size, field(sample));
+            total_size += static_cast<double>(field(sample));
+        }
+
+        double mean_size = samples.empty() ? 0.0 : total_size / static_cast<double>(samples.size());
+
+        os << "  " << std::left << std::setw(10) << name
+           << std::right
+           << std::setw(10) << max_size << " max"
+           << std::setw(12) << std::setprecision(2) << mean_size << " mean"
+           << std::endl;
+    }
+
+}
+
+void gorc::print_profile_report(std::ostream &os, cog::execution_profiler const &prof)
+{
+    uint64_t total = get_total_instructions(prof);
+    auto percent = [&](uint64_t count) {
+        return (total > 0) ? (100.0 * static_cast<double>(count) / static_cast<double>(total)) : 0.0;
+    };
+
+    os << std::fixed
+       << "instructions: " << total << std::endl
+       << std::endl
+       << "opcodes:" << std::endl;
+    for(auto op : get_sorted_opcodes(prof)) {
+        uint64_t count = prof.get_opcode_count(op);
+        os << "  " << std::left << std::setw(10) << as_string(op)
+           << std::right
+           << std::setw(14) << count
+           << std::setw(8) << std::setprecision(1) << percent(count) << " %"
+           << std::endl;
+    }
+
+    os << std::endl << "scripts:" << std::endl;
+    for(auto const &script : get_sorted_scripts(prof)) {
+        os << std::setw(14) << script.second
+           << std::setw(8) << std::setprecision(1) << percent(script.second) << " %"
+           << "  " << script.first
+           << std::endl;
+    }
+
+    os << std::endl
+       << "messages:" << std::endl
+       << std::setw(10) << "sends"
+       << std::setw(14) << "instructions"
+       << std::setw(12) << "per send"
+       << std::setw(8) << "depth"
+       << "  handler" << std::endl;
+    for(auto const &msg : get_sorted_messages(prof)) {
+        double per_send = static_cast<double>(msg.second.instructions) /
+                          static_cast<double>(std::max(msg.second.sends, uint64_t(1)));
+        os << std::setw(10) << msg.second.sends
+           << std::setw(14) << msg.second.instructions
+           << std::setw(12) << std::setprecision(1) << per_send
+           << std::setw(8) << msg.second.max_call_depth
+           << "  " << std::get<0>(msg.first) << " " << std::get<1>(msg.first)
+           << std::endl;
+    }
+
+    os << std::endl
+       << "verbs:" << std::endl
+       << std::setw(10) << "calls"
+       << std::setw(14) << "total ms"
+       << std::setw(12) << "us/call"
+       << "  verb" << std::endl;
+    for(auto const &verb : get_sorted_verbs(prof)) {
+        double ms = to_ms(verb.second.time);
+        os << std::setw(10) << verb.second.calls
+           << std::setw(14) << std::setprecision(3) << ms
+           << std::setw(12) << std::setprecision(3)
+           << (1000.0 * ms / static_cast<double>(std::max(verb.second.calls, uint64_t(1))))
+           << "  " << verb.first
+           << std::endl;
+    }
+
+    auto const &samples = prof.get_queue_samples();
+    os << std::endl << "queues (" << samples.size() << " updates):" << std::endl;
+    print_queue_stats(os, "sleep", samples, [](auto const &s) { return s.sleep_records; });
+    print_queue_stats(os, "wait", samples, [](auto const &s) { return s.wait_records; });
+    print_queue_stats(os, "timer", samples, [](auto const &s) { return s.timer_records; });
+    print_queue_stats(os, "pulse", samples, [](auto const &s) { return s.pulse_records; });
+}
+
+void gorc::write_profile_json(json_output_stream &jos, cog::execution_profiler const &prof)
+{
+    json_serialize_members(jos, [&] {
+        json_serialize_member(jos, "instructions", [&] {
+            json_serialize(jos, get_total_instructions(prof));
+        });
+
+        json_serialize_member(jos, "opcodes", [&] {
+            json_serialize_members(jos, [&] {
+                for(auto op : get_sorted_opcodes(prof)) {
+                    json_serialize_member(jos, as_string(op), [&] {
+                        json_serialize(jos, prof.get_opcode_count(op));
+                    });
+                }
+            });
+        });
+
+        json_serialize_member(jos, "scripts", [&] {
+            json_serialize_array(jos, get_sorted_scripts(prof), [&](auto const &script) {
+                json_serialize_members(jos, [&] {
+                    json_serialize_member(jos, "script", [&] { json_serialize(jos, script.first); });
+                    json_serialize_member(jos, "instructions", [&] {
+                        json_serialize(jos, script.second);
+                    });
+                });
+            });
+        });
+
+        json_serialize_member(jos, "messages", [&] {
+            json_serialize_array(jos, get_sorted_messages(prof), [&](message_entry const &msg) {
+                json_serialize_members(jos, [&] {
+                    json_serialize_member(jos, "script", [&] {
+                        json_serialize(jos, std::get<0>(msg.first));
+                    });
+                    json_serialize_member(jos, "message", [&] {
+                        json_serialize(jos, std::get<1>(msg.first));
+                    });
+                    json_serialize_member(jos, "sends", [&] { json_serialize(jos, msg.second.sends); });
+                    json_serialize_member(jos, "instructions", [&] {
+                        json_serialize(jos, msg.second.instructions);
+                    });
+                    json_serialize_member(jos, "max_call_depth", [&] {
+                        json_serialize(jos, msg.second.max_call_depth);
+                    });
+                });
+            });
+        });
+
+        json_serialize_member(jos, "verbs", [&] {
+            json_serialize_array(jos, get_sorted_verbs(prof), [&](verb_entry const &verb) {
+                json_serialize_members(jos, [&] {
+                    json_serialize_member(jos, "verb", [&] { json_serialize(jos, verb.first); });
+                    json_serialize_member(jos, "calls", [&] { json_serialize(jos, verb.second.calls); });
+                    json_serialize_member(jos, "total_ms", [&] {
+                        json_serialize(jos, to_ms(verb.second.time));
+                    });
+                });
+            });
+        });
+
+        json_serialize_member(jos, "queues", [&] {
+            json_serialize_array(jos,
+                                 prof.get_queue_samples(),
+                                 [&](cog::execution_queue_sample const &sample) {
+                json_serialize_members(jos, [&] {
+                    json_serialize_member(jos, "time", [&] { json_serialize(jos, sample.time.count()); });
+                    json_serialize_member(jos, "sleep", [&] { json_serialize(jos, sample.sleep_records); });
+                    json_serialize_member(jos, "wait", [&] { json_serialize(jos, sample.wait_records); });
+                    json_serialize_member(jos, "timer", [&] { json_serialize(jos, sample.timer_records); });
+                    json_serialize_member(jos, "pulse", [&] { json_serialize(jos, sample.pulse_records); });
+                });
+            });
+        });
+    });
+}
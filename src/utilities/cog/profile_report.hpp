@@ -0,0 +1,15 @@
+#pragma once
+
+#include "jk/cog/vm/execution_profiler.hpp"
+#include "text/json_output_stream.hpp"
+#include <ostream>
+
+namespace gorc {
+
+    // Prints instruction counts, verb timings and queue sizes, most
+    // expensive first.
+    void print_profile_report(std::ostream &os, cog::execution_profiler const &prof);
+
+    void write_profile_json(json_output_stream &jos, cog::execution_profiler const &prof);
+
+}
@@ -30,7 +30,7 @@ namespace gorc {
             std_input_stream is;
             is.reopen_as_binary();
 
-            binary_input_stream bis(is);
+            binary_input_stream bis(is, binary_stream_buffer_size);
             colormap cmp(deserialization_constructor, bis);
 
             service_registry services;
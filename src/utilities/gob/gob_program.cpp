@@ -0,0 +1,351 @@
+#include "gob_program.hpp"
+#include "jk/vfs/gob_virtual_container.hpp"
+#include "jk/vfs/jk_virtual_file_system.hpp"
+#include "io/std_output_stream.hpp"
+#include "io/native_file.hpp"
+#include "io/mapped_file.hpp"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <thread>
+
+namespace gorc {
+
+    class gob_program : public program {
+    private:
+        // Archive modes
+        std::string archive_file;
+
+        bool jk_mode = false;
+        std::string jk_game;
+        std::string jk_episode;
+        std::string jk_resource = "resource";
+
+        bool list_names_only = false;
+        int jobs = 0;
+
+        // Sub-commands
+        bool do_list = false;
+        bool extract_list = false;
+        std::string extract_file;
+
+    public:
+        virtual void create_options(options &opts) override
+        {
+            // Archive modes
+            opts.insert(make_value_option("file", archive_file));
+            opts.insert(make_switch_option("jk", jk_mode));
+
+            opts.emplace_constraint<gorc::mutual_exclusion>(
+                    std::vector<std::string> { "file", "jk" },
+                    /* min set */ 1,
+                    /* max set */ 1);
+
+            opts.insert(make_value_option("game", jk_game));
+            opts.emplace_constraint<gorc::dependent_option>("game", "jk");
+
+            opts.insert(make_value_option("episode", jk_episode));
+            opts.emplace_constraint<gorc::dependent_option>("episode", "jk");
+
+            opts.insert(make_value_option("resource", jk_resource));
+            opts.emplace_constraint<gorc::dependent_option>("resource", "jk");
+
+            // Sub-command modes
+            opts.insert(make_switch_option("list", do_list));
+            opts.insert(make_switch_option("names-only", list_names_only));
+            opts.emplace_constraint<gorc::dependent_option>("names-only", "list");
+            opts.emplace_constraint<gorc::dependent_option>("names-only", "jk");
+
+            opts.insert(make_value_option("extract", extract_file));
+
+            opts.insert(make_switch_option("extract-list", extract_list));
+            opts.emplace_constraint<gorc::dependent_option>("extract-list", "jk");
+
+            opts.insert(make_value_option("jobs", jobs, 0));
+            opts.emplace_constraint<gorc::dependent_option>("jobs", "extract-list");
+
+            opts.emplace_constraint<gorc::mutual_exclusion>(
+                    std::vector<std::string> { "list", "extract", "extract-list" },
+                    /* min set */ 1,
+                    /* max set */ 1);
+        }
+
+        virtual int run() override
+        {
+            if(jk_mode) {
+                // Handle JK VFS mode
+                return jk_vfs_main();
+            }
+            else if(!archive_file.empty()) {
+                // Handle single archive
+                return single_archive_main();
+            }
+
+            // LCOV_EXCL_START
+            // Not possible - guards against future changes
+            LOG_FATAL("unhandled option");
+            // LCOV_EXCL_STOP
+        }
+
+        int jk_vfs_main()
+        {
+            std::unique_ptr<jk_virtual_file_system> vfs;
+            if(jk_game.empty()) {
+                vfs = std::make_unique<jk_virtual_file_system>(jk_resource);
+            }
+            else {
+                vfs = std::make_unique<jk_virtual_file_system>(jk_resource, jk_game);
+            }
+
+            std::unique_ptr<virtual_container> episode_gob;
+            if(!jk_episode.empty()) {
+                episode_gob = std::make_unique<gob_virtual_container>(jk_episode);
+                vfs->set_current_episode(*episode_gob);
+            }
+
+            // Handle sub-commands
+            if(!extract_file.empty()) {
+                return jk_vfs_extract_file(*vfs);
+            }
+            else if(extract_list) {
+                return jk_vfs_extract_list(*vfs);
+            }
+            else {
+                // Default: list files
+                return jk_vfs_list(*vfs);
+            }
+        }
+
+        int single_archive_main()
+        {
+            gob_virtual_container gob(archive_file);
+
+            if(!extract_file.empty()) {
+                return single_archive_extract_file(gob);
+            }
+            else {
+                // Default: list files
+                return single_archive_list(gob);
+            }
+        }
+
+        std::set<path> get_extract_list()
+        {
+            std::set<path> rv;
+            for(std::string line; std::getline(std::cin, line); ) {
+                rv.insert(line);
+            }
+
+            return rv;
+        }
+
+        int jk_vfs_list(jk_virtual_file_system const &vfs)
+        {
+            if(list_names_only) {
+                return jk_vfs_list_names_only(vfs);
+            }
+
+            auto vfs_map = vfs.list_files();
+            size_t num_files = 0;
+            for(auto const &f : vfs_map) {
+                std::cout << f.first << " => " << f.second << std::endl;
+                ++num_files;
+            }
+            std::cout << "--------------------" << std::endl;
+            std::cout << "Files: " << num_files << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+        int jk_vfs_list_names_only(jk_virtual_file_system const &vfs)
+        {
+            auto vfs_map = vfs.list_files();
+            for(auto const &f : vfs_map) {
+                std::cout << f.first << std::endl;
+            }
+
+            return EXIT_SUCCESS;
+        }
+
+        int single_archive_list(gob_virtual_container const &gob)
+        {
+            for(size_t i = 0; i < gob.size(); ++i) {
+                auto const &gf = gob.get_file(i);
+
+                std::cout << i + 1
+                          << ": "
+                          << gf.name.generic_string()
+                          << std::endl;
+                std::cout << "    Size:   "
+                          << std::setw(10)
+                          << gf.chunk_length
+                          << std::endl;
+                std::cout << "    Offset: "
+                          << std::setw(10)
+                          << gf.chunk_offset
+                          << std::endl;
+            }
+
+            std::cout << "Total: " << gob.size() << std::endl;
+
+            return EXIT_SUCCESS;
+        }
+
+        int jk_vfs_extract_file(virtual_file_system const &vfs)
+        {
+            // Transform input filename to lowercase
+            std::transform(extract_file.begin(),
+                           extract_file.end(),
+                           extract_file.begin(),
+                           tolower);
+            path p = extract_file;
+
+            // Locate file in VFS
+            auto f = vfs.open(p);
+
+            // Print
+            std_output_stream out_stream;
+            out_stream.reopen_as_binary();
+            f->copy_to(out_stream);
+
+            return EXIT_SUCCESS;
+        }
+
+        int single_archive_extract_file(gob_virtual_container const &gob)
+        {
+            // Transform input filename to lowercase
+            std::transform(extract_file.begin(),
+                           extract_file.end(),
+                           extract_file.begin(),
+                           tolower);
+            path p = extract_file;
+
+            // Locate file in archive
+            for(auto const &file : gob) {
+                if(file.name == p) {
+                    std_output_stream out_stream;
+                    out_stream.reopen_as_binary();
+                    auto input_file = file.open();
+                    input_file->copy_to(out_stream);
+                    return EXIT_SUCCESS;
+                }
+            }
+
+            LOG_FATAL(format("file %s not in archive") % extract_file);
+        }
+
+        class extraction {
+        public:
+            path target;
+
+            // Contents of the file, when it can be copied directly from a
+            // mapped GOB container.
+            maybe<span<char const>> mapped_contents;
+
+            extraction(path const &target)
+                : target(target)
+            {
+                return;
+            }
+        };
+
+        void run_extraction(jk_virtual_file_system const &vfs, extraction const &job)
+        {
+            if(job.mapped_contents.has_value()) {
+                auto const &contents = job.mapped_contents.get_value();
+                auto nf = make_native_file(job.target);
+                nf->write(contents.data(), contents.size());
+            }
+            else {
+                auto input_file = vfs.open(job.target);
+                auto nf = make_native_file(job.target);
+                input_file->copy_to(*nf);
+            }
+        }
+
+        int jk_vfs_extract_list(jk_virtual_file_system const &vfs)
+        {
+            auto extract_set = get_extract_list();
+            std::vector<extraction> extractions(extract_set.begin(), extract_set.end());
+
+            // Each GOB container is mapped once and shared by every file it holds.
+            std::map<path, std::unique_ptr<mapped_file>> mapped_containers;
+
+            for(auto &job : extractions) {
+                // Create directories up front so that workers do not race
+                if(job.target.has_parent_path()) {
+                    boost::filesystem::create_directories(job.target.parent_path());
+                }
+
+                auto entry = vfs.find_entry(job.target);
+                if(!entry.has_value()) {
+                    continue;
+                }
+
+                auto gob_file = dynamic_cast<gob_virtual_file const*>(entry.get_value()->gob_file);
+                if(!gob_file) {
+                    continue;
+                }
+
+                auto &container = mapped_containers[gob_file->parent_container.container_filename];
+                if(!container) {
+                    container = std::make_unique<mapped_file>(
+                            gob_file->parent_container.container_filename);
+                }
+
+                auto contents = container->data();
+                if(gob_file->chunk_offset + gob_file->chunk_length <= contents.size()) {
+                    job.mapped_contents = contents.subspan(gob_file->chunk_offset,
+                                                           gob_file->chunk_length);
+                }
+            }
+
+            std::atomic<size_t> next_extraction(0);
+            std::atomic<bool> success(true);
+
+            auto extract_thread = [&]() {
+                while(true) {
+                    size_t i = next_extraction++;
+                    if(i >= extractions.size()) {
+                        return;
+                    }
+
+                    try {
+                        run_extraction(vfs, extractions[i]);
+                    }
+                    catch(logged_runtime_error const &) {
+                        success = false;
+                    }
+                    catch(std::exception const &e) {
+                        LOG_ERROR(format("%s: %s") % extractions[i].target.generic_string() % e.what());
+                        success = false;
+                    }
+                }
+            };
+
+            size_t threads = (jobs > 0) ? static_cast<size_t>(jobs)
+                                        : std::thread::hardware_concurrency();
+            threads = std::max(size_t(1), std::min(threads, extractions.size()));
+
+            std::vector<std::thread> thread_pool;
+            for(size_t i = 0; i < threads; ++i) {
+                thread_pool.emplace_back(extract_thread);
+            }
+
+            for(auto &thread : thread_pool) {
+                thread.join();
+            }
+
+            return success ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    };
+
+}
+
+std::unique_ptr<gorc::program> gorc::make_gob_program()
+{
+    return std::make_unique<gob_program>();
+}
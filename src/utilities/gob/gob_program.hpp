@@ -0,0 +1,10 @@
+#pragma once
+
+#include "program/program.hpp"
+#include <memory>
+
+namespace gorc {
+
+    std::unique_ptr<program> make_gob_program();
+
+}
@@ -31,7 +31,7 @@ namespace gorc {
             std_input_stream is;
             is.reopen_as_binary();
 
-            binary_input_stream bis(is);
+            binary_input_stream bis(is, binary_stream_buffer_size);
             raw_material mat(deserialization_constructor, bis);
 
             if(extract_path.empty()) {
@@ -44,7 +44,7 @@ namespace gorc {
 
             if(!colormap_path.empty()) {
                 auto cmp_is = make_native_read_only_file(colormap_path);
-                binary_input_stream bis(*cmp_is);
+                binary_input_stream bis(*cmp_is, binary_stream_buffer_size);
                 cmp = std::make_unique<colormap>(deserialization_constructor, bis);
                 services.add<colormap>(*cmp);
             }
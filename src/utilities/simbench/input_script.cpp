@@ -0,0 +1,91 @@
+#include "input_script.hpp"
+#include "text/json_specification.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+using namespace gorc;
+
+namespace {
+
+    std::unordered_map<std::string, simbench_action> action_map {
+        { "move", simbench_action::move },
+        { "yaw", simbench_action::yaw },
+        { "pitch", simbench_action::pitch },
+        { "jump", simbench_action::jump },
+        { "activate", simbench_action::activate },
+        { "fly", simbench_action::fly },
+        { "crouch", simbench_action::crouch },
+        { "stand", simbench_action::stand },
+        { "fire", simbench_action::fire },
+        { "release", simbench_action::release }
+    };
+
+    json_specification<simbench_input_event> simbench_input_event_spec(
+            /* Members */
+            {
+                { "tick", make_json_member(&simbench_input_event::tick) },
+
+                { "action", [](json_input_stream &f, simbench_input_event &e) {
+                        auto name = json_deserialize<std::string>(f);
+                        auto it = action_map.find(name);
+                        if(it == action_map.end()) {
+                            LOG_FATAL(format("unknown input action '%s'") % name);
+                        }
+
+                        e.action = it->second;
+                    }
+                },
+
+                { "direction", [](json_input_stream &f, simbench_input_event &e) {
+                        std::vector<float> components;
+                        json_deserialize_array<float>(f, std::back_inserter(components));
+                        if(components.size() != 3) {
+                            LOG_FATAL("direction must have three components");
+                        }
+
+                        e.direction = make_vector(components[0], components[1], components[2]);
+                    }
+                },
+
+                { "amount", make_json_member(&simbench_input_event::amount) },
+                { "mode", make_json_member(&simbench_input_event::mode) }
+            },
+
+            /* Required members */
+            { "tick", "action" }
+        );
+
+    json_specification<simbench_input_script> simbench_input_script_spec(
+            /* Members */
+            {
+                { "events", [](json_input_stream &f, simbench_input_script &scr) {
+                        json_deserialize_array(f, [&](json_input_stream &f) {
+                            scr.events.emplace_back(deserialization_constructor, f);
+                        });
+                    }
+                }
+            }
+        );
+
+}
+
+gorc::simbench_input_event::simbench_input_event(deserialization_constructor_tag,
+                                                 json_input_stream &f)
+{
+    json_deserialize_with_specification(f, simbench_input_event_spec, *this);
+}
+
+gorc::simbench_input_script::simbench_input_script()
+{
+    return;
+}
+
+gorc::simbench_input_script::simbench_input_script(deserialization_constructor_tag,
+                                                   json_input_stream &f)
+{
+    json_deserialize_with_specification(f, simbench_input_script_spec, *this);
+
+    std::stable_sort(events.begin(), events.end(), [](auto const &a, auto const &b) {
+            return a.tick < b.tick;
+        });
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "text/json_input_stream.hpp"
+#include "math/vector.hpp"
+#include <vector>
+
+namespace gorc {
+
+    enum class simbench_action {
+        move,
+        yaw,
+        pitch,
+        jump,
+        activate,
+        fly,
+        crouch,
+        stand,
+        fire,
+        release
+    };
+
+    // Player input applied at the start of a given simulation tick.
+    class simbench_input_event {
+    public:
+        int tick = 0;
+        simbench_action action = simbench_action::move;
+        vector<3> direction = make_zero_vector<3, float>();
+        double amount = 0.0;
+        int mode = 0;
+
+        simbench_input_event(deserialization_constructor_tag, json_input_stream &);
+    };
+
+    class simbench_input_script {
+    public:
+        // Sorted by tick. Events on the same tick keep their file order.
+        std::vector<simbench_input_event> events;
+
+        simbench_input_script();
+        simbench_input_script(deserialization_constructor_tag, json_input_stream &);
+    };
+
+}
@@ -0,0 +1,378 @@
+#include "program/program.hpp"
+#include "game/level_state.hpp"
+#include "game/world/level_model.hpp"
+#include "game/world/level_presenter.hpp"
+#include "game/world/level_snapshot.hpp"
+#include "game/world/replay/input_log.hpp"
+#include "game/world/replay/state_hash.hpp"
+#include "jk/vfs/gob_virtual_container.hpp"
+#include "jk/vfs/jk_virtual_file_system.hpp"
+#include "libold/content/register_legacy_loaders.hpp"
+#include "io/native_file.hpp"
+#include "io/snapshot_writer.hpp"
+#include "profile/trace_export.hpp"
+#include "input_script.hpp"
+#include "null_renderer_object_factory.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+namespace gorc {
+
+    class simbench_program : public program {
+    private:
+        std::string jk_resource;
+        std::string jk_game;
+        std::string episode_file;
+        std::string level_file;
+        std::string input_file;
+        std::string trace_file;
+        std::string record_file;
+        std::string replay_file;
+        std::string snapshot_file;
+        std::string restore_file;
+
+        int ticks = 0;
+        int timestep_ms = 0;
+        int seed = 0;
+        int snapshot_interval = 0;
+
+        using clock = std::chrono::steady_clock;
+        using input_command = game::world::replay::input_command;
+        using input_command_type = game::world::replay::input_command_type;
+
+        void apply_input(game::world::level_presenter &presenter,
+                         simbench_input_event const &e,
+                         vector<3> &move_direction)
+        {
+            switch(e.action) {
+            case simbench_action::move:
+                move_direction = e.direction;
+                break;
+
+            case simbench_action::yaw:
+                presenter.submit_input(input_command(input_command_type::yaw, static_cast<float>(e.amount)));
+                break;
+
+            case simbench_action::pitch:
+                presenter.submit_input(input_command(input_command_type::pitch, static_cast<float>(e.amount)));
+                break;
+
+            case simbench_action::jump:
+                presenter.submit_input(input_command(input_command_type::jump));
+                break;
+
+            case simbench_action::activate:
+                presenter.submit_input(input_command(input_command_type::activate));
+                break;
+
+            case simbench_action::fly:
+                presenter.submit_input(input_command(input_command_type::fly));
+                break;
+
+            case simbench_action::crouch:
+                presenter.submit_input(input_command(input_command_type::crouch));
+                break;
+
+            case simbench_action::stand:
+                presenter.submit_input(input_command(input_command_type::stand));
+                break;
+
+            case simbench_action::fire:
+                presenter.submit_input(input_command(input_command_type::fire, e.mode));
+                break;
+
+            case simbench_action::release:
+                presenter.submit_input(input_command(input_command_type::release, e.mode));
+                break;
+            }
+        }
+
+        void print_subsystem(char const *name,
+                             clock::duration d,
+                             clock::duration total)
+        {
+            double ms = std::chrono::duration<double, std::milli>(d).count();
+            double total_ms = std::chrono::duration<double, std::milli>(total).count();
+            double pct = (total_ms > 0.0) ? (100.0 * ms / total_ms) : 0.0;
+
+            std::cout << std::left << std::setw(12) << name
+                      << std::right << std::fixed
+                      << std::setw(12) << std::setprecision(3) << ms << " ms"
+                      << std::setw(12) << std::setprecision(3) << (1000.0 * ms / ticks) << " us/tick"
+                      << std::setw(8) << std::setprecision(1) << pct << " %"
+                      << std::endl;
+        }
+
+    public:
+        virtual void create_options(options &opts) override
+        {
+            opts.insert(make_value_option("resource", jk_resource, std::string("game/resource")));
+            opts.insert(make_value_option("game", jk_game, std::string("game/restricted")));
+            opts.insert(make_value_option("episode", episode_file));
+            opts.insert(make_value_option("level", level_file));
+            opts.insert(make_value_option("input", input_file));
+            opts.insert(make_value_option("trace", trace_file));
+            opts.insert(make_value_option("record", record_file));
+            opts.insert(make_value_option("replay", replay_file));
+            opts.insert(make_value_option("ticks", ticks, 3600));
+            opts.insert(make_value_option("timestep-ms", timestep_ms, 16));
+            opts.insert(make_value_option("seed", seed, 0));
+            opts.insert(make_value_option("snapshot", snapshot_file));
+            opts.insert(make_value_option("snapshot-interval", snapshot_interval, 60));
+            opts.insert(make_value_option("restore", restore_file));
+
+            opts.emplace_constraint<required_option>(std::vector<std::string>{"episode", "level"});
+            return;
+        }
+
+        virtual int run() override
+        {
+            if(ticks <= 0) {
+                LOG_FATAL("ticks must be positive");
+            }
+
+            if(timestep_ms <= 0) {
+                LOG_FATAL("timestep-ms must be positive");
+            }
+
+            if(!replay_file.empty() && (!input_file.empty() || !record_file.empty())) {
+                LOG_FATAL("replay cannot be combined with input or record");
+            }
+
+            if(!restore_file.empty() && (!replay_file.empty() || !record_file.empty())) {
+                LOG_FATAL("restore cannot be combined with record or replay");
+            }
+
+            simbench_input_script script;
+            if(!input_file.empty()) {
+                diagnostic_context dc(input_file.c_str());
+                auto f = make_native_read_only_file(input_file);
+                json_input_stream jis(*f);
+                script = simbench_input_script(deserialization_constructor, jis);
+            }
+
+            // A replay brings its own seed, timestep and length
+            std::unique_ptr<game::world::replay::input_log> replay_log;
+            if(!replay_file.empty()) {
+                diagnostic_context dc(replay_file.c_str());
+                auto f = make_native_read_only_file(replay_file);
+                binary_input_stream bis(*f, binary_stream_buffer_size);
+                replay_log = std::make_unique<game::world::replay::input_log>(deserialization_constructor, bis);
+
+                seed = static_cast<int>(replay_log->header.random_seed);
+                timestep_ms = replay_log->header.timestep_ms;
+                ticks = static_cast<int>(replay_log->ticks.size());
+
+                if(ticks <= 0) {
+                    LOG_FATAL("replay contains no ticks");
+                }
+            }
+
+            profile::set_enabled(!trace_file.empty());
+            std::vector<profile::zone_record> trace_zones;
+
+            auto load_start = clock::now();
+
+            loader_registry loaders;
+            content::register_legacy_loaders(loaders);
+
+            jk_virtual_file_system fs(jk_resource, jk_game);
+
+            std::unique_ptr<virtual_container> episode_ctr;
+            {
+                diagnostic_context dc(episode_file.c_str());
+                episode_ctr = std::make_unique<gob_virtual_container>(episode_file);
+                fs.set_current_episode(*episode_ctr);
+            }
+
+            service_registry services;
+            services.add<virtual_file_system>(fs);
+            services.add<jk_virtual_file_system>(fs);
+            services.add(loaders);
+
+            event_bus eventbus;
+            null_renderer_object_factory renderer_object_factory;
+
+            game::level_state components(services);
+            game::world::level_presenter::register_verbs(components.verbs, components);
+
+            components.services.add_or_replace(eventbus);
+            components.services.add_or_replace<gorc::renderer_object_factory>(renderer_object_factory);
+
+            auto contentmanager = std::make_shared<content_manager>(components.services);
+            auto const &lev = contentmanager->load<content::assets::level>(level_file);
+
+            components.current_level_presenter = std::make_unique<game::world::level_presenter>(
+                    components, game::world::level_place(contentmanager, lev));
+            auto &presenter = *components.current_level_presenter;
+            presenter.random_seed = static_cast<uint32_t>(seed);
+            presenter.replaying = static_cast<bool>(replay_log);
+            presenter.start(eventbus);
+
+            // Continue from the last snapshot of an earlier run
+            if(!restore_file.empty()) {
+                game::world::restore_level_snapshot(*presenter.model, restore_file);
+                std::cout << "restored state hash: " << std::hex << std::setw(16) << std::setfill('0')
+                          << game::world::replay::hash_level_state(*presenter.model)
+                          << std::dec << std::setfill(' ') << std::endl;
+            }
+
+            std::unique_ptr<native_file> record_stream;
+            std::unique_ptr<game::world::replay::input_recorder> recorder;
+            if(!record_file.empty()) {
+                game::world::replay::input_log_header header;
+                header.random_seed = presenter.random_seed;
+                header.timestep_ms = timestep_ms;
+                header.episode = episode_file;
+                header.level = level_file;
+
+                record_stream = make_native_file(record_file);
+                recorder = std::make_unique<game::world::replay::input_recorder>(*record_stream, header);
+                presenter.input_recorder = recorder.get();
+            }
+
+            std::unique_ptr<game::world::replay::input_player> player;
+            if(replay_log) {
+                player = std::make_unique<game::world::replay::input_player>(*replay_log);
+            }
+
+            std::unique_ptr<native_file> snapshot_stream;
+            std::unique_ptr<snapshot_writer> snapshots;
+            if(!snapshot_file.empty()) {
+                if(snapshot_interval <= 0) {
+                    LOG_FATAL("snapshot interval must be positive");
+                }
+
+                snapshot_stream = make_native_file(snapshot_file);
+                snapshots = std::make_unique<snapshot_writer>(*snapshot_stream);
+            }
+
+            snapshot_image snapshot;
+            clock::duration snapshot_time = clock::duration::zero();
+            clock::duration snapshot_max_time = clock::duration::zero();
+
+            // Hashing is only paid for when something checks the result
+            bool hash_state = recorder || player;
+            uint64_t state_hash = 0;
+
+            auto load_time = clock::now() - load_start;
+
+            // Run the simulation
+            game::world::level_update_timings timings;
+            presenter.update_timings = &timings;
+
+            vector<3> move_direction = make_zero_vector<3, float>();
+            auto next_event = script.events.begin();
+            uint32_t current_ms = 0;
+
+            auto sim_start = clock::now();
+            for(int tick = 0; tick < ticks; ++tick) {
+                if(player) {
+                    player->begin_tick(presenter);
+                }
+                else {
+                    for(; next_event != script.events.end() && next_event->tick <= tick; ++next_event) {
+                        apply_input(presenter, *next_event, move_direction);
+                    }
+
+                    presenter.submit_input(input_command(input_command_type::move, move_direction));
+                }
+
+                uint32_t next_ms = current_ms + static_cast<uint32_t>(timestep_ms);
+                presenter.update(gorc::time(timestamp(next_ms), timestamp(current_ms)));
+                current_ms = next_ms;
+
+                if(hash_state) {
+                    state_hash = game::world::replay::hash_level_state(*presenter.model);
+
+                    if(player) {
+                        player->end_tick(state_hash);
+                    }
+
+                    if(recorder) {
+                        recorder->end_tick(state_hash);
+                    }
+                }
+
+                // Only the capture runs here. Writing happens on the snapshot thread.
+                if(snapshots && (tick + 1) % snapshot_interval == 0) {
+                    auto capture_start = clock::now();
+                    game::world::capture_level_snapshot(*presenter.model, snapshot);
+                    snapshots->submit(snapshot);
+
+                    auto capture_time = clock::now() - capture_start;
+                    snapshot_time += capture_time;
+                    snapshot_max_time = std::max(snapshot_max_time, capture_time);
+                }
+
+                if(profile::is_enabled()) {
+                    auto zones = profile::collect();
+                    trace_zones.insert(trace_zones.end(), zones.begin(), zones.end());
+                }
+            }
+
+            auto sim_time = clock::now() - sim_start;
+            presenter.update_timings = nullptr;
+
+            double load_seconds = std::chrono::duration<double>(load_time).count();
+            double sim_seconds = std::chrono::duration<double>(sim_time).count();
+
+            std::cout << "level: " << level_file << std::endl
+                      << "ticks: " << ticks << " x " << timestep_ms << " ms" << std::endl
+                      << std::fixed << std::setprecision(3)
+                      << "load time: " << load_seconds << " s" << std::endl
+                      << "simulation time: " << sim_seconds << " s" << std::endl
+                      << std::setprecision(1)
+                      << "ticks/second: " << (static_cast<double>(ticks) / sim_seconds) << std::endl
+                      << std::endl;
+
+            print_subsystem("physics", timings.physics, sim_time);
+            print_subsystem("camera", timings.camera, sim_time);
+            print_subsystem("sounds", timings.sounds, sim_time);
+            print_subsystem("keys", timings.keys, sim_time);
+            print_subsystem("inventory", timings.inventory, sim_time);
+            print_subsystem("scripts", timings.scripts, sim_time);
+            print_subsystem("ecs", timings.ecs, sim_time);
+
+            if(snapshots) {
+                print_subsystem("snapshots", snapshot_time, sim_time);
+                snapshots->flush();
+
+                std::cout << std::endl
+                          << std::fixed << std::setprecision(3)
+                          << "snapshot max capture: "
+                          << std::chrono::duration<double, std::milli>(snapshot_max_time).count() << " ms"
+                          << std::endl
+                          << "snapshots written: " << snapshots->get_records_written()
+                          << " (" << snapshots->get_records_dropped() << " dropped)" << std::endl
+                          << "snapshot pages written: " << snapshots->get_pages_written()
+                          << " of " << snapshots->get_pages_total() << std::endl;
+            }
+
+            if(!trace_file.empty()) {
+                auto f = make_native_file(trace_file);
+                json_output_stream jos(*f);
+                profile::write_chrome_trace(jos, trace_zones);
+            }
+
+            if(hash_state) {
+                std::cout << std::endl
+                          << "final state hash: " << std::hex << std::setw(16) << std::setfill('0')
+                          << state_hash << std::dec << std::setfill(' ') << std::endl;
+            }
+
+            if(player && player->first_mismatch.has_value()) {
+                LOG_ERROR(format("level state differs from the recording on %d ticks, first on tick %d") %
+                          player->mismatched_ticks %
+                          player->first_mismatch.get_value());
+                return EXIT_FAILURE;
+            }
+
+            return EXIT_SUCCESS;
+        }
+    };
+
+}
+
+MAKE_MAIN(gorc::simbench_program)
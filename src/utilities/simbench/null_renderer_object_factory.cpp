@@ -0,0 +1,9 @@
+#include "null_renderer_object_factory.hpp"
+
+void gorc::null_renderer_object_factory::set_material_image(material_id,
+                                                            int,
+                                                            int,
+                                                            grid<color_rgba8> const &)
+{
+    return;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "jk/content/renderer_object_factory.hpp"
+
+namespace gorc {
+
+    // Discards material images. Used when simulating a level without a renderer.
+    class null_renderer_object_factory : public renderer_object_factory {
+    public:
+        virtual void set_material_image(material_id,
+                                        int cel,
+                                        int channel,
+                                        grid<color_rgba8> const &img) override;
+    };
+
+}